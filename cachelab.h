@@ -7,6 +7,7 @@
 #define CACHELAB_TOOLS_H
 
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 /**
@@ -22,12 +23,25 @@ typedef struct {
                                       from dirty lines */
 } csim_stats_t;
 
+/** @brief Default file that simulation statistics are stored in */
+#define CSIM_RESULTS_FILE ".csim_results"
+
+/** @brief Environment variable naming a file to store the statistics in */
+#define CSIM_RESULTS_ENV "CSIM_RESULTS"
+
+/** @brief Environment variable naming an inherited descriptor to write the
+           statistics to, taking precedence over CSIM_RESULTS */
+#define CSIM_RESULTS_FD_ENV "CSIM_RESULTS_FD"
+
 /** @brief Store a summary of the cache simulation statistics. */
 void printSummary(const csim_stats_t *stats);
 
 /* @brief Load the stored summary of the cache simulation statistics. */
 bool loadSummary(csim_stats_t *stats);
 
+/* @brief Read a stored summary of the statistics from an open stream. */
+bool readSummary(FILE *fp, csim_stats_t *stats);
+
 /* Grading parameters for transpose */
 
 /** @brief Number of clock cycles for hit */
@@ -100,4 +114,20 @@ void registerTransFunction(void (*trans)(size_t M, size_t N, double[N][M],
                                          double[M][N], double *),
                            const char *desc);
 
+/**
+ * @brief Copies one element in a transpose function, as dst = src.
+ *
+ * When trans.c is built with TRANS_RECORD defined, as for tracegen-rec, the
+ * copy also records its load and store with trans_record_copy(). Otherwise
+ * it is a plain assignment.
+ */
+#ifdef TRANS_RECORD
+#define TRANS_COPY(dst, src) (trans_record_copy(&(dst), &(src)), (dst) = (src))
+#else
+#define TRANS_COPY(dst, src) ((dst) = (src))
+#endif
+
+/** @brief Records the load of src and then the store of dst of a copy */
+void trans_record_copy(const double *dst, const double *src);
+
 #endif /* CACHELAB_TOOLS_H */
@@ -0,0 +1,1192 @@
+/**
+ * @file csim-cache.c
+ * @brief Set-associative LRU cache simulator engine
+ *
+ * Each set is stored as its counters followed by its lines. Small caches
+ * keep all sets in one dense array. Caches with more than
+ * CSIM_SPARSE_LINES lines are sparse: a set is carved from a slab the
+ * first time it is touched, and found through an open-addressed directory
+ * keyed by set index, so memory follows the sets a trace actually uses.
+ *
+ * Sets of CSIM_INDEXED_WAYS or more lines are indexed: after their lines
+ * come a recency list of the valid lines, most recent first, and an
+ * open-addressed hash table from tag to line. Lines of an indexed set do
+ * not count their age, since the recency list orders them by it already,
+ * so no access has to touch every line.
+ *
+ * A set is normally picked by the s bits above the block offset. Under
+ * XOR and prime indexing another function of the block number picks it,
+ * and the tag is whatever part of the block number that function leaves
+ * out. Skewed indexing picks a set for each way, so the lines that may
+ * hold a block are line w of the set picked for way w; lines then record
+ * the access that last used them, and the oldest of the candidates is
+ * evicted.
+ *
+ * Accesses of a partitioned cache carry a way mask, and a miss only
+ * considers the lines of the set whose ways are in it, empty ones first.
+ * Only the scan and skewed indexing know about masks, so partitioned
+ * caches never use indexed sets or a fixed engine.
+ *
+ * Dense caches whose geometry is listed in FIXED_GEOMETRIES simulate
+ * batches with an engine compiled for that geometry, where the shifts,
+ * masks and number of ways are constants, and the way loop is unrolled by
+ * a pragma, since the build otherwise keeps loops rolled. Every other
+ * cache, and every single access, goes through the generic engine.
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "csim-cache.h"
+
+struct line {
+    unsigned long tag;
+    long cycles_since_use;
+    unsigned owner;
+    bool isDirty;
+    bool isValid;
+};
+
+typedef struct line *line_t;
+
+/** @brief Size of the slabs that sparse sets are carved from */
+#define SLAB_BYTES (1UL << 20)
+
+/** @brief Number of runs whose sets are prefetched together in a batch */
+#define BATCH_GROUP 32
+
+/** @brief Most bytes of a set that are prefetched ahead of its access */
+#define PREFETCH_SET_BYTES 256
+
+/**
+ * @brief Geometries (s, E, b) that get an engine of their own: those of
+ *        cachelab.h, and the one test-csim weighs most.
+ */
+#define FIXED_GEOMETRIES(X)                                                    \
+    X(TEST_LOG_SET, TEST_ASSOC, TEST_LOG_BLOCK)                                \
+    X(HASWELL_L1_SET, HASWELL_L1_ASSOC, HASWELL_L1_BLOCK)                      \
+    X(5, 1, 5)
+
+/** @brief Initial number of slots of the sparse set directory */
+#define DIR_INITIAL_SLOTS 1024
+
+/** @brief The counters and lines of one set */
+struct cache_set {
+    csim_set_stats_t counts;
+    struct line lines[];
+};
+
+/** @brief Recency list and hash index of an indexed set, after its lines */
+struct set_index {
+    uint32_t filled; /* lines valid, which are lines [0, filled) */
+    uint32_t mru;    /* most recently used line, if filled > 0 */
+    uint32_t lru;    /* least recently used line, if filled > 0 */
+};
+
+/** @brief Place of a line of an indexed set in its recency list */
+struct way_link {
+    uint32_t prev; /* more recently used line */
+    uint32_t next; /* less recently used line */
+};
+
+/** @brief A slot of the sparse set directory, empty if cs is NULL */
+typedef struct {
+    unsigned long set;
+    struct cache_set *cs;
+} dir_slot_t;
+
+/** @brief A slab of sparse sets, chained so they can be freed */
+struct slab {
+    struct slab *next;
+    unsigned long data[]; /* aligned for struct cache_set */
+};
+
+/** @brief A batch engine compiled for one geometry */
+typedef void fixed_engine_t(csim_cache_t *cache, const csim_run_t runs[],
+                            size_t count);
+
+struct csim_cache {
+    bool sparse;
+    fixed_engine_t *engine; /* NULL for the generic engine */
+    size_t set_bytes; /* size of a struct cache_set with its lines */
+    bool indexed;     /* sets have a recency list and hash index */
+    bool partitioned; /* accesses may confine fills to some ways */
+    unsigned long index_slots; /* a power of two */
+
+    /* Dense storage: all sets, set_bytes apart */
+    unsigned char *sets;
+
+    /* Sparse storage */
+    dir_slot_t *dir;
+    unsigned long dir_slots; /* a power of two */
+    unsigned long dir_used;
+    struct slab *slabs;
+    unsigned char *slab_next; /* free space left in the newest slab */
+    size_t slab_left;
+    unsigned long last_set; /* set found by the last lookup */
+    struct cache_set *last_cs;
+
+    unsigned long num_sets;
+    unsigned long num_lines;
+    csim_indexing_t indexing;
+    unsigned long set_bits;
+    unsigned long clock; /* accesses so far, to order skewed lines */
+    unsigned long sb_sum;
+    unsigned long block_bits;
+    unsigned long set_mask;
+    unsigned long tag_mask;
+    bool verbose;
+    csim_stats_t stats; /* dirty counts are in lines until reported */
+};
+
+/** @brief Hashes a set index to a directory slot */
+static unsigned long dir_hash(const csim_cache_t *cache, unsigned long set) {
+    unsigned long h = set * 0x9e3779b97f4a7c15UL;
+    return (h ^ (h >> 32)) & (cache->dir_slots - 1);
+}
+
+/** @brief Finds the directory slot of a set, or the empty slot for it */
+static dir_slot_t *dir_find(const csim_cache_t *cache, unsigned long set) {
+    unsigned long h = dir_hash(cache, set);
+    while (cache->dir[h].cs != NULL && cache->dir[h].set != set) {
+        h = (h + 1) & (cache->dir_slots - 1);
+    }
+    return &cache->dir[h];
+}
+
+/** @brief Doubles the directory */
+static bool dir_grow(csim_cache_t *cache) {
+    dir_slot_t *old = cache->dir;
+    unsigned long old_slots = cache->dir_slots;
+    cache->dir = calloc(2 * old_slots, sizeof(dir_slot_t));
+    if (cache->dir == NULL) {
+        cache->dir = old;
+        return false;
+    }
+    cache->dir_slots = 2 * old_slots;
+    for (unsigned long i = 0; i < old_slots; i++) {
+        if (old[i].cs != NULL) {
+            *dir_find(cache, old[i].set) = old[i];
+        }
+    }
+    free(old);
+    return true;
+}
+
+/** @brief Carves a zeroed set out of the newest slab */
+static struct cache_set *slab_alloc(csim_cache_t *cache) {
+    if (cache->slab_left < cache->set_bytes) {
+        size_t data_bytes =
+            cache->set_bytes > SLAB_BYTES ? cache->set_bytes : SLAB_BYTES;
+        struct slab *slab = calloc(1, sizeof(struct slab) + data_bytes);
+        if (slab == NULL) {
+            return NULL;
+        }
+        slab->next = cache->slabs;
+        cache->slabs = slab;
+        cache->slab_next = (unsigned char *)slab->data;
+        cache->slab_left = data_bytes;
+    }
+    struct cache_set *cs = (struct cache_set *)cache->slab_next;
+    cache->slab_next += cache->set_bytes;
+    cache->slab_left -= cache->set_bytes;
+    return cs;
+}
+
+/** @brief Returns a set of a dense cache */
+static struct cache_set *dense_set(const csim_cache_t *cache,
+                                   unsigned long set) {
+    return (struct cache_set *)(cache->sets + set * cache->set_bytes);
+}
+
+/**
+ * @brief Returns a set, allocating it on first touch if sparse.
+ *
+ * @return The set, or NULL if it could not be allocated
+ */
+static struct cache_set *get_set(csim_cache_t *cache, unsigned long set) {
+    if (!cache->sparse) {
+        return dense_set(cache, set);
+    }
+    if (cache->last_cs != NULL && cache->last_set == set) {
+        return cache->last_cs;
+    }
+
+    dir_slot_t *slot = dir_find(cache, set);
+    if (slot->cs == NULL) {
+        /* Grow first, so that a failure leaves the directory as it was */
+        if ((cache->dir_used + 1) * 2 > cache->dir_slots) {
+            if (!dir_grow(cache)) {
+                return NULL;
+            }
+            slot = dir_find(cache, set);
+        }
+        struct cache_set *cs = slab_alloc(cache);
+        if (cs == NULL) {
+            return NULL;
+        }
+        slot->cs = cs;
+        slot->set = set;
+        cache->dir_used++;
+    }
+    cache->last_set = set;
+    cache->last_cs = slot->cs;
+    return slot->cs;
+}
+
+/** @brief Names of the indexing functions, by csim_indexing_t */
+static const char *const indexing_names[] = {"mod", "xor", "prime", "skew"};
+
+/** @brief Set of way `way` of a block under skewed indexing */
+static unsigned long skew_set(const csim_cache_t *cache, unsigned long block,
+                              unsigned long way) {
+    if (cache->set_bits == 0) {
+        return 0;
+    }
+    unsigned long h = (block ^ (way * 0x9e3779b97f4a7c15UL)) *
+                      0xbf58476d1ce4e5b9UL;
+    return h >> (64 - cache->set_bits);
+}
+
+/**
+ * @brief Returns the set an address maps to, or under skewed indexing the
+ *        set of way 0.
+ */
+static unsigned long set_of(const csim_cache_t *cache, unsigned long addr) {
+    unsigned long block = addr >> cache->block_bits;
+    switch (cache->indexing) {
+    case CSIM_INDEXING_XOR: {
+        unsigned long set = 0;
+        for (; block != 0 && cache->set_bits > 0;
+             block >>= cache->set_bits) {
+            set ^= block & cache->set_mask;
+        }
+        return set;
+    }
+    case CSIM_INDEXING_PRIME:
+        return block % cache->num_sets;
+    case CSIM_INDEXING_SKEW:
+        return skew_set(cache, block, 0);
+    default:
+        return block & cache->set_mask;
+    }
+}
+
+/** @brief Returns the tag of an address, which is unique within its set */
+static unsigned long tag_of(const csim_cache_t *cache, unsigned long addr) {
+    switch (cache->indexing) {
+    case CSIM_INDEXING_PRIME:
+        return (addr >> cache->block_bits) / cache->num_sets;
+    case CSIM_INDEXING_SKEW:
+        return addr >> cache->block_bits;
+    default:
+        return (addr >> cache->sb_sum) & cache->tag_mask;
+    }
+}
+
+/** @brief Returns the largest prime <= n, or 1 if there is none */
+static unsigned long prev_prime(unsigned long n) {
+    for (; n > 2; n--) {
+        bool prime = n % 2 != 0;
+        for (unsigned long d = 3; prime && d * d <= n; d += 2) {
+            prime = n % d != 0;
+        }
+        if (prime) {
+            return n;
+        }
+    }
+    return n;
+}
+
+/** @brief True if a way mask lets a miss fill line `way` of a set */
+static bool way_allowed(unsigned long ways, unsigned long way) {
+    return way >= CSIM_MASK_WAYS || ((ways >> way) & 1) != 0;
+}
+
+/**
+ * @brief Simulates an access and its same-block repeats under skewed
+ *        indexing.
+ */
+static bool skew_access(csim_cache_t *cache, unsigned long addr, char op,
+                        unsigned long repeats, bool store, unsigned owner,
+                        unsigned long ways, csim_outcome_t *outcome) {
+    csim_stats_t *stats = &cache->stats;
+    unsigned long block = addr >> cache->block_bits;
+
+    /* The first empty candidate of the ways that may be filled is filled,
+     * or else the oldest of them evicted */
+    struct cache_set *hit_cs = NULL;
+    struct cache_set *victim_cs = NULL;
+    line_t hit = NULL;
+    line_t victim = NULL;
+    for (unsigned long w = 0; w < cache->num_lines; w++) {
+        unsigned long set = skew_set(cache, block, w);
+        struct cache_set *cs = get_set(cache, set);
+        if (cs == NULL) {
+            return false;
+        }
+        line_t line = &cs->lines[w];
+        if (line->isValid && line->tag == block) {
+            hit = line;
+            hit_cs = cs;
+            outcome->set = set;
+            break;
+        }
+        if (!way_allowed(ways, w)) {
+            continue;
+        }
+        if (victim == NULL ||
+            (victim->isValid &&
+             (!line->isValid ||
+              line->cycles_since_use < victim->cycles_since_use))) {
+            victim = line;
+            victim_cs = cs;
+            outcome->set = set;
+        }
+    }
+
+    cache->clock += 1 + repeats;
+    outcome->hit = hit != NULL;
+    outcome->evicted = false;
+    outcome->dirty_evicted = false;
+    stats->hits += repeats;
+    if (hit != NULL) {
+        stats->hits++;
+    } else {
+        stats->misses++;
+        victim_cs->counts.misses++;
+        if (victim->isValid) {
+            stats->evictions++;
+            victim_cs->counts.evictions++;
+            outcome->evicted = true;
+            outcome->victim = victim->owner;
+            if (victim->isDirty) {
+                outcome->dirty_evicted = true;
+                stats->dirty_evictions++;
+                stats->dirty_bytes--;
+                victim->isDirty = false;
+            }
+        } else {
+            victim->isValid = true;
+            victim_cs->counts.valid++;
+        }
+        victim->tag = block;
+        victim->owner = owner;
+        hit = victim;
+        hit_cs = victim_cs;
+    }
+    hit_cs->counts.accesses += 1 + repeats;
+    hit->cycles_since_use = (long)cache->clock;
+
+    if ((op == 'S' || store) && !hit->isDirty) {
+        stats->dirty_bytes++;
+        hit->isDirty = true;
+    }
+    if (cache->verbose) {
+        printf("%s\n\n", outcome->hit       ? "Hit!"
+                         : outcome->evicted ? "Miss and eviction!"
+                                            : "Miss!");
+    }
+    return true;
+}
+
+/** @brief Returns the recency list and hash index of an indexed set */
+static struct set_index *index_header(const csim_cache_t *cache,
+                                      struct cache_set *cs) {
+    return (struct set_index *)&cs->lines[cache->num_lines];
+}
+
+/** @brief Returns the recency links of the lines of an indexed set */
+static struct way_link *set_links(const csim_cache_t *cache,
+                                  struct cache_set *cs) {
+    return (struct way_link *)(index_header(cache, cs) + 1);
+}
+
+/** @brief Returns the hash index of a set, whose slots hold line + 1 */
+static uint32_t *set_slots(const csim_cache_t *cache, struct cache_set *cs) {
+    return (uint32_t *)(set_links(cache, cs) + cache->num_lines);
+}
+
+static unsigned long tag_hash(const csim_cache_t *cache, unsigned long tag) {
+    unsigned long h = tag * 0x9e3779b97f4a7c15UL;
+    return (h ^ (h >> 32)) & (cache->index_slots - 1);
+}
+
+/** @brief Finds the slot of a tag in the hash index, or the empty slot */
+static unsigned long index_find(const csim_cache_t *cache,
+                                struct cache_set *cs, unsigned long tag) {
+    const uint32_t *slots = set_slots(cache, cs);
+    unsigned long h = tag_hash(cache, tag);
+    while (slots[h] != 0 && cs->lines[slots[h] - 1].tag != tag) {
+        h = (h + 1) & (cache->index_slots - 1);
+    }
+    return h;
+}
+
+/**
+ * @brief Removes a tag from the hash index, shifting back the entries
+ *        after it so that no probe sequence is broken.
+ */
+static void index_remove(const csim_cache_t *cache, struct cache_set *cs,
+                         unsigned long tag) {
+    uint32_t *slots = set_slots(cache, cs);
+    unsigned long mask = cache->index_slots - 1;
+    unsigned long hole = index_find(cache, cs, tag);
+    for (unsigned long h = (hole + 1) & mask; slots[h] != 0;
+         h = (h + 1) & mask) {
+        unsigned long home = tag_hash(cache, cs->lines[slots[h] - 1].tag);
+        /* Move the entry unless its home lies cyclically in (hole, h] */
+        if (((h - home) & mask) >= ((h - hole) & mask)) {
+            slots[hole] = slots[h];
+            hole = h;
+        }
+    }
+    slots[hole] = 0;
+}
+
+/** @brief Takes a line out of the recency list */
+static void recency_unlink(struct set_index *idx, struct way_link *links,
+                           uint32_t line) {
+    if (line == idx->mru) {
+        idx->mru = links[line].next;
+    } else {
+        links[links[line].prev].next = links[line].next;
+    }
+    if (line == idx->lru) {
+        idx->lru = links[line].prev;
+    } else {
+        links[links[line].next].prev = links[line].prev;
+    }
+}
+
+/** @brief Puts a line at the front of the recency list */
+static void recency_push(struct set_index *idx, struct way_link *links,
+                         uint32_t line, bool empty) {
+    if (empty) {
+        idx->lru = line;
+    } else {
+        links[line].next = idx->mru;
+        links[idx->mru].prev = line;
+    }
+    idx->mru = line;
+}
+
+/**
+ * @brief Simulates an access and its same-block repeats on an indexed set,
+ *        exactly as the scanning engine would.
+ */
+static void indexed_access(csim_cache_t *cache, struct cache_set *cs,
+                           unsigned long tag, char op, unsigned long repeats,
+                           bool store, unsigned owner,
+                           csim_outcome_t *outcome) {
+    csim_stats_t *stats = &cache->stats;
+    struct set_index *idx = index_header(cache, cs);
+    struct way_link *links = set_links(cache, cs);
+    uint32_t *slots = set_slots(cache, cs);
+    cs->counts.accesses += 1 + repeats;
+
+    outcome->hit = false;
+    outcome->evicted = false;
+    outcome->dirty_evicted = false;
+    stats->hits += repeats;
+
+    unsigned long slot = index_find(cache, cs, tag);
+    uint32_t line;
+    if (slots[slot] != 0) {
+        line = slots[slot] - 1;
+        outcome->hit = true;
+        stats->hits++;
+        if (line != idx->mru) {
+            recency_unlink(idx, links, line);
+            recency_push(idx, links, line, false);
+        }
+    } else {
+        stats->misses++;
+        cs->counts.misses++;
+        line = idx->lru;
+        if (idx->filled == cache->num_lines) {
+            stats->evictions++;
+            cs->counts.evictions++;
+            outcome->evicted = true;
+            outcome->victim = cs->lines[line].owner;
+            if (cs->lines[line].isDirty) {
+                outcome->dirty_evicted = true;
+                stats->dirty_evictions++;
+                stats->dirty_bytes--;
+                cs->lines[line].isDirty = false;
+            }
+            index_remove(cache, cs, cs->lines[line].tag);
+            if (line != idx->mru) {
+                recency_unlink(idx, links, line);
+                recency_push(idx, links, line, false);
+            }
+        } else {
+            line = idx->filled++;
+            recency_push(idx, links, line, line == 0);
+            cs->lines[line].isValid = true;
+            cs->counts.valid++;
+        }
+        cs->lines[line].tag = tag;
+        cs->lines[line].owner = owner;
+        slots[index_find(cache, cs, tag)] = line + 1;
+    }
+
+    if ((op == 'S' || store) && !cs->lines[line].isDirty) {
+        stats->dirty_bytes++;
+        cs->lines[line].isDirty = true;
+    }
+}
+
+/**
+ * @brief Simulates a run on a dense cache, exactly as cache_access_repeat()
+ *        would with verbose output off.
+ *
+ * The first access and its repeats are folded into one pass over the set:
+ * every other valid line ages by 1 + repeats, and the line left holding
+ * the block ends at age 0. It is always inlined, so that the fixed engines
+ * see s, E and b as constants.
+ */
+static inline __attribute__((always_inline)) void
+fixed_run(csim_cache_t *cache, const csim_run_t *run, unsigned long s,
+          unsigned long E, unsigned long b) {
+    size_t set_bytes = sizeof(struct cache_set) + E * sizeof(struct line);
+    unsigned long tag = run->addr >> (s + b);
+    unsigned long set = (run->addr >> b) & ((1UL << s) - 1);
+    struct cache_set *cs = (struct cache_set *)(cache->sets + set * set_bytes);
+    csim_stats_t *stats = &cache->stats;
+    long age = 1 + (long)run->repeats;
+    cs->counts.accesses += 1 + run->repeats;
+
+    struct line *hit = NULL;
+    unsigned long valid_count = 0;
+    unsigned long victim = 1;
+    long victim_cycles = -1;
+    /* Unrolled in full, E being a constant of each engine */
+#pragma GCC unroll 16
+    for (unsigned long l = 0; l < E; l++) {
+        struct line *line = &cs->lines[l];
+        if (line->tag == tag && line->isValid) {
+            hit = line;
+        } else if (line->isValid) {
+            /* Written to compile to conditional moves, since which line
+             * is oldest is as good as random */
+            long cycles = line->cycles_since_use;
+            bool older = hit == NULL && cycles > victim_cycles;
+            victim = older ? l : victim;
+            victim_cycles = older ? cycles : victim_cycles;
+            line->cycles_since_use = cycles + age;
+            valid_count++;
+        } else if (hit == NULL) {
+            victim = l;
+            victim_cycles = LONG_MAX;
+        }
+    }
+
+    stats->hits += run->repeats;
+    if (hit != NULL) {
+        stats->hits++;
+        hit->cycles_since_use = 0;
+    } else {
+        stats->misses++;
+        cs->counts.misses++;
+        hit = &cs->lines[victim];
+        if (valid_count == E) {
+            stats->evictions++;
+            cs->counts.evictions++;
+            if (hit->isDirty) {
+                stats->dirty_evictions++;
+                stats->dirty_bytes--;
+                hit->isDirty = false;
+            }
+            hit->cycles_since_use = 0;
+        } else {
+            hit->isValid = true;
+            cs->counts.valid++;
+        }
+        hit->tag = tag;
+        hit->owner = 0;
+    }
+
+    if ((run->op == 'S' || run->store) && !hit->isDirty) {
+        stats->dirty_bytes++;
+        hit->isDirty = true;
+    }
+}
+
+#define FIXED_ENGINE_NAME(s, E, b) FIXED_ENGINE_NAME_(s, E, b)
+#define FIXED_ENGINE_NAME_(s, E, b) fixed_engine_##s##_##E##_##b
+
+#define DEFINE_FIXED_ENGINE(s, E, b)                                           \
+    static void FIXED_ENGINE_NAME(s, E, b)(                                    \
+        csim_cache_t * cache, const csim_run_t runs[], size_t count) {         \
+        for (size_t i = 0; i < count; i++) {                                   \
+            fixed_run(cache, &runs[i], s, E, b);                               \
+        }                                                                      \
+    }
+
+FIXED_GEOMETRIES(DEFINE_FIXED_ENGINE)
+
+#define FIXED_ENGINE_ENTRY(s, E, b) {s, E, b, FIXED_ENGINE_NAME(s, E, b)},
+
+/** @brief The fixed engines, by geometry */
+static const struct {
+    unsigned long s, E, b;
+    fixed_engine_t *engine;
+} fixed_engines[] = {FIXED_GEOMETRIES(FIXED_ENGINE_ENTRY)};
+
+/**
+ * @brief Creates an empty cache. A partitioned cache always scans its
+ *        sets, since only the scan honors way masks.
+ */
+static csim_cache_t *cache_create(unsigned long s, unsigned long E,
+                                  unsigned long b, bool verbose,
+                                  csim_indexing_t indexing,
+                                  bool partitioned) {
+    if (indexing == CSIM_INDEXING_PRIME && s > 32) {
+        return NULL;
+    }
+    csim_cache_t *cache = calloc(1, sizeof(*cache));
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    unsigned long num_sets = 1UL << s;
+    if (indexing == CSIM_INDEXING_PRIME) {
+        num_sets = prev_prime(num_sets);
+    }
+    cache->num_sets = num_sets;
+    cache->num_lines = E;
+    cache->indexing = indexing;
+    cache->set_bits = s;
+
+    /* Both sizes are multiples of the alignment of a set */
+    cache->set_bytes = sizeof(struct cache_set) + E * sizeof(struct line);
+
+    cache->partitioned = partitioned;
+    cache->indexed = !verbose && !partitioned &&
+                     indexing != CSIM_INDEXING_SKEW &&
+                     E >= CSIM_INDEXED_WAYS && E < (1UL << 31);
+    if (cache->indexed) {
+        cache->index_slots = 1;
+        while (cache->index_slots < 2 * E) {
+            cache->index_slots *= 2;
+        }
+        cache->set_bytes += sizeof(struct set_index) +
+                            E * sizeof(struct way_link) +
+                            cache->index_slots * sizeof(uint32_t);
+        cache->set_bytes = (cache->set_bytes + sizeof(unsigned long) - 1) /
+                           sizeof(unsigned long) * sizeof(unsigned long);
+    }
+
+    cache->sparse = E > CSIM_SPARSE_LINES || num_sets > CSIM_SPARSE_LINES / E;
+    if (cache->sparse) {
+        cache->dir_slots = DIR_INITIAL_SLOTS;
+        cache->dir = calloc(cache->dir_slots, sizeof(dir_slot_t));
+    } else {
+        cache->sets = calloc(num_sets, cache->set_bytes);
+    }
+    if (cache->dir == NULL && cache->sets == NULL) {
+        free(cache);
+        return NULL;
+    }
+
+    cache->sb_sum = s + b;
+    cache->block_bits = b;
+    cache->set_mask = ~(0xFFFFFFFFFFFFFFFFUL << s);
+    if (cache->sb_sum == 0) {
+        cache->tag_mask = 0xFFFFFFFFFFFFFFFFUL;
+    } else {
+        cache->tag_mask = ~(0xFFFFFFFFFFFFFFFFUL << (64 - cache->sb_sum));
+    }
+    cache->verbose = verbose;
+
+    bool fixable = !cache->sparse && !partitioned &&
+                   indexing == CSIM_INDEXING_MODULO;
+    for (size_t i = 0;
+         fixable && i < sizeof(fixed_engines) / sizeof(fixed_engines[0]);
+         i++) {
+        if (fixed_engines[i].s == s && fixed_engines[i].E == E &&
+            fixed_engines[i].b == b) {
+            cache->engine = fixed_engines[i].engine;
+        }
+    }
+    return cache;
+}
+
+csim_cache_t *cache_new(unsigned long s, unsigned long E, unsigned long b,
+                        bool verbose) {
+    return cache_new_indexing(s, E, b, verbose, CSIM_INDEXING_MODULO);
+}
+
+csim_cache_t *cache_new_indexing(unsigned long s, unsigned long E,
+                                 unsigned long b, bool verbose,
+                                 csim_indexing_t indexing) {
+    csim_cache_t *cache = cache_create(s, E, b, verbose, indexing, false);
+    if (cache != NULL && verbose) {
+        printf("set_mask: %lu, tag_mask: %lu\n", cache->set_mask,
+               cache->tag_mask);
+        if (cache->sparse) {
+            printf("Allocating sets on first touch\n");
+        }
+    }
+    return cache;
+}
+
+csim_cache_t *cache_new_partitioned(unsigned long s, unsigned long E,
+                                    unsigned long b,
+                                    csim_indexing_t indexing) {
+    return cache_create(s, E, b, false, indexing, true);
+}
+
+bool cache_indexing_parse(const char *name, csim_indexing_t *indexing) {
+    for (size_t i = 0; i < sizeof(indexing_names) / sizeof(indexing_names[0]);
+         i++) {
+        if (strcmp(name, indexing_names[i]) == 0) {
+            *indexing = (csim_indexing_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *cache_indexing_name(csim_indexing_t indexing) {
+    return indexing_names[indexing];
+}
+
+bool cache_access(csim_cache_t *cache, unsigned long addr, char op) {
+    csim_outcome_t outcome;
+    return cache_access_masked(cache, addr, op, 0, CSIM_ALL_WAYS, &outcome);
+}
+
+bool cache_access_owned(csim_cache_t *cache, unsigned long addr, char op,
+                        unsigned owner, csim_outcome_t *outcome) {
+    return cache_access_masked(cache, addr, op, owner, CSIM_ALL_WAYS, outcome);
+}
+
+/**
+ * @brief Simulates an access and its repeats, as cache_access_repeat()
+ *        documents, on behalf of an owner and within a way mask.
+ *
+ * A scanned set takes the access and its repeats in one pass, as
+ * fixed_run() does: every other valid line ages by 1 + repeats, and the
+ * line left holding the block ends at age 0. Verbose output describes
+ * the first access.
+ */
+static bool access_run(csim_cache_t *cache, unsigned long addr, char op,
+                       unsigned long repeats, bool store, unsigned owner,
+                       unsigned long ways, csim_outcome_t *outcome) {
+    if (cache->indexing == CSIM_INDEXING_SKEW) {
+        return skew_access(cache, addr, op, repeats, store, owner, ways,
+                           outcome);
+    }
+
+    bool v_flag = cache->verbose;
+    csim_stats_t *stats = &cache->stats;
+    unsigned long num_lines = cache->num_lines;
+    unsigned long tag = tag_of(cache, addr);
+    unsigned long set = set_of(cache, addr);
+    if (v_flag) {
+        printf("Tag: %lu, Set: %lu\n\n", tag, set);
+    }
+    struct cache_set *cs = get_set(cache, set);
+    if (cs == NULL) {
+        return false;
+    }
+    outcome->set = set;
+    if (cache->indexed) {
+        indexed_access(cache, cs, tag, op, repeats, store, owner, outcome);
+        return true;
+    }
+    cs->counts.accesses += 1 + repeats;
+    long age = 1 + (long)repeats;
+
+    bool isHit = false;
+    unsigned long LRU = 1;
+    long LRU_cycles = -1;
+    if (v_flag) {
+        printf("Beginning check of set for instructed tag now\n");
+    }
+    for (unsigned long l = 0; l < num_lines; l++) {
+        if (v_flag) {
+            printf("Checking Line %lu: ", l);
+        }
+        line_t curLine = &cs->lines[l];
+
+        if (curLine->tag == tag && curLine->isValid) {
+            if (v_flag) {
+                printf("This line had the instructed tag!!\n");
+            }
+            isHit = true;
+            LRU = l; // LRU is overloaded to also hold the index of the
+                     // line where the HIT occured in the set
+        } else if (curLine->isValid) {
+            if (!isHit && curLine->cycles_since_use > LRU_cycles &&
+                way_allowed(ways, l)) {
+                if (v_flag) {
+                    printf("This is the new least recently used line!\n");
+                }
+                LRU = l;
+                LRU_cycles = curLine->cycles_since_use;
+            }
+
+            curLine->cycles_since_use += age;
+        } else if (!isHit && way_allowed(ways, l)) {
+            if (v_flag) {
+                printf("This line was unused!\n");
+            }
+            LRU = l; // LRU overloaded yet again to hold the index of
+                     // the line that is currently not used
+            LRU_cycles = LONG_MAX;
+        } else {
+            if (v_flag) {
+                printf("\n");
+            }
+        }
+    }
+
+    outcome->hit = isHit;
+    outcome->evicted = false;
+    outcome->dirty_evicted = false;
+    stats->hits += repeats;
+    if (isHit) {
+        stats->hits++;
+        if (v_flag) {
+            printf("Hit! With line #%lu\n\n\n", LRU);
+        }
+        line_t hit_line = &cs->lines[LRU];
+        hit_line->cycles_since_use = 0;
+
+    } else {
+        stats->misses++;
+        cs->counts.misses++;
+        if (LRU_cycles != LONG_MAX) {
+            stats->evictions++;
+            cs->counts.evictions++;
+
+            line_t evicted_line = &cs->lines[LRU];
+            outcome->evicted = true;
+            outcome->victim = evicted_line->owner;
+            if (v_flag) {
+                printf("Miss and eviction! Line #%lu was evicted and "
+                       "had tag %lu, but now has tag %lu\n\n\n",
+                       LRU, evicted_line->tag, tag);
+            }
+            if (evicted_line->isDirty) {
+                outcome->dirty_evicted = true;
+                stats->dirty_evictions++;
+                stats->dirty_bytes--;
+                evicted_line->isDirty = false;
+            }
+            evicted_line->tag = tag;
+            evicted_line->owner = owner;
+            evicted_line->cycles_since_use = 0;
+        } else {
+            if (v_flag) {
+                printf("Miss, no eviction! Inserting the address into "
+                       "line #%lu with tag %lu\n\n\n",
+                       LRU, tag);
+            }
+            line_t new_line = &cs->lines[LRU];
+            new_line->isValid = true;
+            new_line->tag = tag;
+            new_line->owner = owner;
+            cs->counts.valid++;
+        }
+    }
+
+    if (op == 'S' || store) {
+        line_t cur_line = &cs->lines[LRU];
+        if (!cur_line->isDirty) {
+            stats->dirty_bytes++;
+        }
+        cur_line->isDirty = true;
+    }
+    return true;
+}
+
+bool cache_access_masked(csim_cache_t *cache, unsigned long addr, char op,
+                         unsigned owner, unsigned long ways,
+                         csim_outcome_t *outcome) {
+    return access_run(cache, addr, op, 0, false, owner, ways, outcome);
+}
+
+bool cache_access_repeat(csim_cache_t *cache, unsigned long addr, char op,
+                         unsigned long repeats, bool store) {
+    csim_outcome_t outcome;
+    return access_run(cache, addr, op, repeats, store, 0, CSIM_ALL_WAYS,
+                      &outcome);
+}
+
+/** @brief Prefetches the leading lines of a set into the host cache */
+static void prefetch_set(const csim_cache_t *cache,
+                         const struct cache_set *cs) {
+    size_t bytes = cache->set_bytes < PREFETCH_SET_BYTES ? cache->set_bytes
+                                                         : PREFETCH_SET_BYTES;
+    for (size_t off = 0; off < bytes; off += 64) {
+        __builtin_prefetch((const char *)cs + off, 1);
+    }
+}
+
+/** @brief Prefetches the directory slots of the runs of a group */
+static void prefetch_slots(const csim_cache_t *cache, const csim_run_t runs[],
+                           size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        __builtin_prefetch(
+            &cache->dir[dir_hash(cache, set_of(cache, runs[i].addr))]);
+    }
+}
+
+bool cache_access_batch(csim_cache_t *cache, const csim_run_t runs[],
+                        size_t count) {
+    /* The directory slots of sparse sets are prefetched a group ahead, so
+     * that resolving a group's sets finds its slots already loaded */
+    if (cache->sparse) {
+        prefetch_slots(cache, runs, count < BATCH_GROUP ? count : BATCH_GROUP);
+    }
+    for (size_t first = 0; first < count; first += BATCH_GROUP) {
+        size_t n = count - first < BATCH_GROUP ? count - first : BATCH_GROUP;
+        const csim_run_t *group = &runs[first];
+        unsigned long sets[BATCH_GROUP];
+        for (size_t i = 0; i < n; i++) {
+            sets[i] = set_of(cache, group[i].addr);
+        }
+
+        if (!cache->sparse) {
+            for (size_t i = 0; i < n; i++) {
+                prefetch_set(cache, dense_set(cache, sets[i]));
+            }
+        } else {
+            size_t left = count - first - n;
+            prefetch_slots(cache, group + n,
+                           left < BATCH_GROUP ? left : BATCH_GROUP);
+            for (size_t i = 0; i < n; i++) {
+                const struct cache_set *cs = dir_find(cache, sets[i])->cs;
+                if (cs != NULL) {
+                    prefetch_set(cache, cs);
+                }
+            }
+        }
+
+        if (cache->engine != NULL) {
+            cache->engine(cache, group, n);
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (!cache_access_repeat(cache, group[i].addr, group[i].op,
+                                     group[i].repeats, group[i].store)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void cache_stats(const csim_cache_t *cache, csim_stats_t *stats) {
+    unsigned long multiplier = 1UL << cache->block_bits;
+    *stats = cache->stats;
+    stats->dirty_bytes = (stats->dirty_bytes * multiplier);
+    stats->dirty_evictions = (stats->dirty_evictions * multiplier);
+}
+
+unsigned long cache_num_sets(const csim_cache_t *cache) {
+    return cache->num_sets;
+}
+
+bool cache_is_sparse(const csim_cache_t *cache) {
+    return cache->sparse;
+}
+
+bool cache_is_fixed(const csim_cache_t *cache) {
+    return cache->engine != NULL;
+}
+
+void cache_set_stats(const csim_cache_t *cache, unsigned long set,
+                     csim_set_stats_t *stats) {
+    const struct cache_set *cs;
+    if (cache->sparse) {
+        cs = dir_find(cache, set)->cs;
+    } else {
+        cs = dense_set(cache, set);
+    }
+    if (cs != NULL) {
+        *stats = cs->counts;
+    } else {
+        *stats = (csim_set_stats_t){0};
+    }
+}
+
+unsigned long cache_each_set(const csim_cache_t *cache,
+                             void (*visit)(void *arg, unsigned long set,
+                                           const csim_set_stats_t *stats),
+                             void *arg) {
+    if (!cache->sparse) {
+        for (unsigned long set = 0; set < cache->num_sets; set++) {
+            visit(arg, set, &dense_set(cache, set)->counts);
+        }
+        return cache->num_sets;
+    }
+    for (unsigned long i = 0; i < cache->dir_slots; i++) {
+        if (cache->dir[i].cs != NULL) {
+            visit(arg, cache->dir[i].set, &cache->dir[i].cs->counts);
+        }
+    }
+    return cache->dir_used;
+}
+
+csim_cache_t *cache_clone(const csim_cache_t *cache) {
+    /* Verbose caches scan sets that would otherwise be indexed, so the
+     * copy takes the flag to get the same set layout */
+    csim_cache_t *copy =
+        cache_create(cache->set_bits, cache->num_lines, cache->block_bits,
+                     cache->verbose, cache->indexing, cache->partitioned);
+    if (copy == NULL) {
+        return NULL;
+    }
+    copy->clock = cache->clock;
+    copy->stats = cache->stats;
+    if (!cache->sparse) {
+        memcpy(copy->sets, cache->sets, cache->num_sets * cache->set_bytes);
+        return copy;
+    }
+    for (unsigned long i = 0; i < cache->dir_slots; i++) {
+        if (cache->dir[i].cs == NULL) {
+            continue;
+        }
+        struct cache_set *cs = get_set(copy, cache->dir[i].set);
+        if (cs == NULL) {
+            cache_free(copy);
+            return NULL;
+        }
+        memcpy(cs, cache->dir[i].cs, cache->set_bytes);
+    }
+    return copy;
+}
+
+/** @brief Returns a set if it has been touched, or NULL */
+static const struct cache_set *find_set(const csim_cache_t *cache,
+                                        unsigned long set) {
+    if (!cache->sparse) {
+        return dense_set(cache, set);
+    }
+    return dir_find(cache, set)->cs;
+}
+
+/**
+ * @brief True if two sets hold the same blocks, equally dirty and in the
+ *        same recency order; a NULL set has no valid lines.
+ *
+ * Lines of a scanned set age by one on every access to the set that does
+ * not use them, so a line has the same age in both caches exactly when it
+ * was last used by the same access. Skewed lines record the access that
+ * last used them, which both caches count from a different start, so
+ * their distances from the clock are compared instead.
+ */
+static bool same_set(const csim_cache_t *a, const struct cache_set *x,
+                     const csim_cache_t *b, const struct cache_set *y) {
+    unsigned long x_valid = x != NULL ? x->counts.valid : 0;
+    unsigned long y_valid = y != NULL ? y->counts.valid : 0;
+    if (x_valid != y_valid) {
+        return false;
+    }
+    if (x_valid == 0) {
+        return true;
+    }
+
+    if (a->indexing == CSIM_INDEXING_SKEW) {
+        for (unsigned long w = 0; w < a->num_lines; w++) {
+            const struct line *p = &x->lines[w];
+            const struct line *q = &y->lines[w];
+            if (p->isValid != q->isValid ||
+                (p->isValid &&
+                 (p->tag != q->tag || p->isDirty != q->isDirty ||
+                  a->clock - (unsigned long)p->cycles_since_use !=
+                      b->clock - (unsigned long)q->cycles_since_use))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (a->indexed) {
+        struct cache_set *xs = (struct cache_set *)x;
+        struct cache_set *ys = (struct cache_set *)y;
+        const struct way_link *x_links = set_links(a, xs);
+        const struct way_link *y_links = set_links(b, ys);
+        uint32_t p = index_header(a, xs)->mru;
+        uint32_t q = index_header(b, ys)->mru;
+        for (unsigned long n = 0; n < x_valid; n++) {
+            if (xs->lines[p].tag != ys->lines[q].tag ||
+                xs->lines[p].isDirty != ys->lines[q].isDirty) {
+                return false;
+            }
+            p = x_links[p].next;
+            q = y_links[q].next;
+        }
+        return true;
+    }
+
+    /* Scanned sets are small, and the same block may sit in any way */
+    for (unsigned long l = 0; l < a->num_lines; l++) {
+        const struct line *p = &x->lines[l];
+        if (!p->isValid) {
+            continue;
+        }
+        bool found = false;
+        for (unsigned long m = 0; m < b->num_lines && !found; m++) {
+            const struct line *q = &y->lines[m];
+            found = q->isValid && q->tag == p->tag &&
+                    q->isDirty == p->isDirty &&
+                    q->cycles_since_use == p->cycles_since_use;
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool cache_same_state(const csim_cache_t *a, const csim_cache_t *b) {
+    if (a->set_bits != b->set_bits || a->num_lines != b->num_lines ||
+        a->block_bits != b->block_bits || a->indexing != b->indexing ||
+        a->indexed != b->indexed) {
+        return false;
+    }
+    if (!a->sparse) {
+        for (unsigned long set = 0; set < a->num_sets; set++) {
+            if (!same_set(a, dense_set(a, set), b, dense_set(b, set))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Each cache may have touched sets the other has not */
+    for (unsigned long i = 0; i < a->dir_slots; i++) {
+        if (a->dir[i].cs != NULL &&
+            !same_set(a, a->dir[i].cs, b, find_set(b, a->dir[i].set))) {
+            return false;
+        }
+    }
+    for (unsigned long i = 0; i < b->dir_slots; i++) {
+        if (b->dir[i].cs != NULL && find_set(a, b->dir[i].set) == NULL &&
+            b->dir[i].cs->counts.valid != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void cache_free(csim_cache_t *cache) {
+    while (cache->slabs != NULL) {
+        struct slab *next = cache->slabs->next;
+        free(cache->slabs);
+        cache->slabs = next;
+    }
+    free(cache->dir);
+    free(cache->sets);
+    free(cache);
+}
@@ -0,0 +1,278 @@
+/**
+ * @file csim-cache.h
+ * @brief Embeddable cache simulator engine
+ *
+ * The engine models one set-associative, write-back cache with LRU
+ * replacement. csim drives it from trace files, and other tools can feed
+ * it accesses directly.
+ */
+
+#ifndef CSIM_CACHE_H
+#define CSIM_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cachelab.h"
+
+/**
+ * @brief Caches with more lines than this allocate each set on first touch.
+ *
+ * Above it, memory grows with the sets a trace touches rather than with
+ * the configured capacity, for a directory lookup on every access.
+ */
+#define CSIM_SPARSE_LINES (1UL << 20)
+
+/**
+ * @brief Sets with at least this many lines find tags through a hash index.
+ *
+ * Such sets also keep their lines in a recency list, so that an access
+ * costs the same at any associativity, rather than a scan of every line.
+ * Verbose caches always scan, since their output narrates the scan.
+ */
+#define CSIM_INDEXED_WAYS 32
+
+/**
+ * @brief Number of ways a way mask can name; ways past these can always be
+ *        filled.
+ */
+#define CSIM_MASK_WAYS 64
+
+/** @brief Way mask that lets a miss fill any line of its set */
+#define CSIM_ALL_WAYS (~0UL)
+
+/** @brief Opaque handle for a simulated cache */
+typedef struct csim_cache csim_cache_t;
+
+/**
+ * @brief Creates an empty cache.
+ *
+ * @param[in] s        Number of set index bits (there are 2**s sets)
+ * @param[in] E        Number of lines per set
+ * @param[in] b        Number of block bits (blocks are 2**b bytes)
+ * @param[in] verbose  Report the effect of every access on stdout
+ *
+ * @return The cache, or NULL if it could not be allocated
+ */
+csim_cache_t *cache_new(unsigned long s, unsigned long E, unsigned long b,
+                        bool verbose);
+
+/** @brief How an address picks the set (or sets) that may hold its block */
+typedef enum {
+    CSIM_INDEXING_MODULO, /* the s bits above the block offset */
+    CSIM_INDEXING_XOR,    /* those bits XORed with every higher s bits */
+    CSIM_INDEXING_PRIME,  /* the block number modulo the largest prime
+                             number of sets <= 2**s, for s <= 32 */
+    CSIM_INDEXING_SKEW,   /* a different hash of the block for each way,
+                             with LRU among the E candidate lines */
+} csim_indexing_t;
+
+/**
+ * @brief Creates an empty cache that indexes its sets with a given
+ *        function; cache_new() uses CSIM_INDEXING_MODULO.
+ *
+ * @return The cache, or NULL if it could not be allocated or the indexing
+ *         does not support the geometry
+ */
+csim_cache_t *cache_new_indexing(unsigned long s, unsigned long E,
+                                 unsigned long b, bool verbose,
+                                 csim_indexing_t indexing);
+
+/**
+ * @brief Creates an empty cache whose accesses can be confined to some of
+ *        the ways of each set with cache_access_masked().
+ *
+ * Such a cache never uses indexed sets or an engine compiled for its
+ * geometry, so it is slower at high associativity.
+ *
+ * @return The cache, or NULL if it could not be allocated or the indexing
+ *         does not support the geometry
+ */
+csim_cache_t *cache_new_partitioned(unsigned long s, unsigned long E,
+                                    unsigned long b,
+                                    csim_indexing_t indexing);
+
+/**
+ * @brief Looks up an indexing function by name ("mod", "xor", "prime" or
+ *        "skew").
+ *
+ * @return False if the name is unknown
+ */
+bool cache_indexing_parse(const char *name, csim_indexing_t *indexing);
+
+/** @brief Returns the name of an indexing function */
+const char *cache_indexing_name(csim_indexing_t indexing);
+
+/** @brief An access followed by repeated accesses to the same block */
+typedef struct {
+    unsigned long addr;    /* address of the first access */
+    unsigned long repeats; /* further accesses to the same block */
+    char op;               /* 'L' or 'S', for the first access */
+    bool store;            /* one of the repeats is a store */
+} csim_run_t;
+
+/**
+ * @brief Simulates a batch of runs, in order.
+ *
+ * This is identical to calling cache_access_repeat() on each run, but
+ * runs are resolved in groups: the sets of a whole group are located and
+ * prefetched first, so that host cache misses on the metadata of large
+ * caches overlap instead of stalling each access in turn.
+ *
+ * @return As for cache_access(); the runs after the failed one are not
+ *         simulated either
+ */
+bool cache_access_batch(csim_cache_t *cache, const csim_run_t runs[],
+                        size_t count);
+
+/**
+ * @brief Effect of one access, for callers that attribute accesses.
+ */
+typedef struct {
+    bool hit;           /* the block was cached */
+    bool evicted;       /* a miss evicted a valid line */
+    bool dirty_evicted; /* the evicted line was dirty */
+    unsigned victim;    /* owner of the evicted line */
+    unsigned long set;  /* set of the line now holding the block */
+} csim_outcome_t;
+
+/**
+ * @brief Simulates one access.
+ *
+ * @param[in] addr  Address of the access
+ * @param[in] op    'L' for a load, 'S' for a store
+ *
+ * @return false if the set of the access could not be allocated, which
+ *         only happens in sparse caches; the access is then not simulated
+ *         and the cache is left as it was
+ */
+bool cache_access(csim_cache_t *cache, unsigned long addr, char op);
+
+/**
+ * @brief Simulates an access followed by repeated accesses to its block.
+ *
+ * The repeats are hits that leave the set as `repeats` separate accesses
+ * would, at the cost of one pass over the set. This is identical to
+ * calling cache_access() for the first access and then for each repeat.
+ *
+ * @param[in] addr     Address of the first access
+ * @param[in] op       'L' or 'S', for the first access
+ * @param[in] repeats  Number of further accesses to the same block
+ * @param[in] store    Whether any of the repeats is a store
+ *
+ * @return As for cache_access()
+ */
+bool cache_access_repeat(csim_cache_t *cache, unsigned long addr, char op,
+                         unsigned long repeats, bool store);
+
+/**
+ * @brief Simulates one access on behalf of an owner, and reports its effect.
+ *
+ * A line belongs to the owner of the access that brought it into the
+ * cache, which is reported when the line is evicted. Lines filled by
+ * cache_access() belong to owner 0.
+ *
+ * @param[in]  addr     Address of the access
+ * @param[in]  op       'L' for a load, 'S' for a store
+ * @param[in]  owner    Owner of the access, such as a memory region
+ * @param[out] outcome  Effect of the access
+ *
+ * @return As for cache_access()
+ */
+bool cache_access_owned(csim_cache_t *cache, unsigned long addr, char op,
+                        unsigned owner, csim_outcome_t *outcome);
+
+/**
+ * @brief Simulates one access on behalf of an owner that may only fill
+ *        some ways, like a class of service under way partitioning.
+ *
+ * The access hits wherever its block is cached, but a miss only fills or
+ * evicts lines whose way is in the mask: the least recently used of those
+ * is evicted once they are all valid, even while other ways are empty.
+ * Under skewed indexing, way w is the candidate line picked by the hash of
+ * way w.
+ *
+ * @param[in]  ways  Bit w allows way w, for w < CSIM_MASK_WAYS; it must
+ *                   allow at least one way of the set, and unless it is
+ *                   CSIM_ALL_WAYS the cache must be from
+ *                   cache_new_partitioned()
+ *
+ * @return As for cache_access()
+ */
+bool cache_access_masked(csim_cache_t *cache, unsigned long addr, char op,
+                         unsigned owner, unsigned long ways,
+                         csim_outcome_t *outcome);
+
+/**
+ * @brief Reports the statistics of all accesses so far.
+ *
+ * Dirty lines are reported in bytes, as expected by printSummary().
+ */
+void cache_stats(const csim_cache_t *cache, csim_stats_t *stats);
+
+/**
+ * @brief Counters of one cache set.
+ *
+ * These are kept by every cache, at the cost of one increment per access
+ * and two per miss. Under skewed indexing, an access counts against the
+ * set of the line it hits or fills.
+ */
+typedef struct {
+    unsigned long accesses;  /* accesses that mapped to the set */
+    unsigned long valid;     /* lines currently valid */
+    unsigned long misses;    /* misses that mapped to the set */
+    unsigned long evictions; /* lines evicted from the set */
+} csim_set_stats_t;
+
+/** @brief Returns the number of sets of a cache */
+unsigned long cache_num_sets(const csim_cache_t *cache);
+
+/** @brief True if the sets of a cache are allocated on first touch */
+bool cache_is_sparse(const csim_cache_t *cache);
+
+/**
+ * @brief True if batches are simulated by an engine compiled for the
+ *        geometry of the cache
+ */
+bool cache_is_fixed(const csim_cache_t *cache);
+
+/** @brief Reports the counters of one set, all zero if never touched */
+void cache_set_stats(const csim_cache_t *cache, unsigned long set,
+                     csim_set_stats_t *stats);
+
+/**
+ * @brief Calls visit for each set that has been touched, in no particular
+ *        order.
+ *
+ * Every set of a dense cache is visited; a sparse cache only visits the
+ * sets it has allocated, which is much cheaper than asking for each of its
+ * sets in turn. Sets that are not visited have all-zero counters.
+ *
+ * @return The number of sets visited
+ */
+unsigned long cache_each_set(const csim_cache_t *cache,
+                             void (*visit)(void *arg, unsigned long set,
+                                           const csim_set_stats_t *stats),
+                             void *arg);
+
+/**
+ * @brief Copies a cache: its lines, its statistics and its set counters.
+ *
+ * @return The copy, or NULL if it could not be allocated
+ */
+csim_cache_t *cache_clone(const csim_cache_t *cache);
+
+/**
+ * @brief True if two caches of the same geometry and indexing are in the
+ *        same state, so that any further accesses would affect both alike.
+ *
+ * Every set must hold the same blocks, with the same dirty bits and in the
+ * same recency order, in whichever lines of the set. Statistics and set
+ * counters are not compared.
+ */
+bool cache_same_state(const csim_cache_t *a, const csim_cache_t *b);
+
+/** @brief Frees a cache */
+void cache_free(csim_cache_t *cache);
+
+#endif /* CSIM_CACHE_H */
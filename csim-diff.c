@@ -0,0 +1,479 @@
+/**
+ * @file csim-diff.c
+ * @brief Access-by-access comparison of two runs' outcome streams
+ *
+ * Both streams are mapped, and the traces, when given, are decoded into
+ * memory without their markers, so that access i of a trace is record i
+ * of its stream. Alignment by address keys every access of each trace by
+ * its region and offset and sorts the keys, with the access number as
+ * the last key; walking both sorted lists together then pairs the k-th
+ * access to each address in one trace with the k-th in the other.
+ *
+ * Every divergence is counted in the totals, its part of the trace and
+ * its region as it is found. Its set is appended to a list, which is
+ * sorted at the end to count the divergences of each set.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "csim-diff.h"
+#include "csim-outcome.h"
+#include "csim-region.h"
+#include "csim-trace.h"
+
+/** @brief Ways two outcomes of an access can differ */
+enum {
+    ONLY_A_MISSED,       /* the first run missed, the second hit */
+    ONLY_B_MISSED,       /* the first run hit, the second missed */
+    EVICTED_DIFFERENTLY, /* both missed, evicting a clean, dirty or no
+                            line differently */
+    DIVERGENCE_KINDS
+};
+
+/** @brief Record bits that make up an outcome */
+#define OUTCOME_BITS (OUTCOME_HIT | OUTCOME_EVICTED | OUTCOME_DIRTY)
+
+/** @brief Divergences of some of the accesses */
+typedef struct {
+    unsigned long divergent;
+    unsigned long kinds[DIVERGENCE_KINDS];
+} diff_count_t;
+
+/** @brief Divergences in one set */
+typedef struct {
+    unsigned long set;
+    diff_count_t count;
+} set_count_t;
+
+/** @brief An access keyed for alignment by address */
+typedef struct {
+    unsigned region;      /* region, numbered as in the first run's map */
+    unsigned long offset; /* address relative to the region */
+    size_t index;         /* access number in its trace */
+} keyed_access_t;
+
+typedef struct {
+    const char *paths[2];
+    csim_outcome_map_t runs[2];
+    csim_access_t *accesses[2]; /* accesses of each trace, or NULL */
+    size_t counts[2];           /* number of accesses of each trace */
+    csim_regions_t *regions[2]; /* region map of each trace, or NULL */
+
+    unsigned long aligned;
+    unsigned long unmatched[2];
+    diff_count_t total;
+    diff_count_t windows[DIFF_WINDOWS];
+    diff_count_t *by_region; /* by region of the first run's map */
+    bool any;
+    size_t first[2]; /* earliest divergence in the first run */
+
+    /* Set of each divergence in the first run, shifted left by 2 and
+     * holding its kind in the low bits */
+    uint64_t *sets;
+    size_t num_sets;
+    size_t sets_capacity;
+    bool oom;
+} diff_t;
+
+/**
+ * @brief Decodes a trace into memory, leaving out its markers.
+ *
+ * @return False (after printing an error) on failure
+ */
+static bool load_accesses(const char *path, const char *cache_dir,
+                          csim_access_t **accesses, size_t *count) {
+    size_t records;
+    size_t bytes;
+    if (!trace_load(path, cache_dir, accesses, &records, &bytes)) {
+        fprintf(stderr, "Error: cannot decode '%s'\n", path);
+        return false;
+    }
+    size_t kept = 0;
+    for (size_t i = 0; i < records; i++) {
+        if ((*accesses)[i].op != CSIM_OP_MARKER) {
+            (*accesses)[kept++] = (*accesses)[i];
+        }
+    }
+    *count = kept;
+    return true;
+}
+
+/** @brief Counts a divergence of some kind */
+static void count_add(diff_count_t *count, unsigned kind) {
+    count->divergent++;
+    count->kinds[kind]++;
+}
+
+/** @brief Compares access ia of the first run with access ib of the other */
+static void diff_pair(diff_t *d, size_t ia, size_t ib) {
+    uint32_t a = d->runs[0].records[ia];
+    uint32_t b = d->runs[1].records[ib];
+    d->aligned++;
+    if (((a ^ b) & OUTCOME_BITS) == 0) {
+        return;
+    }
+
+    unsigned kind = EVICTED_DIFFERENTLY;
+    if (((a ^ b) & OUTCOME_HIT) != 0) {
+        kind = (a & OUTCOME_HIT) != 0 ? ONLY_B_MISSED : ONLY_A_MISSED;
+    }
+    if (!d->any || ia < d->first[0]) {
+        d->any = true;
+        d->first[0] = ia;
+        d->first[1] = ib;
+    }
+    count_add(&d->total, kind);
+    count_add(&d->windows[ia * DIFF_WINDOWS / d->runs[0].header->count],
+              kind);
+    if (d->regions[0] != NULL) {
+        unsigned region =
+            regions_lookup(d->regions[0], d->accesses[0][ia].addr);
+        count_add(&d->by_region[region], kind);
+    }
+
+    if (d->num_sets == d->sets_capacity) {
+        size_t grown = d->sets_capacity == 0 ? 4096 : 2 * d->sets_capacity;
+        uint64_t *larger = realloc(d->sets, grown * sizeof(uint64_t));
+        if (larger == NULL) {
+            d->oom = true;
+            return;
+        }
+        d->sets = larger;
+        d->sets_capacity = grown;
+    }
+    d->sets[d->num_sets++] = (uint64_t)(a >> OUTCOME_SET_SHIFT) << 2 | kind;
+}
+
+static int compare_keyed(const void *a, const void *b) {
+    const keyed_access_t *ka = a;
+    const keyed_access_t *kb = b;
+    if (ka->region != kb->region) {
+        return ka->region < kb->region ? -1 : 1;
+    }
+    if (ka->offset != kb->offset) {
+        return ka->offset < kb->offset ? -1 : 1;
+    }
+    if (ka->index != kb->index) {
+        return ka->index < kb->index ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Keys the accesses of a run by region and offset, numbering the
+ *        regions of its map as the first run's map does.
+ *
+ * @return The sorted keys, or NULL if they do not fit in memory
+ */
+static keyed_access_t *key_accesses(diff_t *d, unsigned run) {
+    csim_regions_t *own = d->regions[run];
+    unsigned *number = NULL;
+    if (own != NULL) {
+        /* Regions without a namesake get numbers no region of the first
+         * map has */
+        unsigned first_count = regions_count(d->regions[0]);
+        number = malloc(regions_count(own) * sizeof(unsigned));
+        if (number == NULL) {
+            return NULL;
+        }
+        for (unsigned j = 0; j < regions_count(own); j++) {
+            number[j] = first_count + j;
+            for (unsigned i = 0; i < first_count; i++) {
+                if (strcmp(regions_name(own, j),
+                           regions_name(d->regions[0], i)) == 0) {
+                    number[j] = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    size_t count = d->counts[run];
+    keyed_access_t *keys = malloc((count > 0 ? count : 1) *
+                                  sizeof(keyed_access_t));
+    if (keys == NULL) {
+        free(number);
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        unsigned long addr = d->accesses[run][i].addr;
+        keys[i].region = 0;
+        keys[i].offset = addr;
+        keys[i].index = i;
+        if (own != NULL) {
+            unsigned region = regions_lookup(own, addr);
+            keys[i].region = number[region];
+            keys[i].offset = addr - regions_start(own, region);
+        }
+    }
+    free(number);
+    qsort(keys, count, sizeof(keyed_access_t), compare_keyed);
+    return keys;
+}
+
+/**
+ * @brief Pairs the accesses of the two traces by address.
+ *
+ * @return False if the keys do not fit in memory
+ */
+static bool align_by_address(diff_t *d) {
+    keyed_access_t *a = key_accesses(d, 0);
+    keyed_access_t *b = key_accesses(d, 1);
+    if (a == NULL || b == NULL) {
+        free(a);
+        free(b);
+        return false;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < d->counts[0] && j < d->counts[1]) {
+        keyed_access_t ka = a[i];
+        keyed_access_t kb = b[j];
+        ka.index = kb.index = 0;
+        int cmp = compare_keyed(&ka, &kb);
+        if (cmp < 0) {
+            d->unmatched[0]++;
+            i++;
+        } else if (cmp > 0) {
+            d->unmatched[1]++;
+            j++;
+        } else {
+            diff_pair(d, a[i++].index, b[j++].index);
+        }
+    }
+    d->unmatched[0] += d->counts[0] - i;
+    d->unmatched[1] += d->counts[1] - j;
+    free(a);
+    free(b);
+    return true;
+}
+
+static int compare_sets(const void *a, const void *b) {
+    const set_count_t *sa = a;
+    const set_count_t *sb = b;
+    if (sa->count.divergent != sb->count.divergent) {
+        return sa->count.divergent > sb->count.divergent ? -1 : 1;
+    }
+    if (sa->set != sb->set) {
+        return sa->set < sb->set ? -1 : 1;
+    }
+    return 0;
+}
+
+static int compare_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+/** @brief Prints the header of a table of divergences */
+static void print_header(FILE *out, int width, const char *label) {
+    fprintf(out, "%-*s %12s %14s %14s %14s\n", width, label, "Divergent",
+            "Only A missed", "Only B missed", "Other eviction");
+}
+
+/** @brief Prints the counts of a row of a table of divergences */
+static void print_counts(FILE *out, const diff_count_t *count) {
+    fprintf(out, " %12lu %14lu %14lu %14lu\n", count->divergent,
+            count->kinds[ONLY_A_MISSED], count->kinds[ONLY_B_MISSED],
+            count->kinds[EVICTED_DIFFERENTLY]);
+}
+
+/** @brief Prints the divergences of the sets with the most of them */
+static bool print_sets(const diff_t *d, FILE *out) {
+    qsort(d->sets, d->num_sets, sizeof(uint64_t), compare_u64);
+    set_count_t *sets = malloc(d->num_sets * sizeof(set_count_t));
+    if (sets == NULL) {
+        return false;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < d->num_sets; i++) {
+        unsigned long set = (unsigned long)(d->sets[i] >> 2);
+        if (n == 0 || sets[n - 1].set != set) {
+            sets[n++] = (set_count_t){.set = set};
+        }
+        count_add(&sets[n - 1].count, (unsigned)(d->sets[i] & 3));
+    }
+    qsort(sets, n, sizeof(set_count_t), compare_sets);
+
+    fprintf(out, "\nDivergent accesses by set of A (top %zu of %zu sets):\n",
+            n < DIFF_TOP_SETS ? n : DIFF_TOP_SETS, n);
+    print_header(out, 10, "Set");
+    for (size_t i = 0; i < n && i < DIFF_TOP_SETS; i++) {
+        fprintf(out, "%-10lu", sets[i].set);
+        print_counts(out, &sets[i].count);
+    }
+    free(sets);
+    return true;
+}
+
+/** @brief Prints the report of a comparison */
+static bool diff_print(diff_t *d, bool by_address, FILE *out) {
+    for (unsigned r = 0; r < 2; r++) {
+        const outcome_file_header_t *h = d->runs[r].header;
+        fprintf(out, "Run %c: %s, s=%u E=%u b=%u %s, %llu accesses\n",
+                'A' + r, d->paths[r], h->s, h->E, h->b,
+                cache_indexing_name((csim_indexing_t)h->indexing),
+                (unsigned long long)h->count);
+    }
+    if (by_address) {
+        fprintf(out,
+                "Aligned by address: %lu accesses, %lu of A and %lu of B "
+                "unmatched\n",
+                d->aligned, d->unmatched[0], d->unmatched[1]);
+    } else {
+        fprintf(out, "Aligned by access number: %lu accesses\n",
+                d->aligned);
+    }
+    if (!d->any) {
+        fprintf(out, "Divergent: none\n");
+        return true;
+    }
+
+    double percent = 100.0 * (double)d->total.divergent / (double)d->aligned;
+    fprintf(out,
+            "Divergent: %lu (%.3f%%), %lu missed only in A, %lu missed only "
+            "in B, %lu evicted differently\n",
+            d->total.divergent, percent, d->total.kinds[ONLY_A_MISSED],
+            d->total.kinds[ONLY_B_MISSED],
+            d->total.kinds[EVICTED_DIFFERENTLY]);
+    fprintf(out, "First divergence: access #%zu of A, #%zu of B\n",
+            d->first[0] + 1, d->first[1] + 1);
+
+    if (!print_sets(d, out)) {
+        return false;
+    }
+
+    if (d->regions[0] != NULL) {
+        unsigned n = regions_count(d->regions[0]);
+        int width = (int)strlen("Region");
+        for (unsigned i = 0; i < n; i++) {
+            int len = (int)strlen(regions_name(d->regions[0], i));
+            width = len > width ? len : width;
+        }
+        fprintf(out, "\nDivergent accesses by region of A:\n");
+        print_header(out, width, "Region");
+        for (unsigned i = 0; i < n; i++) {
+            fprintf(out, "%-*s", width, regions_name(d->regions[0], i));
+            print_counts(out, &d->by_region[i]);
+        }
+    }
+
+    uint64_t count = d->runs[0].header->count;
+    fprintf(out, "\nDivergent accesses by position in A:\n");
+    print_header(out, 25, "Accesses");
+    for (uint64_t w = 0; w < DIFF_WINDOWS; w++) {
+        /* Window w holds the accesses i with i * DIFF_WINDOWS / count == w */
+        uint64_t from = (w * count + DIFF_WINDOWS - 1) / DIFF_WINDOWS;
+        uint64_t to = ((w + 1) * count + DIFF_WINDOWS - 1) / DIFF_WINDOWS;
+        if (from == to) {
+            continue;
+        }
+        fprintf(out, "%10llu - %-12llu", (unsigned long long)from + 1,
+                (unsigned long long)to);
+        print_counts(out, &d->windows[w]);
+    }
+    return true;
+}
+
+/**
+ * @brief Loads the traces and maps of a comparison and checks that they
+ *        match the streams.
+ *
+ * @return False (after printing an error) on failure
+ */
+static bool diff_load(diff_t *d, const char *const traces[],
+                      unsigned num_traces, const char *const maps[],
+                      unsigned num_maps, const char *cache_dir) {
+    for (unsigned r = 0; r < num_traces; r++) {
+        if (!load_accesses(traces[r], cache_dir, &d->accesses[r],
+                           &d->counts[r])) {
+            return false;
+        }
+        uint64_t records = d->runs[num_traces == 1 ? 0 : r].header->count;
+        if (d->counts[r] != records) {
+            fprintf(stderr,
+                    "Error: '%s' has %zu accesses but its outcome stream "
+                    "has %llu\n",
+                    traces[r], d->counts[r], (unsigned long long)records);
+            return false;
+        }
+    }
+    for (unsigned r = 0; r < num_traces && num_maps > 0; r++) {
+        d->regions[r] = regions_load(maps[num_maps == 1 ? 0 : r]);
+        if (d->regions[r] == NULL) {
+            return false;
+        }
+    }
+    if (d->regions[0] != NULL) {
+        d->by_region =
+            calloc(regions_count(d->regions[0]), sizeof(diff_count_t));
+        if (d->by_region == NULL) {
+            fprintf(stderr, "Error: insufficient memory for the regions\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+int diff_main(const char *const outcomes[2], const char *const traces[],
+              unsigned num_traces, const char *const maps[],
+              unsigned num_maps, const char *cache_dir, FILE *out) {
+    if (num_traces > 2 || num_maps > num_traces) {
+        fprintf(stderr, "Error: a comparison takes at most one trace and "
+                        "one region map per run\n");
+        return 1;
+    }
+
+    diff_t d = {.paths = {outcomes[0], outcomes[1]}};
+    unsigned mapped = 0;
+    while (mapped < 2 && outcomes_map(outcomes[mapped], &d.runs[mapped]) == 0) {
+        mapped++;
+    }
+    bool ok = mapped == 2;
+    ok = ok && diff_load(&d, traces, num_traces, maps, num_maps, cache_dir);
+
+    bool by_address = num_traces == 2;
+    if (ok && by_address) {
+        d.oom = !align_by_address(&d);
+    } else if (ok) {
+        uint64_t count = d.runs[0].header->count;
+        if (d.runs[1].header->count != count) {
+            fprintf(stderr,
+                    "Error: the runs have %llu and %llu accesses; give "
+                    "both traces to align them by address\n",
+                    (unsigned long long)count,
+                    (unsigned long long)d.runs[1].header->count);
+            ok = false;
+        }
+        if (ok && num_traces == 1) {
+            d.accesses[1] = d.accesses[0];
+        }
+        for (size_t i = 0; ok && i < count; i++) {
+            diff_pair(&d, i, i);
+        }
+    }
+    ok = ok && !d.oom && diff_print(&d, by_address, out);
+    if (!ok && d.oom) {
+        fprintf(stderr, "Error: insufficient memory to compare the runs\n");
+    }
+
+    for (unsigned r = 0; r < mapped; r++) {
+        outcomes_unmap(&d.runs[r]);
+    }
+    for (unsigned r = 0; r < 2; r++) {
+        regions_free(d.regions[r]);
+    }
+    free(d.accesses[0]);
+    if (num_traces == 2) {
+        free(d.accesses[1]);
+    }
+    free(d.by_region);
+    free(d.sets);
+    return ok ? 0 : 1;
+}
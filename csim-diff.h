@@ -0,0 +1,53 @@
+/**
+ * @file csim-diff.h
+ * @brief Access-by-access comparison of two runs' outcome streams
+ *
+ * `csim --diff=<a> --diff=<b>` aligns the accesses of two outcome streams
+ * (see csim-outcome.h) and reports those whose outcomes differ: one run
+ * hit where the other missed, or both missed but evicted differently.
+ *
+ * Streams of the same trace, with different cache configurations, are
+ * aligned by access number. Given that trace with -t, divergences are
+ * also attributed to the regions of a region map given with -r.
+ *
+ * Streams of different traces, such as two transpose variants, are
+ * aligned by address instead, given both traces: the k-th access to an
+ * address in one trace is paired with the k-th access to the same address
+ * in the other. With a region map per trace, addresses are compared as
+ * offsets into the regions of the same name, so that the regions can lie
+ * at different addresses in the two traces.
+ *
+ * Divergences are summarized by the set they fell in in the first run,
+ * by region, and by their position in the first run's trace.
+ */
+
+#ifndef CSIM_DIFF_H
+#define CSIM_DIFF_H
+
+#include <stdio.h>
+
+/** @brief Number of equal parts of a trace divergences are counted in */
+#define DIFF_WINDOWS 16
+
+/** @brief Number of sets with the most divergences that are listed */
+#define DIFF_TOP_SETS 10
+
+/**
+ * @brief Compares two outcome streams and prints the report.
+ *
+ * @param[in] outcomes    Paths of the two outcome streams
+ * @param[in] traces      Traces of the runs: none, their shared trace, or
+ *                        one per run to align by address
+ * @param[in] num_traces  Number of traces
+ * @param[in] maps        Region maps: none, one for every trace, or one
+ *                        per trace
+ * @param[in] num_maps    Number of region maps
+ * @param[in] cache_dir   Directory of decoded-trace sidecars, or NULL
+ *
+ * @return 0 on success, 1 (after printing an error) on failure
+ */
+int diff_main(const char *const outcomes[2], const char *const traces[],
+              unsigned num_traces, const char *const maps[],
+              unsigned num_maps, const char *cache_dir, FILE *out);
+
+#endif /* CSIM_DIFF_H */
@@ -0,0 +1,56 @@
+/**
+ * @file csim-filter.c
+ * @brief Same-block run-length filter between the trace reader and the
+ *        cache
+ */
+
+#include "csim-filter.h"
+
+void run_filter_init(run_filter_t *filter, csim_cache_t *cache,
+                     unsigned long b) {
+    filter->cache = cache;
+    filter->block_bits = b;
+    filter->num_runs = 0;
+    filter->ok = true;
+}
+
+bool run_filter_flush(run_filter_t *filter) {
+    if (filter->ok) {
+        filter->ok =
+            cache_access_batch(filter->cache, filter->runs, filter->num_runs);
+    }
+    filter->num_runs = 0;
+    return filter->ok;
+}
+
+size_t run_filter_batch(run_filter_t *filter, const csim_access_t *batch,
+                        size_t count) {
+    size_t accesses = 0;
+    for (size_t i = 0; i < count; i++) {
+        const csim_access_t *acc = &batch[i];
+        if (acc->op == CSIM_OP_MARKER) {
+            continue;
+        }
+        accesses++;
+        unsigned long block = acc->addr >> filter->block_bits;
+        if (filter->num_runs > 0 && block == filter->block) {
+            csim_run_t *run = &filter->runs[filter->num_runs - 1];
+            run->repeats++;
+            run->store |= acc->op == 'S';
+            continue;
+        }
+
+        /* The last run is complete, so a full batch can be simulated */
+        if (filter->num_runs == RUN_FILTER_BATCH) {
+            run_filter_flush(filter);
+        }
+        filter->block = block;
+        filter->runs[filter->num_runs++] = (csim_run_t){
+            .addr = acc->addr,
+            .repeats = 0,
+            .op = acc->op,
+            .store = false,
+        };
+    }
+    return accesses;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file csim-filter.h
+ * @brief Same-block run-length filter between the trace reader and the
+ *        cache
+ *
+ * Consecutive accesses to one block are collapsed into a single access
+ * plus a repeat count and a store flag. Under LRU every access after the
+ * first of such a run is a hit, so the results are identical to
+ * simulating each access. Runs are collected into batches for
+ * cache_access_batch(), which prefetches their sets.
+ *
+ * The filter only fits runs that do not observe individual accesses: it is
+ * not used for verbose output, region attribution or interval statistics.
+ */
+
+#ifndef CSIM_FILTER_H
+#define CSIM_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "csim-cache.h"
+#include "csim-trace.h"
+
+/** @brief Number of runs simulated together */
+#define RUN_FILTER_BATCH 64
+
+/** @brief Runs collected for the next batch */
+typedef struct {
+    csim_cache_t *cache;
+    unsigned long block_bits;
+    unsigned long block; /* block of the last run, which may still grow */
+    size_t num_runs;
+    bool ok; /* every run so far could be simulated */
+    csim_run_t runs[RUN_FILTER_BATCH];
+} run_filter_t;
+
+/**
+ * @brief Starts filtering accesses into a cache.
+ *
+ * @param[in] b  Number of block bits of the cache
+ */
+void run_filter_init(run_filter_t *filter, csim_cache_t *cache,
+                     unsigned long b);
+
+/**
+ * @brief Feeds a batch of decoded accesses to the filter.
+ *
+ * Markers are skipped. The last run of the batch stays pending, since the
+ * next batch may extend it.
+ *
+ * @return The number of accesses in the batch, not counting markers
+ */
+size_t run_filter_batch(run_filter_t *filter, const csim_access_t *batch,
+                        size_t count);
+
+/**
+ * @brief Simulates all pending runs.
+ *
+ * @return false if any run since run_filter_init() could not be simulated
+ *         for lack of memory, as cache_access_batch() reports; runs after
+ *         it are dropped
+ */
+bool run_filter_flush(run_filter_t *filter);
+
+#endif /* CSIM_FILTER_H */
@@ -0,0 +1,206 @@
+/**
+ * @file csim-interval.c
+ * @brief Interval time series of simulation statistics
+ *
+ * Counts are the differences between the cache statistics at the ends of
+ * consecutive intervals. The working set is counted with an open-addressed
+ * set of block numbers, where each slot is stamped with the interval that
+ * filled it, so starting a new interval empties the set without clearing
+ * it.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cachelab.h"
+#include "csim-interval.h"
+
+/** @brief Initial number of slots of the working set, a power of two */
+#define WSET_INITIAL_SLOTS 4096
+
+/** @brief A slot of the working set */
+typedef struct {
+    unsigned long block;
+    unsigned long epoch; /* interval that filled the slot, 0 if never */
+} wset_slot_t;
+
+struct csim_intervals {
+    FILE *out;
+    bool binary;
+    bool failed;
+    unsigned long period;
+    unsigned long block_bits;
+
+    unsigned long accesses; /* accesses in the current interval */
+    unsigned long total;    /* accesses in all intervals */
+    csim_stats_t last;      /* cache statistics at the last interval end */
+
+    /* Working set of the current interval, whose epoch is `epoch` */
+    wset_slot_t *slots;
+    unsigned long num_slots;
+    unsigned long num_blocks;
+    unsigned long epoch;
+};
+
+/** @brief Hashes a block number to a slot index */
+static unsigned long wset_hash(const csim_intervals_t *iv,
+                               unsigned long block) {
+    unsigned long h = block * 0x9e3779b97f4a7c15UL;
+    return (h ^ (h >> 32)) & (iv->num_slots - 1);
+}
+
+/** @brief Doubles the working set, keeping the blocks of this interval */
+static bool wset_grow(csim_intervals_t *iv) {
+    unsigned long old_count = iv->num_slots;
+    wset_slot_t *old = iv->slots;
+    wset_slot_t *slots = calloc(2 * old_count, sizeof(wset_slot_t));
+    if (slots == NULL) {
+        return false;
+    }
+    iv->slots = slots;
+    iv->num_slots = 2 * old_count;
+    for (unsigned long i = 0; i < old_count; i++) {
+        if (old[i].epoch == iv->epoch) {
+            unsigned long h = wset_hash(iv, old[i].block);
+            while (slots[h].epoch == iv->epoch) {
+                h = (h + 1) & (iv->num_slots - 1);
+            }
+            slots[h] = old[i];
+        }
+    }
+    free(old);
+    return true;
+}
+
+/** @brief Adds a block to the working set of the current interval */
+static void wset_add(csim_intervals_t *iv, unsigned long block) {
+    unsigned long h = wset_hash(iv, block);
+    while (iv->slots[h].epoch == iv->epoch) {
+        if (iv->slots[h].block == block) {
+            return;
+        }
+        h = (h + 1) & (iv->num_slots - 1);
+    }
+    iv->slots[h].block = block;
+    iv->slots[h].epoch = iv->epoch;
+
+    /* Keep the load below a half */
+    if (++iv->num_blocks * 2 > iv->num_slots && !wset_grow(iv)) {
+        fprintf(stderr, "Error: insufficient memory for the working set\n");
+        exit(1);
+    }
+}
+
+csim_intervals_t *intervals_open(const char *path, bool binary,
+                                 unsigned long period, unsigned long b) {
+    csim_intervals_t *iv = calloc(1, sizeof(csim_intervals_t));
+    if (iv == NULL) {
+        fprintf(stderr, "Error: insufficient memory for intervals\n");
+        return NULL;
+    }
+    iv->slots = calloc(WSET_INITIAL_SLOTS, sizeof(wset_slot_t));
+    if (iv->slots == NULL) {
+        fprintf(stderr, "Error: insufficient memory for intervals\n");
+        free(iv);
+        return NULL;
+    }
+    iv->num_slots = WSET_INITIAL_SLOTS;
+    iv->epoch = 1;
+    iv->binary = binary;
+    iv->period = period;
+    iv->block_bits = b;
+
+    iv->out = path != NULL ? fopen(path, binary ? "wb" : "w") : stdout;
+    if (iv->out == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        free(iv->slots);
+        free(iv);
+        return NULL;
+    }
+
+    if (binary) {
+        interval_file_header_t header = {
+            .magic = INTERVAL_MAGIC,
+            .version = INTERVAL_VERSION,
+            .record_size = sizeof(interval_record_t),
+        };
+        iv->failed = fwrite(&header, sizeof(header), 1, iv->out) != 1;
+    } else {
+        fprintf(iv->out, "end,accesses,hits,misses,evictions,"
+                         "dirty_bytes_evicted,working_set,marker\n");
+    }
+    return iv;
+}
+
+/** @brief Writes the current interval and starts the next one */
+static void end_interval(csim_intervals_t *iv, const csim_cache_t *cache,
+                         bool marker) {
+    if (iv->accesses == 0) {
+        return;
+    }
+
+    csim_stats_t now;
+    cache_stats(cache, &now);
+    iv->total += iv->accesses;
+    interval_record_t rec = {
+        .end = iv->total,
+        .accesses = iv->accesses,
+        .hits = now.hits - iv->last.hits,
+        .misses = now.misses - iv->last.misses,
+        .evictions = now.evictions - iv->last.evictions,
+        .dirty_evictions = now.dirty_evictions - iv->last.dirty_evictions,
+        .working_set = iv->num_blocks,
+        .marker = marker,
+    };
+
+    if (iv->binary) {
+        if (fwrite(&rec, sizeof(rec), 1, iv->out) != 1) {
+            iv->failed = true;
+        }
+    } else {
+        fprintf(iv->out,
+                "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+                rec.end, rec.accesses, rec.hits, rec.misses, rec.evictions,
+                rec.dirty_evictions, rec.working_set, rec.marker);
+    }
+
+    iv->last = now;
+    iv->accesses = 0;
+    iv->num_blocks = 0;
+    iv->epoch++;
+}
+
+void intervals_access(csim_intervals_t *intervals, const csim_cache_t *cache,
+                      unsigned long addr) {
+    wset_add(intervals, addr >> intervals->block_bits);
+    if (++intervals->accesses == intervals->period) {
+        end_interval(intervals, cache, false);
+    }
+}
+
+void intervals_marker(csim_intervals_t *intervals, const csim_cache_t *cache) {
+    end_interval(intervals, cache, true);
+}
+
+int intervals_close(csim_intervals_t *intervals, const csim_cache_t *cache) {
+    if (cache != NULL) {
+        end_interval(intervals, cache, false);
+    }
+    bool failed = intervals->failed || ferror(intervals->out);
+    if (intervals->out != stdout) {
+        failed |= fclose(intervals->out) != 0;
+    } else {
+        fflush(stdout);
+    }
+    free(intervals->slots);
+    free(intervals);
+    if (failed) {
+        fprintf(stderr, "Error: failed to write intervals\n");
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file csim-interval.h
+ * @brief Interval time series of simulation statistics
+ *
+ * The accesses of a run are split into intervals, ending every N
+ * accesses and at every marker record of the trace. Each interval is
+ * written as one row holding its hits, misses, evictions, dirty bytes
+ * evicted and working set, the number of distinct blocks it touched.
+ *
+ * Rows are written either as CSV with a header line, or in a binary
+ * format: an interval_file_header_t followed by interval_record_t records,
+ * all in native byte order.
+ */
+
+#ifndef CSIM_INTERVAL_H
+#define CSIM_INTERVAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "csim-cache.h"
+
+/** @brief Magic bytes at the start of a binary interval file */
+#define INTERVAL_MAGIC "CSIMIVL"
+
+/** @brief Bumped whenever interval_record_t changes */
+#define INTERVAL_VERSION 1
+
+/** @brief Header of a binary interval file */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+} interval_file_header_t;
+
+/** @brief One interval of a binary interval file */
+typedef struct {
+    uint64_t end;             /* accesses simulated by the end of it */
+    uint64_t accesses;        /* accesses in the interval */
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t dirty_evictions; /* bytes evicted from dirty lines */
+    uint64_t working_set;     /* distinct blocks accessed */
+    uint64_t marker;          /* 1 if it ended at a marker, else 0 */
+} interval_record_t;
+
+/** @brief Opaque handle for an interval series being written */
+typedef struct csim_intervals csim_intervals_t;
+
+/**
+ * @brief Starts writing an interval series.
+ *
+ * @param[in] path    File to write, or NULL for stdout
+ * @param[in] binary  Write binary records instead of CSV
+ * @param[in] period  Accesses per interval, or 0 to end intervals only at
+ *                    markers
+ * @param[in] b       Number of block bits, to count distinct blocks
+ *
+ * @return The series, or NULL (after printing an error) on failure
+ */
+csim_intervals_t *intervals_open(const char *path, bool binary,
+                                 unsigned long period, unsigned long b);
+
+/**
+ * @brief Accounts for one simulated access, ending the interval if it is
+ *        the last of its period.
+ */
+void intervals_access(csim_intervals_t *intervals, const csim_cache_t *cache,
+                      unsigned long addr);
+
+/** @brief Ends the current interval at a marker record */
+void intervals_marker(csim_intervals_t *intervals, const csim_cache_t *cache);
+
+/**
+ * @brief Ends the last interval, if it is not empty, and closes the series.
+ *
+ * @param[in] cache  The simulated cache, or NULL if the run failed before
+ *                   simulating anything
+ *
+ * @return 0 on success, 1 if the series could not be written
+ */
+int intervals_close(csim_intervals_t *intervals, const csim_cache_t *cache);
+
+#endif /* CSIM_INTERVAL_H */
@@ -0,0 +1,634 @@
+/**
+ * @file csim-nest.c
+ * @brief Accesses of an affine loop nest, generated instead of traced
+ *
+ * Expressions are parsed once into affine forms over the loop variables,
+ * with params folded into their constants. The nest is then walked like an
+ * odometer: the innermost loop steps until it passes its end, then the next
+ * loop out steps and the loops inside it restart from their bounds, which
+ * are evaluated from the variables of the loops around them.
+ */
+
+#define _XOPEN_SOURCE 700 // getline, strdup
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cachelab.h"
+#include "csim-nest.h"
+
+/** @brief Number of accesses generated at a time */
+#define NEST_BATCH 4096
+
+/** @brief Alignment of the arrays of a layout, as in tracegen-ct.c */
+#define LAYOUT_ALIGN 65536UL
+
+/** @brief Most params and arrays a nest can name */
+#define NEST_MAX_NAMES 32
+
+/** @brief Size of the doubles of the arrays of a layout */
+#define LAYOUT_ELEM sizeof(double)
+
+/** @brief Sum of a constant and multiples of the loop variables */
+typedef struct {
+    long constant;
+    long coef[NEST_MAX_LOOPS];
+} affine_t;
+
+/** @brief A loop bound: an affine form, or the min or max of two */
+typedef struct {
+    char op; /* '\0' for the plain form a, 'm' for min, 'M' for max */
+    affine_t a;
+    affine_t b;
+} bound_t;
+
+typedef struct {
+    char *var;
+    bound_t start;
+    bound_t end;
+    long step;
+} loop_t;
+
+typedef struct {
+    unsigned long base;
+    unsigned size;
+    affine_t index;
+    char op;
+} nest_access_t;
+
+/** @brief A param or an array */
+typedef struct {
+    char *name;
+    bool is_array;
+    long value;          /* of a param */
+    unsigned long base;  /* of an array */
+    unsigned size;       /* of the elements of an array */
+} name_t;
+
+struct csim_nest {
+    loop_t loops[NEST_MAX_LOOPS];
+    unsigned num_loops;
+    nest_access_t accesses[NEST_MAX_ACCESSES];
+    unsigned num_accesses;
+    name_t names[NEST_MAX_NAMES];
+    unsigned num_names;
+
+    /* Position of the walk */
+    bool started;
+    bool done;
+    long value[NEST_MAX_LOOPS];
+    long end[NEST_MAX_LOOPS];
+
+    csim_access_t batch[NEST_BATCH];
+};
+
+/** @brief Text being parsed, and where the parse failed */
+typedef struct {
+    const csim_nest_t *nest;
+    const char *p;
+    const char *error;
+} parser_t;
+
+static const name_t *find_name(const csim_nest_t *nest, const char *name,
+                               size_t len) {
+    for (unsigned i = 0; i < nest->num_names; i++) {
+        if (strlen(nest->names[i].name) == len &&
+            strncmp(nest->names[i].name, name, len) == 0) {
+            return &nest->names[i];
+        }
+    }
+    return NULL;
+}
+
+static int find_loop(const csim_nest_t *nest, const char *name, size_t len) {
+    for (unsigned i = 0; i < nest->num_loops; i++) {
+        if (strlen(nest->loops[i].var) == len &&
+            strncmp(nest->loops[i].var, name, len) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static bool is_constant(const affine_t *a) {
+    for (unsigned i = 0; i < NEST_MAX_LOOPS; i++) {
+        if (a->coef[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void scale(affine_t *a, long factor) {
+    a->constant *= factor;
+    for (unsigned i = 0; i < NEST_MAX_LOOPS; i++) {
+        a->coef[i] *= factor;
+    }
+}
+
+static bool parse_sum(parser_t *ps, affine_t *out);
+
+/** @brief Parses a number, a name, or a parenthesized sum */
+static bool parse_factor(parser_t *ps, affine_t *out) {
+    memset(out, 0, sizeof(*out));
+    const char *p = ps->p;
+    if (*p == '(') {
+        ps->p++;
+        if (!parse_sum(ps, out)) {
+            return false;
+        }
+        if (*ps->p != ')') {
+            ps->error = "missing ')'";
+            return false;
+        }
+        ps->p++;
+        return true;
+    }
+    if (isdigit((unsigned char)*p)) {
+        char *end;
+        errno = 0;
+        out->constant = strtol(p, &end, 0);
+        if (errno != 0) {
+            ps->error = "number out of range";
+            return false;
+        }
+        ps->p = end;
+        return true;
+    }
+    if (!isalpha((unsigned char)*p) && *p != '_') {
+        ps->error = "expected a number or a name";
+        return false;
+    }
+
+    size_t len = 0;
+    while (isalnum((unsigned char)p[len]) || p[len] == '_') {
+        len++;
+    }
+    ps->p = p + len;
+    int loop = find_loop(ps->nest, p, len);
+    if (loop >= 0) {
+        out->coef[loop] = 1;
+        return true;
+    }
+    const name_t *name = find_name(ps->nest, p, len);
+    if (name == NULL || name->is_array) {
+        ps->error = name == NULL ? "unknown name" : "array used as a value";
+        return false;
+    }
+    out->constant = name->value;
+    return true;
+}
+
+/** @brief Parses a product, of which at most one factor is not constant */
+static bool parse_term(parser_t *ps, affine_t *out) {
+    if (!parse_factor(ps, out)) {
+        return false;
+    }
+    while (*ps->p == '*') {
+        ps->p++;
+        affine_t factor;
+        if (!parse_factor(ps, &factor)) {
+            return false;
+        }
+        if (is_constant(&factor)) {
+            scale(out, factor.constant);
+        } else if (is_constant(out)) {
+            scale(&factor, out->constant);
+            *out = factor;
+        } else {
+            ps->error = "product of loop variables is not affine";
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool parse_sum(parser_t *ps, affine_t *out) {
+    long sign = 1;
+    if (*ps->p == '-') {
+        sign = -1;
+        ps->p++;
+    }
+    if (!parse_term(ps, out)) {
+        return false;
+    }
+    scale(out, sign);
+    while (*ps->p == '+' || *ps->p == '-') {
+        sign = *ps->p++ == '-' ? -1 : 1;
+        affine_t term;
+        if (!parse_term(ps, &term)) {
+            return false;
+        }
+        out->constant += sign * term.constant;
+        for (unsigned i = 0; i < NEST_MAX_LOOPS; i++) {
+            out->coef[i] += sign * term.coef[i];
+        }
+    }
+    return true;
+}
+
+/** @brief Parses a whole token as an affine expression */
+static bool parse_affine(parser_t *ps, const char *token, affine_t *out) {
+    ps->p = token;
+    if (!parse_sum(ps, out)) {
+        return false;
+    }
+    if (*ps->p != '\0') {
+        ps->error = "unexpected character in expression";
+        return false;
+    }
+    return true;
+}
+
+/** @brief Parses a whole token as a constant expression */
+static bool parse_constant(parser_t *ps, const char *token, long *out) {
+    affine_t a;
+    if (!parse_affine(ps, token, &a)) {
+        return false;
+    }
+    if (!is_constant(&a)) {
+        ps->error = "expected a constant";
+        return false;
+    }
+    *out = a.constant;
+    return true;
+}
+
+/** @brief Parses a whole token as a loop bound */
+static bool parse_bound(parser_t *ps, const char *token, bound_t *out) {
+    memset(out, 0, sizeof(*out));
+    if (strncmp(token, "min(", 4) != 0 && strncmp(token, "max(", 4) != 0) {
+        return parse_affine(ps, token, &out->a);
+    }
+
+    out->op = token[1] == 'i' ? 'm' : 'M';
+    ps->p = token + 4;
+    if (!parse_sum(ps, &out->a)) {
+        return false;
+    }
+    if (*ps->p != ',') {
+        ps->error = "expected ',' in min or max";
+        return false;
+    }
+    ps->p++;
+    if (!parse_sum(ps, &out->b)) {
+        return false;
+    }
+    if (ps->p[0] != ')' || ps->p[1] != '\0') {
+        ps->error = "expected ')' to end min or max";
+        return false;
+    }
+    return true;
+}
+
+/** @brief Checks that a new name is well-formed and not yet taken */
+static bool check_new_name(parser_t *ps, const char *name) {
+    size_t len = strlen(name);
+    if (!isalpha((unsigned char)name[0]) && name[0] != '_') {
+        ps->error = "names must start with a letter";
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (!isalnum((unsigned char)name[i]) && name[i] != '_') {
+            ps->error = "names may only have letters, digits and '_'";
+            return false;
+        }
+    }
+    if (find_name(ps->nest, name, len) != NULL ||
+        find_loop(ps->nest, name, len) >= 0) {
+        ps->error = "name already defined";
+        return false;
+    }
+    return true;
+}
+
+/** @brief Adds a param or an array under a copy of its name */
+static bool add_name(parser_t *ps, csim_nest_t *nest, const char *name,
+                     const name_t *def) {
+    if (!check_new_name(ps, name)) {
+        return false;
+    }
+    if (nest->num_names == NEST_MAX_NAMES) {
+        ps->error = "too many params and arrays";
+        return false;
+    }
+    name_t *n = &nest->names[nest->num_names];
+    *n = *def;
+    n->name = strdup(name);
+    if (n->name == NULL) {
+        ps->error = "insufficient memory";
+        return false;
+    }
+    nest->num_names++;
+    return true;
+}
+
+/**
+ * @brief Defines M, N, and the arrays A, T and B of tracegen-ct's layout:
+ *        A at the arena, T at the next alignment boundary after A, and B
+ *        right after T.
+ */
+static bool add_layout(parser_t *ps, csim_nest_t *nest, long M, long N,
+                       unsigned long arena) {
+    if (M <= 0 || N <= 0 || M > MAXN || N > MAXN) {
+        ps->error = "layout sizes must be from 1 to MAXN";
+        return false;
+    }
+    unsigned long a_bytes = (unsigned long)(M * N) * LAYOUT_ELEM;
+    unsigned long t_base =
+        arena + (a_bytes + LAYOUT_ALIGN - 1) / LAYOUT_ALIGN * LAYOUT_ALIGN;
+    unsigned long b_base = t_base + TMPCOUNT * LAYOUT_ELEM;
+    name_t array = {.is_array = true, .size = (unsigned)LAYOUT_ELEM};
+    if (!add_name(ps, nest, "M", &(name_t){.value = M}) ||
+        !add_name(ps, nest, "N", &(name_t){.value = N})) {
+        return false;
+    }
+    array.base = arena;
+    if (!add_name(ps, nest, "A", &array)) {
+        return false;
+    }
+    array.base = t_base;
+    if (!add_name(ps, nest, "T", &array)) {
+        return false;
+    }
+    array.base = b_base;
+    return add_name(ps, nest, "B", &array);
+}
+
+/** @brief Parses a hexadecimal address */
+static bool parse_address(parser_t *ps, const char *token,
+                          unsigned long *out) {
+    char *end;
+    errno = 0;
+    *out = strtoul(token, &end, 16);
+    if (end == token || *end != '\0' || errno != 0) {
+        ps->error = "expected a hexadecimal address";
+        return false;
+    }
+    return true;
+}
+
+/** @brief Parses one directive, split into its tokens */
+static bool parse_directive(parser_t *ps, csim_nest_t *nest, char **tok,
+                            unsigned ntok) {
+    const char *dir = tok[0];
+    if (strcmp(dir, "param") == 0 && ntok == 3) {
+        name_t def = {0};
+        return parse_constant(ps, tok[2], &def.value) &&
+               add_name(ps, nest, tok[1], &def);
+    }
+    if (strcmp(dir, "array") == 0 && ntok == 4) {
+        name_t def = {.is_array = true};
+        long size;
+        if (!parse_address(ps, tok[2], &def.base) ||
+            !parse_constant(ps, tok[3], &size)) {
+            return false;
+        }
+        if (size <= 0 || size > 255) {
+            ps->error = "element size must be from 1 to 255";
+            return false;
+        }
+        def.size = (unsigned)size;
+        return add_name(ps, nest, tok[1], &def);
+    }
+    if (strcmp(dir, "layout") == 0 && (ntok == 3 || ntok == 4)) {
+        long M, N;
+        unsigned long arena = NEST_ARENA;
+        if (!parse_constant(ps, tok[1], &M) ||
+            !parse_constant(ps, tok[2], &N) ||
+            (ntok == 4 && !parse_address(ps, tok[3], &arena))) {
+            return false;
+        }
+        return add_layout(ps, nest, M, N, arena);
+    }
+    if (strcmp(dir, "loop") == 0 && (ntok == 4 || ntok == 5)) {
+        if (nest->num_accesses > 0) {
+            ps->error = "loops must come before the accesses";
+            return false;
+        }
+        if (nest->num_loops == NEST_MAX_LOOPS) {
+            ps->error = "too many loops";
+            return false;
+        }
+        loop_t *loop = &nest->loops[nest->num_loops];
+        loop->step = 1;
+        if (!parse_bound(ps, tok[2], &loop->start) ||
+            !parse_bound(ps, tok[3], &loop->end) ||
+            (ntok == 5 && !parse_constant(ps, tok[4], &loop->step)) ||
+            !check_new_name(ps, tok[1])) {
+            return false;
+        }
+        if (loop->step <= 0) {
+            ps->error = "loop step must be positive";
+            return false;
+        }
+        loop->var = strdup(tok[1]);
+        if (loop->var == NULL) {
+            ps->error = "insufficient memory";
+            return false;
+        }
+        nest->num_loops++;
+        return true;
+    }
+    if ((strcmp(dir, "load") == 0 || strcmp(dir, "store") == 0) &&
+        ntok == 3) {
+        if (nest->num_accesses == NEST_MAX_ACCESSES) {
+            ps->error = "too many accesses";
+            return false;
+        }
+        const name_t *array = find_name(nest, tok[1], strlen(tok[1]));
+        if (array == NULL || !array->is_array) {
+            ps->error = "unknown array";
+            return false;
+        }
+        nest_access_t *access = &nest->accesses[nest->num_accesses];
+        access->base = array->base;
+        access->size = array->size;
+        access->op = dir[0] == 'l' ? 'L' : 'S';
+        if (!parse_affine(ps, tok[2], &access->index)) {
+            return false;
+        }
+        nest->num_accesses++;
+        return true;
+    }
+    ps->error = "unknown directive or wrong number of arguments";
+    return false;
+}
+
+/** @brief Splits a line into its tokens, up to a comment */
+static unsigned tokenize(char *line, char **tok, unsigned max) {
+    unsigned ntok = 0;
+    char *p = line;
+    for (;;) {
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            return ntok;
+        }
+        if (ntok == max) {
+            return max + 1;
+        }
+        tok[ntok++] = p;
+        while (*p != '\0' && *p != '#' && !isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (*p == '#') {
+            *p = '\0';
+            return ntok;
+        }
+        if (*p != '\0') {
+            *p++ = '\0';
+        }
+    }
+}
+
+csim_nest_t *nest_load(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    csim_nest_t *nest = calloc(1, sizeof(csim_nest_t));
+    if (nest == NULL) {
+        fprintf(stderr, "Error: insufficient memory for loop nest\n");
+        fclose(fp);
+        return NULL;
+    }
+
+    char *line = NULL;
+    size_t line_cap = 0;
+    unsigned long line_num = 0;
+    parser_t ps = {.nest = nest};
+    bool ok = true;
+    while (ok && getline(&line, &line_cap, fp) != -1) {
+        line_num++;
+        char *tok[5];
+        unsigned ntok = tokenize(line, tok, 5);
+        if (ntok == 0) {
+            continue;
+        }
+        ps.error = NULL;
+        if (ntok > 5 || !parse_directive(&ps, nest, tok, ntok)) {
+            fprintf(stderr, "Error: line %lu of '%s': %s\n", line_num, path,
+                    ps.error != NULL
+                        ? ps.error
+                        : "unknown directive or wrong number of arguments");
+            ok = false;
+        }
+    }
+    free(line);
+    fclose(fp);
+
+    if (ok && (nest->num_loops == 0 || nest->num_accesses == 0)) {
+        fprintf(stderr, "Error: '%s' needs at least one loop and access\n",
+                path);
+        ok = false;
+    }
+    if (!ok) {
+        nest_free(nest);
+        return NULL;
+    }
+    return nest;
+}
+
+static long eval_affine(const csim_nest_t *nest, const affine_t *a,
+                        unsigned num_vars) {
+    long value = a->constant;
+    for (unsigned i = 0; i < num_vars; i++) {
+        value += a->coef[i] * nest->value[i];
+    }
+    return value;
+}
+
+/** @brief Evaluates a bound of a loop from the loops around it */
+static long eval_bound(const csim_nest_t *nest, const bound_t *bound,
+                       unsigned level) {
+    long a = eval_affine(nest, &bound->a, level);
+    if (bound->op == '\0') {
+        return a;
+    }
+    long b = eval_affine(nest, &bound->b, level);
+    if (bound->op == 'm') {
+        return a < b ? a : b;
+    }
+    return a > b ? a : b;
+}
+
+/**
+ * @brief Moves to the next iteration of the innermost body.
+ *
+ * @return false once every iteration has been visited
+ */
+static bool nest_step(csim_nest_t *nest) {
+    int level = nest->started ? (int)nest->num_loops - 1 : -1;
+    nest->started = true;
+    for (;;) {
+        if (level >= 0) {
+            nest->value[level] += nest->loops[level].step;
+            if (nest->value[level] >= nest->end[level]) {
+                level--;
+                if (level < 0) {
+                    return false;
+                }
+                continue;
+            }
+        }
+
+        /* (Re)start the loops inside, until one of them is empty */
+        unsigned k = (unsigned)(level + 1);
+        for (; k < nest->num_loops; k++) {
+            nest->value[k] = eval_bound(nest, &nest->loops[k].start, k);
+            nest->end[k] = eval_bound(nest, &nest->loops[k].end, k);
+            if (nest->value[k] >= nest->end[k]) {
+                break;
+            }
+        }
+        if (k == nest->num_loops) {
+            return true;
+        }
+        level = (int)k - 1;
+        if (level < 0) {
+            return false;
+        }
+    }
+}
+
+size_t nest_next(csim_nest_t *nest, const csim_access_t **batch) {
+    size_t count = 0;
+    while (!nest->done && count + nest->num_accesses <= NEST_BATCH) {
+        if (!nest_step(nest)) {
+            nest->done = true;
+            break;
+        }
+        for (unsigned i = 0; i < nest->num_accesses; i++) {
+            const nest_access_t *access = &nest->accesses[i];
+            long index = eval_affine(nest, &access->index, nest->num_loops);
+            nest->batch[count++] = (csim_access_t){
+                .addr = access->base +
+                        (unsigned long)index * access->size,
+                .size = access->size,
+                .op = access->op};
+        }
+    }
+    *batch = nest->batch;
+    return count;
+}
+
+void nest_free(csim_nest_t *nest) {
+    if (nest == NULL) {
+        return;
+    }
+    for (unsigned i = 0; i < nest->num_loops; i++) {
+        free(nest->loops[i].var);
+    }
+    for (unsigned i = 0; i < nest->num_names; i++) {
+        free(nest->names[i].name);
+    }
+    free(nest);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file csim-nest.h
+ * @brief Accesses of an affine loop nest, generated instead of traced
+ *
+ * A nest file describes a perfect loop nest and the accesses of its body,
+ * one directive per line:
+ *
+ *     # 32x32 transpose in 8x8 tiles, column of tiles by column of tiles
+ *     layout 32 32
+ *     loop j0 0 M 8
+ *     loop i0 0 N 8
+ *     loop i i0 min(i0+8,N)
+ *     loop j j0 min(j0+8,M)
+ *     load A i*M+j
+ *     store B j*N+i
+ *
+ * The directives are:
+ *
+ *     param <name> <value>           a named constant
+ *     array <name> <base> <size>     an array at a hexadecimal base address,
+ *                                    of elements of <size> bytes
+ *     layout <M> <N> [<arena>]       the params M and N, and the doubles
+ *                                    arrays A, T and B laid out in an arena
+ *                                    as tracegen-ct lays out bigA, bigT and
+ *                                    bigB (default arena: NEST_ARENA)
+ *     loop <var> <start> <end> [<step>]
+ *                                    a loop, inside the loops before it,
+ *                                    over start, start + step, ... < end
+ *     load <array> <index>           an access of the innermost body, at
+ *     store <array> <index>          base + size * index, in file order
+ *
+ * Values and indices are affine expressions of numbers, params and the
+ * variables of enclosing loops, using +, -, * and parentheses, written
+ * without spaces. A loop bound may also be min(<a>,<b>) or max(<a>,<b>).
+ *
+ * The accesses are generated in batches as they are simulated, so nests of
+ * any size take no memory, and no code runs to produce them.
+ */
+
+#ifndef CSIM_NEST_H
+#define CSIM_NEST_H
+
+#include <stddef.h>
+
+#include "csim-trace.h"
+
+/** @brief Most loops a nest can have */
+#define NEST_MAX_LOOPS 8
+
+/** @brief Most accesses the body of a nest can make */
+#define NEST_MAX_ACCESSES 16
+
+/**
+ * @brief Default address of the arena of a layout, which like the arena of
+ *        tracegen-ct is aligned to 64 KiB
+ */
+#define NEST_ARENA 0x7f0000000000UL
+
+/** @brief Opaque handle for a loop nest being generated */
+typedef struct csim_nest csim_nest_t;
+
+/**
+ * @brief Reads a nest file.
+ *
+ * @return The nest, or NULL (after printing an error) if the file cannot
+ *         be read or is malformed
+ */
+csim_nest_t *nest_load(const char *path);
+
+/**
+ * @brief Generates the next batch of accesses, like trace_next().
+ *
+ * The batch stays valid until the next call on the same nest.
+ *
+ * @return The number of accesses in the batch, 0 once the nest is done
+ */
+size_t nest_next(csim_nest_t *nest, const csim_access_t **batch);
+
+/** @brief Frees a nest */
+void nest_free(csim_nest_t *nest);
+
+#endif /* CSIM_NEST_H */
@@ -0,0 +1,150 @@
+/**
+ * @file csim-outcome.c
+ * @brief Per-access outcome streams of simulation runs
+ *
+ * Records are gathered in a buffer and written a buffer at a time. The
+ * header goes first with no records counted and is written again with the
+ * final count when the stream is closed, so a stream whose run failed
+ * part way is recognizably incomplete.
+ */
+
+#define _XOPEN_SOURCE 700 // mmap
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "csim-outcome.h"
+
+/** @brief Number of records written at a time */
+#define OUTCOME_BUFFER 4096
+
+struct csim_outcomes {
+    FILE *out;
+    const char *path;
+    bool failed;
+    outcome_file_header_t header;
+    uint32_t buffer[OUTCOME_BUFFER];
+    size_t buffered;
+};
+
+csim_outcomes_t *outcomes_open(const char *path, unsigned long s,
+                               unsigned long E, unsigned long b,
+                               csim_indexing_t indexing) {
+    if (s > OUTCOME_MAX_SET_BITS || E > UINT32_MAX) {
+        fprintf(stderr,
+                "Error: outcome streams need s <= %d and E < 2**32\n",
+                OUTCOME_MAX_SET_BITS);
+        return NULL;
+    }
+    csim_outcomes_t *oc = calloc(1, sizeof(csim_outcomes_t));
+    if (oc == NULL) {
+        fprintf(stderr, "Error: insufficient memory for outcomes\n");
+        return NULL;
+    }
+    oc->out = fopen(path, "wb");
+    if (oc->out == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        free(oc);
+        return NULL;
+    }
+    oc->path = path;
+    memcpy(oc->header.magic, OUTCOME_MAGIC, sizeof(oc->header.magic));
+    oc->header.version = OUTCOME_VERSION;
+    oc->header.record_size = sizeof(uint32_t);
+    oc->header.s = (uint32_t)s;
+    oc->header.E = (uint32_t)E;
+    oc->header.b = (uint32_t)b;
+    oc->header.indexing = (uint32_t)indexing;
+    oc->failed = fwrite(&oc->header, sizeof(oc->header), 1, oc->out) != 1;
+    return oc;
+}
+
+/** @brief Writes out the buffered records */
+static void outcomes_flush(csim_outcomes_t *oc) {
+    if (oc->buffered > 0 &&
+        fwrite(oc->buffer, sizeof(uint32_t), oc->buffered, oc->out) !=
+            oc->buffered) {
+        oc->failed = true;
+    }
+    oc->header.count += oc->buffered;
+    oc->buffered = 0;
+}
+
+void outcomes_record(csim_outcomes_t *oc, const csim_outcome_t *outcome) {
+    uint32_t record = (uint32_t)(outcome->set << OUTCOME_SET_SHIFT);
+    if (outcome->hit) {
+        record |= OUTCOME_HIT;
+    } else if (outcome->evicted) {
+        record |= OUTCOME_EVICTED;
+        if (outcome->dirty_evicted) {
+            record |= OUTCOME_DIRTY;
+        }
+    }
+    oc->buffer[oc->buffered++] = record;
+    if (oc->buffered == OUTCOME_BUFFER) {
+        outcomes_flush(oc);
+    }
+}
+
+int outcomes_close(csim_outcomes_t *oc) {
+    outcomes_flush(oc);
+    bool ok = !oc->failed && fseek(oc->out, 0, SEEK_SET) == 0 &&
+              fwrite(&oc->header, sizeof(oc->header), 1, oc->out) == 1;
+    ok = fclose(oc->out) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "Error: failed to write outcomes to '%s'\n",
+                oc->path);
+    }
+    free(oc);
+    return ok ? 0 : 1;
+}
+
+int outcomes_map(const char *path, csim_outcome_map_t *map) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        return 1;
+    }
+
+    struct stat st;
+    void *mem = MAP_FAILED;
+    if (fstat(fd, &st) == 0 &&
+        (size_t)st.st_size >= sizeof(outcome_file_header_t)) {
+        mem = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mem == MAP_FAILED) {
+        fprintf(stderr, "Error: '%s' is not an outcome stream\n", path);
+        return 1;
+    }
+
+    const outcome_file_header_t *h = mem;
+    size_t records_len = (size_t)st.st_size - sizeof(*h);
+    if (memcmp(h->magic, OUTCOME_MAGIC, sizeof(h->magic)) != 0 ||
+        h->version != OUTCOME_VERSION ||
+        h->record_size != sizeof(uint32_t) ||
+        h->indexing > CSIM_INDEXING_SKEW ||
+        records_len != h->count * sizeof(uint32_t)) {
+        fprintf(stderr, "Error: '%s' is not a complete outcome stream\n",
+                path);
+        munmap(mem, (size_t)st.st_size);
+        return 1;
+    }
+
+    map->header = h;
+    map->records = (const uint32_t *)(h + 1);
+    map->map = mem;
+    map->map_len = (size_t)st.st_size;
+    return 0;
+}
+
+void outcomes_unmap(csim_outcome_map_t *map) {
+    munmap(map->map, map->map_len);
+}
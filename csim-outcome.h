@@ -0,0 +1,99 @@
+/**
+ * @file csim-outcome.h
+ * @brief Per-access outcome streams of simulation runs
+ *
+ * An outcome stream records what happened to every access of a run, in
+ * trace order and not counting markers, so that two runs can be compared
+ * access by access. It is an outcome_file_header_t followed by one 32-bit
+ * record per access, all in native byte order, so that it can be mapped
+ * and indexed by access number. A record holds the OUTCOME_* bits in its
+ * low bits and the set of the line holding the block above them.
+ */
+
+#ifndef CSIM_OUTCOME_H
+#define CSIM_OUTCOME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "csim-cache.h"
+
+/** @brief Magic bytes at the start of an outcome stream */
+#define OUTCOME_MAGIC "CSIMOUT"
+
+/** @brief Bumped whenever the header or the record layout changes */
+#define OUTCOME_VERSION 1
+
+/** @brief Record bit of an access that hit */
+#define OUTCOME_HIT 0x1u
+
+/** @brief Record bit of a miss that evicted a valid line */
+#define OUTCOME_EVICTED 0x2u
+
+/** @brief Record bit of an eviction of a dirty line */
+#define OUTCOME_DIRTY 0x4u
+
+/** @brief Position of the set in a record */
+#define OUTCOME_SET_SHIFT 3
+
+/** @brief Most set index bits a record has room for */
+#define OUTCOME_MAX_SET_BITS (32 - OUTCOME_SET_SHIFT)
+
+/** @brief Header of an outcome stream */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t s;        /* geometry of the simulated cache */
+    uint32_t E;
+    uint32_t b;
+    uint32_t indexing; /* csim_indexing_t of the cache */
+    uint64_t count;    /* number of records that follow */
+} outcome_file_header_t;
+
+/** @brief Opaque handle for an outcome stream being written */
+typedef struct csim_outcomes csim_outcomes_t;
+
+/**
+ * @brief Starts writing an outcome stream.
+ *
+ * @param[in] path  File to write
+ * @param[in] s     Number of set index bits, at most OUTCOME_MAX_SET_BITS
+ *
+ * @return The stream, or NULL (after printing an error) on failure
+ */
+csim_outcomes_t *outcomes_open(const char *path, unsigned long s,
+                               unsigned long E, unsigned long b,
+                               csim_indexing_t indexing);
+
+/** @brief Appends the outcome of the next access */
+void outcomes_record(csim_outcomes_t *outcomes,
+                     const csim_outcome_t *outcome);
+
+/**
+ * @brief Finishes and closes an outcome stream.
+ *
+ * @return 0 on success, 1 if the stream could not be written
+ */
+int outcomes_close(csim_outcomes_t *outcomes);
+
+/** @brief An outcome stream mapped for reading */
+typedef struct {
+    const outcome_file_header_t *header;
+    const uint32_t *records; /* header->count records */
+    void *map;
+    size_t map_len;
+} csim_outcome_map_t;
+
+/**
+ * @brief Maps an outcome stream.
+ *
+ * @return 0 on success, 1 (after printing an error) if the file cannot be
+ *         read or is not a complete outcome stream
+ */
+int outcomes_map(const char *path, csim_outcome_map_t *map);
+
+/** @brief Unmaps an outcome stream */
+void outcomes_unmap(csim_outcome_map_t *map);
+
+#endif /* CSIM_OUTCOME_H */
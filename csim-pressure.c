@@ -0,0 +1,222 @@
+/**
+ * @file csim-pressure.c
+ * @brief Set-pressure report: how evenly a trace loads the sets of a cache
+ *
+ * Per-set counts come from the cache itself once the run is over, so only
+ * the bit counts of the block numbers are gathered while simulating. The
+ * sets are listed from cache_each_set(), which for a sparse cache skips
+ * the sets never touched; those add nothing but zeros to any of the sums.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "csim-pressure.h"
+
+/** @brief Number of bits of a block number that are counted */
+#define PRESSURE_BITS 64
+
+struct csim_pressure {
+    FILE *out;
+    unsigned long set_bits;
+    unsigned long block_bits;
+    csim_indexing_t indexing;
+    unsigned long accesses;
+    unsigned long ones[PRESSURE_BITS]; /* accesses with each bit set */
+    unsigned long seen;                /* OR of all block numbers */
+};
+
+/** @brief Counters of one touched set, gathered for sorting */
+typedef struct {
+    unsigned long set;
+    csim_set_stats_t stats;
+} set_entry_t;
+
+/** @brief The touched sets of a cache */
+typedef struct {
+    set_entry_t *entries;
+    size_t count;
+    size_t capacity;
+    bool failed;
+} set_list_t;
+
+csim_pressure_t *pressure_open(const char *path, unsigned long s,
+                               unsigned long b, csim_indexing_t indexing) {
+    csim_pressure_t *pressure = calloc(1, sizeof(csim_pressure_t));
+    if (pressure == NULL) {
+        fprintf(stderr, "Error: insufficient memory for the set report\n");
+        return NULL;
+    }
+    pressure->out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (pressure->out == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        free(pressure);
+        return NULL;
+    }
+    pressure->set_bits = s;
+    pressure->block_bits = b;
+    pressure->indexing = indexing;
+    return pressure;
+}
+
+void pressure_access(csim_pressure_t *pressure, unsigned long addr) {
+    unsigned long block = addr >> pressure->block_bits;
+    pressure->accesses++;
+    pressure->seen |= block;
+    for (; block != 0; block &= block - 1) {
+        pressure->ones[__builtin_ctzl(block)]++;
+    }
+}
+
+/** @brief Appends a touched set to a set_list_t */
+static void list_set(void *arg, unsigned long set,
+                     const csim_set_stats_t *stats) {
+    set_list_t *list = arg;
+    if (stats->accesses == 0 || list->failed) {
+        return;
+    }
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity > 0 ? 2 * list->capacity : 1024;
+        set_entry_t *entries =
+            realloc(list->entries, capacity * sizeof(set_entry_t));
+        if (entries == NULL) {
+            list->failed = true;
+            return;
+        }
+        list->entries = entries;
+        list->capacity = capacity;
+    }
+    list->entries[list->count++] = (set_entry_t){set, *stats};
+}
+
+static int by_evictions(const void *a, const void *b) {
+    const set_entry_t *x = a;
+    const set_entry_t *y = b;
+    if (x->stats.evictions != y->stats.evictions) {
+        return x->stats.evictions < y->stats.evictions ? 1 : -1;
+    }
+    return x->set < y->set ? -1 : x->set > y->set;
+}
+
+static int by_set(const void *a, const void *b) {
+    const set_entry_t *x = a;
+    const set_entry_t *y = b;
+    return x->set < y->set ? -1 : x->set > y->set;
+}
+
+/** @brief Returns the entropy in bits of a coin that lands heads k in n */
+static double bit_entropy(unsigned long k, unsigned long n) {
+    if (k == 0 || k == n) {
+        return 0.0;
+    }
+    double p = (double)k / (double)n;
+    return -p * log2(p) - (1 - p) * log2(1 - p);
+}
+
+/** @brief Writes the summary of how the sets are loaded */
+static void print_summary(csim_pressure_t *pressure, set_list_t *list,
+                          unsigned long num_sets) {
+    FILE *out = pressure->out;
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    unsigned long total_evictions = 0;
+    set_entry_t hottest = {0};
+    for (size_t i = 0; i < list->count; i++) {
+        const set_entry_t *e = &list->entries[i];
+        sum += (double)e->stats.accesses;
+        sum_sq += (double)e->stats.accesses * (double)e->stats.accesses;
+        total_evictions += e->stats.evictions;
+        if (e->stats.accesses > hottest.stats.accesses) {
+            hottest = *e;
+        }
+    }
+    double mean = sum / (double)num_sets;
+    double var = sum_sq / (double)num_sets - mean * mean;
+    double cv = mean > 0 ? sqrt(var > 0 ? var : 0) / mean : 0.0;
+
+    /* Eviction share of the hottest sets, counting at least one set */
+    qsort(list->entries, list->count, sizeof(set_entry_t), by_evictions);
+    unsigned long hot = num_sets / (100 / PRESSURE_HOT_PERCENT);
+    hot = hot > 0 ? hot : 1;
+    unsigned long hot_evictions = 0;
+    for (size_t i = 0; i < list->count && i < hot; i++) {
+        hot_evictions += list->entries[i].stats.evictions;
+    }
+
+    fprintf(out, "Set pressure: %lu sets, %s indexing\n", num_sets,
+            cache_indexing_name(pressure->indexing));
+    fprintf(out, "Sets accessed: %zu of %lu\n", list->count, num_sets);
+    fprintf(out, "Accesses per set: mean %.2f, max %lu", mean,
+            hottest.stats.accesses);
+    if (list->count > 0) {
+        fprintf(out, " (set %lu)", hottest.set);
+    }
+    fprintf(out, ", coefficient of variation %.3f\n", cv);
+    fprintf(out, "Evictions: %lu, %.1f%% of them in the hottest %lu sets\n",
+            total_evictions,
+            total_evictions > 0
+                ? 100.0 * (double)hot_evictions / (double)total_evictions
+                : 0.0,
+            hot);
+}
+
+/** @brief Writes the entropy of every bit that varies in the block numbers */
+static void print_bits(const csim_pressure_t *pressure) {
+    FILE *out = pressure->out;
+    fprintf(out, "\nEntropy of block number bits (1.000 splits accesses "
+                 "evenly, Index marks the bits of modulo indexing):\n");
+    fprintf(out, "%5s %8s %12s %8s %s\n", "Bit", "Addr bit", "Ones",
+            "Entropy", "Index");
+    for (unsigned bit = 0; bit + pressure->block_bits < PRESSURE_BITS &&
+                           (pressure->seen >> bit) != 0;
+         bit++) {
+        unsigned long ones = pressure->ones[bit];
+        fprintf(out, "%5u %8lu %12lu %8.3f %s\n", bit,
+                bit + pressure->block_bits, ones,
+                bit_entropy(ones, pressure->accesses),
+                bit < pressure->set_bits ? "yes" : "");
+    }
+}
+
+int pressure_close(csim_pressure_t *pressure, const csim_cache_t *cache) {
+    bool failed = false;
+    if (cache != NULL) {
+        set_list_t list = {0};
+        cache_each_set(cache, list_set, &list);
+        if (list.failed) {
+            fprintf(stderr, "Error: insufficient memory for the set report\n");
+            failed = true;
+        } else {
+            print_summary(pressure, &list, cache_num_sets(cache));
+            print_bits(pressure);
+
+            FILE *out = pressure->out;
+            qsort(list.entries, list.count, sizeof(set_entry_t), by_set);
+            fprintf(out, "\nAccessed sets:\n%12s %12s %12s %12s %12s\n",
+                    "Set", "Accesses", "Misses", "Evictions", "Valid");
+            for (size_t i = 0; i < list.count; i++) {
+                const set_entry_t *e = &list.entries[i];
+                fprintf(out, "%12lu %12lu %12lu %12lu %12lu\n", e->set,
+                        e->stats.accesses, e->stats.misses,
+                        e->stats.evictions, e->stats.valid);
+            }
+        }
+        free(list.entries);
+    }
+
+    failed |= ferror(pressure->out) != 0;
+    if (pressure->out != stdout) {
+        failed |= fclose(pressure->out) != 0;
+    } else {
+        fflush(stdout);
+    }
+    free(pressure);
+    if (failed) {
+        fprintf(stderr, "Error: failed to write the set report\n");
+    }
+    return failed ? 1 : 0;
+}
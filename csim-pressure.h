@@ -0,0 +1,50 @@
+/**
+ * @file csim-pressure.h
+ * @brief Set-pressure report: how evenly a trace loads the sets of a cache
+ *
+ * The report shows how accesses and evictions spread over the sets, how
+ * much of the eviction traffic lands on the hottest sets, and the entropy
+ * of every bit of the block numbers accessed. An index bit with little
+ * entropy splits the accesses unevenly, so conflict misses concentrate on
+ * a few sets; running again with another indexing function (see
+ * csim_indexing_t) shows whether hashing spreads them out.
+ */
+
+#ifndef CSIM_PRESSURE_H
+#define CSIM_PRESSURE_H
+
+#include "csim-cache.h"
+
+/** @brief Fraction of the sets counted as the hottest ones, in percent */
+#define PRESSURE_HOT_PERCENT 10
+
+/** @brief Opaque handle for a set-pressure report being gathered */
+typedef struct csim_pressure csim_pressure_t;
+
+/**
+ * @brief Starts gathering a set-pressure report.
+ *
+ * @param[in] path      File to write the report to, or "-" for stdout
+ * @param[in] s         Number of set index bits
+ * @param[in] b         Number of block bits
+ * @param[in] indexing  Indexing function of the simulated cache
+ *
+ * @return The report, or NULL (after printing an error) on failure
+ */
+csim_pressure_t *pressure_open(const char *path, unsigned long s,
+                               unsigned long b, csim_indexing_t indexing);
+
+/** @brief Accounts for the address of one simulated access */
+void pressure_access(csim_pressure_t *pressure, unsigned long addr);
+
+/**
+ * @brief Writes the report and frees it.
+ *
+ * @param[in] cache  The simulated cache, or NULL if the run failed before
+ *                   simulating anything, in which case nothing is written
+ *
+ * @return 0 on success, 1 if the report could not be written
+ */
+int pressure_close(csim_pressure_t *pressure, const csim_cache_t *cache);
+
+#endif /* CSIM_PRESSURE_H */
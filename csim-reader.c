@@ -0,0 +1,267 @@
+/**
+ * @file csim-reader.c
+ * @brief Read-ahead of text traces on a background thread
+ *
+ * The ring holds READER_CHUNKS chunks. The background thread fills the
+ * chunk at `(tail + filled) % READER_CHUNKS` whenever one is free, and the
+ * consumer copies out of the chunk at `tail`, which it keeps until it is
+ * used up. The chunk a read failed in ends the ring, keeping whatever
+ * was read into it before the error, and so does a chunk with no data
+ * at the end of the file; the thread stops after publishing it. The lock
+ * is only held to publish and release chunks, never while reading or
+ * copying, since a chunk is owned by exactly one side at a time.
+ *
+ * Each side keeps its own counters. The thread times the reads that fill
+ * a chunk into the chunk itself, and the consumer adds that time up when
+ * it takes the chunk, which publishing has made safe to read.
+ */
+
+#define _XOPEN_SOURCE 700 // posix_fadvise, clock_gettime
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "csim-reader.h"
+
+/** @brief Number of chunks in the ring */
+#define READER_CHUNKS 4
+
+/** @brief Size of a chunk, and of the reads that fill it */
+#define READER_CHUNK_BYTES (1 << 20)
+
+/** @brief How far past the ring the kernel is asked to read ahead */
+#define READER_AHEAD_BYTES (8 << 20)
+
+/** @brief A chunk of the ring */
+typedef struct {
+    char *data;
+    size_t len; /* 0 for the chunk that ends the ring */
+    int err;    /* errno of the failed read, for the last chunk */
+    uint64_t read_ns; /* time its filler spent reading it */
+} chunk_t;
+
+struct csim_reader {
+    int fd;
+    bool threaded;
+    pthread_t thread;
+
+    pthread_mutex_t lock;
+    pthread_cond_t filled_cond; /* signaled when a chunk is published */
+    pthread_cond_t free_cond;   /* signaled when a chunk is released */
+    chunk_t chunks[READER_CHUNKS];
+    unsigned tail;   /* chunk the consumer reads next */
+    unsigned filled; /* chunks published and not yet released */
+    bool stop;       /* set on close to stop the thread early */
+
+    /* Consumer state, only touched by the consumer */
+    size_t pos;    /* bytes of the tail chunk already copied out */
+    bool holding;  /* the tail chunk has been taken */
+    bool finished; /* the chunk that ends the ring has been taken */
+    int err;
+    uint64_t wait_ns;
+    uint64_t read_ns;
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Fills a chunk with as much of the file as fits.
+ *
+ * @return False on a read error, with the errno in the chunk and the
+ *         bytes read before it kept
+ */
+static bool fill_chunk(int fd, chunk_t *chunk) {
+    uint64_t start = now_ns();
+    chunk->len = 0;
+    chunk->err = 0;
+    while (chunk->len < READER_CHUNK_BYTES) {
+        ssize_t len = read(fd, chunk->data + chunk->len,
+                           READER_CHUNK_BYTES - chunk->len);
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        if (len < 0) {
+            chunk->err = errno;
+            chunk->read_ns = now_ns() - start;
+            return false;
+        }
+        if (len == 0) {
+            break;
+        }
+        chunk->len += (size_t)len;
+    }
+    chunk->read_ns = now_ns() - start;
+    return true;
+}
+
+/** @brief Body of the background thread */
+static void *reader_thread(void *arg) {
+    csim_reader_t *reader = arg;
+    off_t off = lseek(reader->fd, 0, SEEK_CUR);
+    bool more = true;
+
+    while (more) {
+        pthread_mutex_lock(&reader->lock);
+        while (reader->filled == READER_CHUNKS && !reader->stop) {
+            pthread_cond_wait(&reader->free_cond, &reader->lock);
+        }
+        unsigned slot = (reader->tail + reader->filled) % READER_CHUNKS;
+        bool stop = reader->stop;
+        pthread_mutex_unlock(&reader->lock);
+        if (stop) {
+            break;
+        }
+
+        /* Keep the kernel reading beyond what the ring will hold */
+        if (off >= 0) {
+            off_t ahead = off + (off_t)READER_CHUNK_BYTES * READER_CHUNKS;
+            posix_fadvise(reader->fd, ahead, READER_AHEAD_BYTES,
+                          POSIX_FADV_WILLNEED);
+        }
+
+        chunk_t *chunk = &reader->chunks[slot];
+        more = fill_chunk(reader->fd, chunk) && chunk->len > 0;
+        if (off >= 0) {
+            off += (off_t)chunk->len;
+        }
+
+        pthread_mutex_lock(&reader->lock);
+        reader->filled++;
+        pthread_cond_signal(&reader->filled_cond);
+        pthread_mutex_unlock(&reader->lock);
+    }
+    return NULL;
+}
+
+csim_reader_t *reader_open(int fd) {
+    csim_reader_t *reader = calloc(1, sizeof(csim_reader_t));
+    if (reader == NULL) {
+        return NULL;
+    }
+    reader->fd = fd;
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->filled_cond, NULL);
+    pthread_cond_init(&reader->free_cond, NULL);
+    for (unsigned i = 0; i < READER_CHUNKS; i++) {
+        reader->chunks[i].data = malloc(READER_CHUNK_BYTES);
+        if (reader->chunks[i].data == NULL) {
+            reader_close(reader);
+            return NULL;
+        }
+    }
+
+    /* Fails harmlessly on pipes and other unseekable files */
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    reader->threaded =
+        pthread_create(&reader->thread, NULL, reader_thread, reader) == 0;
+    return reader;
+}
+
+/**
+ * @brief Takes the next chunk of the ring, waiting for it if it is not
+ *        published yet.
+ */
+static void take_chunk(csim_reader_t *reader) {
+    uint64_t start = now_ns();
+    if (reader->threaded) {
+        pthread_mutex_lock(&reader->lock);
+        while (reader->filled == 0) {
+            pthread_cond_wait(&reader->filled_cond, &reader->lock);
+        }
+        pthread_mutex_unlock(&reader->lock);
+    } else {
+        fill_chunk(reader->fd, &reader->chunks[reader->tail]);
+    }
+    reader->wait_ns += now_ns() - start;
+
+    const chunk_t *chunk = &reader->chunks[reader->tail];
+    reader->read_ns += chunk->read_ns;
+    reader->holding = true;
+    reader->pos = 0;
+    if (chunk->len == 0) {
+        reader->finished = true;
+        reader->err = chunk->err;
+    }
+}
+
+/** @brief Hands the used-up tail chunk back to the thread */
+static void release_chunk(csim_reader_t *reader) {
+    reader->holding = false;
+    if (!reader->threaded) {
+        return;
+    }
+    pthread_mutex_lock(&reader->lock);
+    reader->tail = (reader->tail + 1) % READER_CHUNKS;
+    reader->filled--;
+    pthread_cond_signal(&reader->free_cond);
+    pthread_mutex_unlock(&reader->lock);
+}
+
+ssize_t reader_read(csim_reader_t *reader, void *buf, size_t len) {
+    size_t copied = 0;
+    while (copied < len && !reader->finished) {
+        if (!reader->holding) {
+            take_chunk(reader);
+            continue;
+        }
+        const chunk_t *chunk = &reader->chunks[reader->tail];
+        size_t n = chunk->len - reader->pos;
+        if (n > len - copied) {
+            n = len - copied;
+        }
+        memcpy((char *)buf + copied, chunk->data + reader->pos, n);
+        copied += n;
+        reader->pos += n;
+        if (reader->pos == chunk->len) {
+            if (chunk->err != 0) {
+                reader->finished = true;
+                reader->err = chunk->err;
+            }
+            release_chunk(reader);
+        }
+    }
+
+    /* Hand out what was read before an error, and the error after it */
+    if (copied == 0 && reader->err != 0) {
+        errno = reader->err;
+        return -1;
+    }
+    return (ssize_t)copied;
+}
+
+uint64_t reader_wait_ns(const csim_reader_t *reader) {
+    return reader->wait_ns;
+}
+
+uint64_t reader_read_ns(const csim_reader_t *reader) {
+    return reader->read_ns;
+}
+
+void reader_close(csim_reader_t *reader) {
+    if (reader->threaded) {
+        pthread_mutex_lock(&reader->lock);
+        reader->stop = true;
+        pthread_cond_signal(&reader->free_cond);
+        pthread_mutex_unlock(&reader->lock);
+        pthread_join(reader->thread, NULL);
+    }
+    pthread_mutex_destroy(&reader->lock);
+    pthread_cond_destroy(&reader->filled_cond);
+    pthread_cond_destroy(&reader->free_cond);
+    for (unsigned i = 0; i < READER_CHUNKS; i++) {
+        free(reader->chunks[i].data);
+    }
+    free(reader);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file csim-reader.h
+ * @brief Read-ahead of text traces on a background thread
+ *
+ * A reader owns a file descriptor open for sequential reading, and keeps a
+ * ring of large chunks of it filled from a background thread, so that the
+ * parser finds the next chunk already in memory instead of waiting on the
+ * disk. The kernel is also told that the file is read sequentially, and
+ * asked to start reading the chunks after the ones in the ring.
+ *
+ * The time the consumer spends blocked waiting for data is counted, which
+ * is the part of the disk time that was not hidden behind parsing and
+ * simulation.
+ */
+
+#ifndef CSIM_READER_H
+#define CSIM_READER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/** @brief Opaque handle for a file being read ahead */
+typedef struct csim_reader csim_reader_t;
+
+/**
+ * @brief Starts reading a file ahead from its current offset.
+ *
+ * If the background thread cannot be started, the reader falls back to
+ * reading on demand, which is slower but otherwise identical.
+ *
+ * @param[in] fd  File to read, which the reader does not close
+ *
+ * @return The reader, or NULL if out of memory
+ */
+csim_reader_t *reader_open(int fd);
+
+/**
+ * @brief Reads the next bytes of the file, like read(2).
+ *
+ * @return The number of bytes copied into buf, which may be less than len,
+ *         0 at the end of the file, or -1 with errno set on a read error
+ */
+ssize_t reader_read(csim_reader_t *reader, void *buf, size_t len);
+
+/** @brief Returns the time spent waiting for data so far, in nanoseconds */
+uint64_t reader_wait_ns(const csim_reader_t *reader);
+
+/**
+ * @brief Returns the time spent reading the chunks taken so far, by
+ *        whichever thread read them, in nanoseconds
+ */
+uint64_t reader_read_ns(const csim_reader_t *reader);
+
+/** @brief Stops reading ahead and frees a reader */
+void reader_close(csim_reader_t *reader);
+
+#endif /* CSIM_READER_H */
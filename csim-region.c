@@ -0,0 +1,284 @@
+/**
+ * @file csim-region.c
+ * @brief Attribution of simulated accesses to named memory regions
+ *
+ * Regions are kept sorted by start address, so an address is found by a
+ * binary search over the starts. Traces touch one region for many accesses
+ * in a row, so the last region found is checked before searching.
+ */
+
+#define _XOPEN_SOURCE 700 // getline, strdup
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "csim-region.h"
+
+/** @brief Name of the implicit region holding every unmapped address */
+#define OTHER_NAME "(other)"
+
+/** @brief A named address range and the accesses attributed to it */
+typedef struct {
+    char *name;          /* NULL for the "(other)" region */
+    unsigned long start; /* first address */
+    unsigned long end;   /* one past the last address */
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;       /* evictions caused by its misses */
+    unsigned long dirty_evictions; /* dirty lines among those */
+} region_t;
+
+struct csim_regions {
+    region_t *regions; /* sorted by start, then the "(other)" region */
+    unsigned count;    /* number of named regions */
+    unsigned last;     /* region of the last lookup that found one */
+
+    /* evicted[evictor * (count + 1) + victim] */
+    unsigned long *evicted;
+};
+
+/** @brief Returns the name of a region */
+static const char *region_name(const region_t *region) {
+    return region->name != NULL ? region->name : OTHER_NAME;
+}
+
+static int compare_regions(const void *a, const void *b) {
+    const region_t *ra = a;
+    const region_t *rb = b;
+    if (ra->start != rb->start) {
+        return ra->start < rb->start ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Parses one line of the form "<name> <hex start> <hex end>".
+ *
+ * @return 1 if a region was parsed, 0 for blank and comment lines, and -1
+ *         if the line is malformed
+ */
+static int parse_line(char *line, region_t *region) {
+    char *p = line;
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    if (*p == '\0' || *p == '#') {
+        return 0;
+    }
+
+    char *name = p;
+    while (*p != '\0' && !isspace((unsigned char)*p)) {
+        p++;
+    }
+    if (*p == '\0') {
+        return -1;
+    }
+    *p++ = '\0';
+
+    char *end;
+    errno = 0;
+    region->start = strtoul(p, &end, 16);
+    if (end == p || !isspace((unsigned char)*end)) {
+        return -1;
+    }
+    p = end;
+    region->end = strtoul(p, &end, 16);
+    if (end == p || errno != 0) {
+        return -1;
+    }
+    while (isspace((unsigned char)*end)) {
+        end++;
+    }
+    if (*end != '\0' || region->start >= region->end) {
+        return -1;
+    }
+
+    region->name = strdup(name);
+    return region->name == NULL ? -1 : 1;
+}
+
+csim_regions_t *regions_load(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    csim_regions_t *regions = calloc(1, sizeof(csim_regions_t));
+    size_t capacity = 0;
+    char *line = NULL;
+    size_t line_cap = 0;
+    unsigned long line_num = 0;
+    bool ok = regions != NULL;
+    bool oom = !ok;
+
+    while (ok && getline(&line, &line_cap, fp) != -1) {
+        line_num++;
+        /* Keep room for the "(other)" region after the named ones */
+        if (regions->count + 1 >= capacity) {
+            capacity = capacity == 0 ? 8 : 2 * capacity;
+            region_t *grown =
+                realloc(regions->regions, capacity * sizeof(region_t));
+            if (grown == NULL) {
+                ok = false;
+                oom = true;
+                break;
+            }
+            regions->regions = grown;
+        }
+
+        region_t *region = &regions->regions[regions->count];
+        memset(region, 0, sizeof(region_t));
+        int res = parse_line(line, region);
+        if (res < 0) {
+            fprintf(stderr, "Error: malformed line %lu in '%s'\n", line_num,
+                    path);
+            ok = false;
+        } else if (res > 0) {
+            regions->count++;
+        }
+    }
+    free(line);
+    fclose(fp);
+
+    if (ok && regions->count == 0) {
+        fprintf(stderr, "Error: no regions in '%s'\n", path);
+        ok = false;
+    }
+
+    if (ok) {
+        qsort(regions->regions, regions->count, sizeof(region_t),
+              compare_regions);
+        for (unsigned i = 1; i < regions->count; i++) {
+            if (regions->regions[i].start < regions->regions[i - 1].end) {
+                fprintf(stderr, "Error: regions '%s' and '%s' overlap\n",
+                        regions->regions[i - 1].name,
+                        regions->regions[i].name);
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    if (ok) {
+        memset(&regions->regions[regions->count], 0, sizeof(region_t));
+        size_t n = (size_t)regions->count + 1;
+        regions->evicted = calloc(n * n, sizeof(unsigned long));
+        ok = regions->evicted != NULL;
+        oom = !ok;
+    }
+
+    if (!ok) {
+        if (oom) {
+            fprintf(stderr, "Error: insufficient memory to read '%s'\n",
+                    path);
+        }
+        regions_free(regions);
+        return NULL;
+    }
+    return regions;
+}
+
+unsigned regions_lookup(csim_regions_t *regions, unsigned long addr) {
+    const region_t *r = regions->regions;
+    unsigned last = regions->last;
+    if (addr >= r[last].start && addr < r[last].end) {
+        return last;
+    }
+
+    /* Find the last region starting at or below addr */
+    unsigned lo = 0;
+    unsigned hi = regions->count;
+    while (lo < hi) {
+        unsigned mid = lo + (hi - lo) / 2;
+        if (r[mid].start <= addr) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo > 0 && addr < r[lo - 1].end) {
+        regions->last = lo - 1;
+        return lo - 1;
+    }
+    return regions->count;
+}
+
+unsigned regions_count(const csim_regions_t *regions) {
+    return regions->count + 1;
+}
+
+const char *regions_name(const csim_regions_t *regions, unsigned region) {
+    return region_name(&regions->regions[region]);
+}
+
+unsigned long regions_start(const csim_regions_t *regions, unsigned region) {
+    return regions->regions[region].start;
+}
+
+void regions_record(csim_regions_t *regions, unsigned region,
+                    const csim_outcome_t *outcome) {
+    region_t *r = &regions->regions[region];
+    if (outcome->hit) {
+        r->hits++;
+        return;
+    }
+    r->misses++;
+    if (outcome->evicted) {
+        r->evictions++;
+        if (outcome->dirty_evicted) {
+            r->dirty_evictions++;
+        }
+        size_t n = (size_t)regions->count + 1;
+        regions->evicted[region * n + outcome->victim]++;
+    }
+}
+
+void regions_print(const csim_regions_t *regions, unsigned long block_bytes,
+                   FILE *out) {
+    unsigned n = regions->count + 1;
+    int width = (int)strlen(OTHER_NAME);
+    for (unsigned i = 0; i < n; i++) {
+        int len = (int)strlen(region_name(&regions->regions[i]));
+        width = len > width ? len : width;
+    }
+
+    fprintf(out, "%-*s %12s %12s %12s %12s\n", width, "Region", "Hits",
+            "Misses", "Evictions", "Dirty bytes");
+    for (unsigned i = 0; i < n; i++) {
+        const region_t *r = &regions->regions[i];
+        fprintf(out, "%-*s %12lu %12lu %12lu %12lu\n", width, region_name(r),
+                r->hits, r->misses, r->evictions,
+                r->dirty_evictions * block_bytes);
+    }
+
+    fprintf(out, "\nEvictions by region (row evicted column):\n%-*s", width,
+            "");
+    for (unsigned j = 0; j < n; j++) {
+        fprintf(out, " %12s", region_name(&regions->regions[j]));
+    }
+    fprintf(out, "\n");
+    for (unsigned i = 0; i < n; i++) {
+        fprintf(out, "%-*s", width, region_name(&regions->regions[i]));
+        for (unsigned j = 0; j < n; j++) {
+            fprintf(out, " %12lu", regions->evicted[(size_t)i * n + j]);
+        }
+        fprintf(out, "\n");
+    }
+}
+
+void regions_free(csim_regions_t *regions) {
+    if (regions == NULL) {
+        return;
+    }
+    for (unsigned i = 0; i < regions->count; i++) {
+        free(regions->regions[i].name);
+    }
+    free(regions->regions);
+    free(regions->evicted);
+    free(regions);
+}
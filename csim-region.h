@@ -0,0 +1,82 @@
+/**
+ * @file csim-region.h
+ * @brief Attribution of simulated accesses to named memory regions
+ *
+ * A region map names address ranges, such as the matrices of a traced
+ * transpose, one per line:
+ *
+ *     # name  start     end
+ *     A       7f000000  7f002000
+ *
+ * Addresses are hexadecimal, as in traces, and end is exclusive. Blank
+ * lines and lines starting with '#' are ignored. Ranges must not overlap.
+ *
+ * Every access is attributed to the region holding its address, or to an
+ * implicit "(other)" region, and every eviction to the pair of the region
+ * that caused it and the region that owned the evicted line.
+ */
+
+#ifndef CSIM_REGION_H
+#define CSIM_REGION_H
+
+#include <stdio.h>
+
+#include "csim-cache.h"
+
+/** @brief Opaque handle for a loaded region map and its statistics */
+typedef struct csim_regions csim_regions_t;
+
+/**
+ * @brief Loads a region map.
+ *
+ * @param[in] path  Path of the region map
+ *
+ * @return The regions, or NULL (after printing an error) if the map could
+ *         not be read or is malformed
+ */
+csim_regions_t *regions_load(const char *path);
+
+/**
+ * @brief Finds the region holding an address.
+ *
+ * @return The index of the region, which can be passed to
+ *         cache_access_owned() as the owner
+ */
+unsigned regions_lookup(csim_regions_t *regions, unsigned long addr);
+
+/**
+ * @brief Returns the number of regions, counting the "(other)" region,
+ *        which comes last.
+ */
+unsigned regions_count(const csim_regions_t *regions);
+
+/** @brief Returns the name of a region */
+const char *regions_name(const csim_regions_t *regions, unsigned region);
+
+/**
+ * @brief Returns the first address of a region, which is 0 for the
+ *        "(other)" region.
+ */
+unsigned long regions_start(const csim_regions_t *regions, unsigned region);
+
+/**
+ * @brief Records the outcome of an access to a region.
+ *
+ * @param[in] region   Index returned by regions_lookup() for the access
+ * @param[in] outcome  Outcome reported by cache_access_owned()
+ */
+void regions_record(csim_regions_t *regions, unsigned region,
+                    const csim_outcome_t *outcome);
+
+/**
+ * @brief Prints the statistics of each region and the eviction matrix.
+ *
+ * @param[in] block_bytes  Size of a cache block, to report dirty bytes
+ */
+void regions_print(const csim_regions_t *regions, unsigned long block_bytes,
+                   FILE *out);
+
+/** @brief Frees a region map */
+void regions_free(csim_regions_t *regions);
+
+#endif /* CSIM_REGION_H */
@@ -0,0 +1,652 @@
+/**
+ * @file csim-serve.c
+ * @brief Simulation server over a Unix domain socket
+ *
+ * The accept loop hands every connection to its own detached thread,
+ * which parses requests and answers them. Simulations are split into one
+ * job per configuration and queued for a fixed pool of worker threads, and
+ * the connection thread waits until all jobs of its request are done.
+ * On shutdown the server stops taking SIM requests, and waits for the
+ * workers to drain the queue and for the replies under way to be sent.
+ *
+ * All shared state (the job queue and the resident traces) is guarded by
+ * one lock, which is only held for bookkeeping, never while simulating or
+ * decoding. Resident traces are reference counted: the table holds one
+ * reference and each running SIM request another, so a trace that is
+ * dropped or evicted mid-request is freed when the request finishes.
+ */
+
+#define _XOPEN_SOURCE 700 // getline, strdup, strtok_r, mkstemp, sysconf
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "cachelab.h"
+#include "csim-cache.h"
+#include "csim-filter.h"
+#include "csim-serve.h"
+#include "csim-stats.h"
+#include "csim-trace.h"
+
+/** @brief Longest accepted trace name */
+#define SERVE_MAX_NAME 64
+
+/** @brief Size of the chunks an uploaded trace is copied in */
+#define UPLOAD_CHUNK 65536
+
+/** @brief A decoded trace kept in memory */
+typedef struct resident {
+    char *name;
+    csim_access_t *accesses;
+    size_t count;
+    size_t bytes;           /* memory held by accesses */
+    unsigned refs;          /* the table's, plus one per SIM request */
+    unsigned long last_use; /* value of server.clock when last used */
+    struct resident *next;
+} resident_t;
+
+/** @brief The jobs of one SIM request */
+typedef struct {
+    size_t pending;      /* jobs not done yet */
+    pthread_cond_t done; /* signaled when pending drops to 0 */
+} request_t;
+
+/** @brief Simulation of one trace on one configuration */
+typedef struct job {
+    const resident_t *trace;
+    unsigned long s;
+    unsigned long E;
+    unsigned long b;
+    csim_indexing_t indexing;
+    bool ok; /* the cache and its sets could be allocated */
+    csim_stats_t stats;
+    uint64_t ns;
+    request_t *request;
+    struct job *next;
+} job_t;
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work; /* signaled when a job is queued or on shutdown */
+    job_t *head;
+    job_t *tail;
+    bool stopping;
+    unsigned busy;       /* requests being answered */
+    pthread_cond_t idle; /* signaled when busy drops to 0 */
+
+    resident_t *traces;
+    size_t bytes; /* memory held by all resident traces */
+    size_t mem_limit;
+    unsigned long clock;
+
+    const char *cache_dir;
+    int listen_fd;
+} server = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work = PTHREAD_COND_INITIALIZER,
+    .idle = PTHREAD_COND_INITIALIZER,
+};
+
+/** @brief Drops a reference to a trace. Call with server.lock held. */
+static void release_trace(resident_t *trace) {
+    if (--trace->refs == 0) {
+        free(trace->name);
+        free(trace->accesses);
+        free(trace);
+    }
+}
+
+/** @brief Unlinks a trace from the table. Call with server.lock held. */
+static void unlink_trace(resident_t **link) {
+    resident_t *trace = *link;
+    *link = trace->next;
+    server.bytes -= trace->bytes;
+    release_trace(trace);
+}
+
+/** @brief Finds the link to a named trace. Call with server.lock held. */
+static resident_t **find_trace(const char *name) {
+    resident_t **link = &server.traces;
+    while (*link != NULL && strcmp((*link)->name, name) != 0) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+/**
+ * @brief Makes a decoded trace resident under its name, replacing any
+ *        trace of the same name, and evicts the least recently used
+ *        others until the traces fit the memory limit.
+ */
+static void install_trace(resident_t *trace) {
+    pthread_mutex_lock(&server.lock);
+    resident_t **link = find_trace(trace->name);
+    if (*link != NULL) {
+        unlink_trace(link);
+    }
+    trace->refs = 1;
+    trace->last_use = ++server.clock;
+    trace->next = server.traces;
+    server.traces = trace;
+    server.bytes += trace->bytes;
+
+    while (server.bytes > server.mem_limit && server.traces->next != NULL) {
+        resident_t **lru = NULL;
+        for (link = &server.traces->next; *link != NULL;
+             link = &(*link)->next) {
+            if (lru == NULL || (*link)->last_use < (*lru)->last_use) {
+                lru = link;
+            }
+        }
+        fprintf(stderr, "csim: evicting trace '%s'\n", (*lru)->name);
+        unlink_trace(lru);
+    }
+    pthread_mutex_unlock(&server.lock);
+}
+
+/**
+ * @brief Decodes a whole trace into memory.
+ *
+ * @return The trace, not yet resident, or NULL if it could not be decoded
+ */
+static resident_t *decode_trace(const char *name, const char *path,
+                                const char *cache_dir) {
+    resident_t *trace = calloc(1, sizeof(resident_t));
+    if (trace == NULL || (trace->name = strdup(name)) == NULL ||
+        !trace_load(path, cache_dir, &trace->accesses, &trace->count,
+                    &trace->bytes)) {
+        if (trace != NULL) {
+            free(trace->name);
+            free(trace);
+        }
+        return NULL;
+    }
+    return trace;
+}
+
+/** @brief Simulates the trace of a job on its configuration */
+static void run_job(job_t *job) {
+    uint64_t start = stats_now_ns();
+    csim_cache_t *cache =
+        cache_new_indexing(job->s, job->E, job->b, false, job->indexing);
+    job->ok = cache != NULL;
+    if (job->ok) {
+        run_filter_t filter;
+        run_filter_init(&filter, cache, job->b);
+        run_filter_batch(&filter, job->trace->accesses, job->trace->count);
+        job->ok = run_filter_flush(&filter);
+        cache_stats(cache, &job->stats);
+        cache_free(cache);
+    }
+    job->ns = stats_now_ns() - start;
+}
+
+/** @brief Runs queued jobs until the server stops and the queue drains */
+static void *worker(void *arg) {
+    pthread_mutex_lock(&server.lock);
+    for (;;) {
+        while (server.head == NULL && !server.stopping) {
+            pthread_cond_wait(&server.work, &server.lock);
+        }
+        job_t *job = server.head;
+        if (job == NULL) {
+            break;
+        }
+        server.head = job->next;
+        if (server.head == NULL) {
+            server.tail = NULL;
+        }
+        pthread_mutex_unlock(&server.lock);
+
+        run_job(job);
+
+        pthread_mutex_lock(&server.lock);
+        if (--job->request->pending == 0) {
+            pthread_cond_signal(&job->request->done);
+        }
+    }
+    pthread_mutex_unlock(&server.lock);
+    return NULL;
+}
+
+/** @brief Writes a failed response */
+static void reply_error(FILE *out, const char *msg) {
+    fprintf(out, "{\"ok\": false, \"error\": \"%s\"}\n", msg);
+}
+
+/**
+ * @brief Marks a connection as answering a request or done with it, for
+ *        shutdown to wait on.
+ */
+static void set_busy(bool *busy, bool now) {
+    if (*busy == now) {
+        return;
+    }
+    *busy = now;
+    pthread_mutex_lock(&server.lock);
+    if (now) {
+        server.busy++;
+    } else if (--server.busy == 0) {
+        pthread_cond_broadcast(&server.idle);
+    }
+    pthread_mutex_unlock(&server.lock);
+}
+
+/** @brief Checks that a trace name is a short word of safe characters */
+static bool valid_name(const char *name) {
+    size_t len = strlen(name);
+    if (len == 0 || len > SERVE_MAX_NAME) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char c = name[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+              (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '-')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Makes a decoded trace resident and replies to the LOAD or UPLOAD
+ *        of it. Once resident the trace may be dropped or evicted by
+ *        another connection at any time, so the reply only uses what was
+ *        read from it before.
+ */
+static void install_and_reply(FILE *out, const char *name,
+                              resident_t *trace) {
+    size_t count = trace->count;
+    install_trace(trace);
+    fprintf(out, "{\"ok\": true, \"trace\": \"%s\", \"records\": %zu}\n",
+            name, count);
+}
+
+static void handle_load(FILE *out, const char *name, const char *path) {
+    resident_t *trace = decode_trace(name, path, server.cache_dir);
+    if (trace == NULL) {
+        reply_error(out, "cannot decode trace");
+        return;
+    }
+    install_and_reply(out, name, trace);
+}
+
+/**
+ * @brief Decodes the trace text that follows an UPLOAD line, through a
+ *        temporary file so that it is parsed exactly like a trace file.
+ *
+ * The connection only counts as busy once the text has arrived, so that a
+ * client that stalls mid-upload does not hold up shutdown.
+ *
+ * @return false if the connection broke while reading the text
+ */
+static bool handle_upload(FILE *in, FILE *out, const char *name,
+                          size_t length, bool *busy) {
+    const char *tmpdir = getenv("TMPDIR");
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/csim-upload-XXXXXX",
+             tmpdir != NULL ? tmpdir : "/tmp");
+    int fd = mkstemp(path);
+    FILE *tmp = fd >= 0 ? fdopen(fd, "w") : NULL;
+
+    char chunk[UPLOAD_CHUNK];
+    bool write_ok = tmp != NULL;
+    while (length > 0) {
+        size_t want = length < sizeof(chunk) ? length : sizeof(chunk);
+        size_t got = fread(chunk, 1, want, in);
+        if (got == 0) {
+            if (tmp != NULL) {
+                fclose(tmp);
+            } else if (fd >= 0) {
+                close(fd);
+            }
+            if (fd >= 0) {
+                unlink(path);
+            }
+            return false;
+        }
+        if (write_ok && fwrite(chunk, 1, got, tmp) != got) {
+            write_ok = false;
+        }
+        length -= got;
+    }
+    set_busy(busy, true);
+
+    if (tmp == NULL) {
+        if (fd >= 0) {
+            close(fd);
+            unlink(path);
+        }
+        reply_error(out, "cannot store uploaded trace");
+        return true;
+    }
+    write_ok = fclose(tmp) == 0 && write_ok;
+    resident_t *trace = write_ok ? decode_trace(name, path, NULL) : NULL;
+    unlink(path);
+    if (trace == NULL) {
+        reply_error(out, "cannot decode trace");
+        return true;
+    }
+    install_and_reply(out, name, trace);
+    return true;
+}
+
+/** @brief Parses a configuration of the form "<s>,<E>,<b>" */
+static bool parse_config(const char *arg, job_t *job) {
+    char *end;
+    job->s = strtoul(arg, &end, 10);
+    if (*end++ != ',') {
+        return false;
+    }
+    job->E = strtoul(end, &end, 10);
+    if (*end++ != ',') {
+        return false;
+    }
+    job->b = strtoul(end, &end, 10);
+    return *end == '\0' && job->E > 0 && job->s + job->b <= 63;
+}
+
+static void handle_sim(FILE *out, const char *name, char **args,
+                       size_t num_args) {
+    job_t *jobs = calloc(num_args > 0 ? num_args : 1, sizeof(job_t));
+    if (jobs == NULL) {
+        reply_error(out, "insufficient memory");
+        return;
+    }
+
+    size_t num_jobs = 0;
+    csim_indexing_t indexing = CSIM_INDEXING_MODULO;
+    for (size_t i = 0; i < num_args; i++) {
+        if (strncmp(args[i], "policy=", 7) == 0) {
+            if (strcmp(args[i] + 7, "lru") != 0) {
+                reply_error(out, "unsupported policy");
+                free(jobs);
+                return;
+            }
+        } else if (strncmp(args[i], "index=", 6) == 0) {
+            if (!cache_indexing_parse(args[i] + 6, &indexing)) {
+                reply_error(out, "unsupported indexing");
+                free(jobs);
+                return;
+            }
+        } else if (!parse_config(args[i], &jobs[num_jobs++])) {
+            reply_error(out, "invalid configuration");
+            free(jobs);
+            return;
+        }
+    }
+    if (num_jobs == 0) {
+        reply_error(out, "no configurations");
+        free(jobs);
+        return;
+    }
+
+    request_t request = {.pending = num_jobs};
+    pthread_cond_init(&request.done, NULL);
+
+    pthread_mutex_lock(&server.lock);
+    if (server.stopping) {
+        /* The workers may be gone, and nothing would run the jobs */
+        pthread_mutex_unlock(&server.lock);
+        pthread_cond_destroy(&request.done);
+        reply_error(out, "server is shutting down");
+        free(jobs);
+        return;
+    }
+    resident_t *trace = *find_trace(name);
+    if (trace == NULL) {
+        pthread_mutex_unlock(&server.lock);
+        pthread_cond_destroy(&request.done);
+        reply_error(out, "unknown trace");
+        free(jobs);
+        return;
+    }
+    trace->refs++;
+    trace->last_use = ++server.clock;
+    for (size_t i = 0; i < num_jobs; i++) {
+        jobs[i].indexing = indexing;
+        jobs[i].trace = trace;
+        jobs[i].request = &request;
+        if (server.tail != NULL) {
+            server.tail->next = &jobs[i];
+        } else {
+            server.head = &jobs[i];
+        }
+        server.tail = &jobs[i];
+    }
+    pthread_cond_broadcast(&server.work);
+    while (request.pending > 0) {
+        pthread_cond_wait(&request.done, &server.lock);
+    }
+    release_trace(trace);
+    pthread_mutex_unlock(&server.lock);
+    pthread_cond_destroy(&request.done);
+
+    fprintf(out, "{\"ok\": true, \"trace\": \"%s\", \"results\": [", name);
+    for (size_t i = 0; i < num_jobs; i++) {
+        const job_t *job = &jobs[i];
+        fprintf(out, "%s{\"s\": %lu, \"E\": %lu, \"b\": %lu, ",
+                i == 0 ? "" : ", ", job->s, job->E, job->b);
+        if (!job->ok) {
+            fprintf(out, "\"ok\": false, \"error\": \"insufficient memory\"}");
+            continue;
+        }
+        fprintf(out,
+                "\"ok\": true, \"hits\": %lu, \"misses\": %lu, "
+                "\"evictions\": %lu, \"dirty_bytes_in_cache\": %lu, "
+                "\"dirty_bytes_evicted\": %lu, \"simulate_seconds\": %.6f}",
+                job->stats.hits, job->stats.misses, job->stats.evictions,
+                job->stats.dirty_bytes, job->stats.dirty_evictions,
+                (double)job->ns / 1e9);
+    }
+    fprintf(out, "]}\n");
+    free(jobs);
+}
+
+static void handle_drop(FILE *out, const char *name) {
+    pthread_mutex_lock(&server.lock);
+    resident_t **link = find_trace(name);
+    bool found = *link != NULL;
+    if (found) {
+        unlink_trace(link);
+    }
+    pthread_mutex_unlock(&server.lock);
+    if (found) {
+        fprintf(out, "{\"ok\": true}\n");
+    } else {
+        reply_error(out, "unknown trace");
+    }
+}
+
+static void handle_list(FILE *out) {
+    pthread_mutex_lock(&server.lock);
+    fprintf(out, "{\"ok\": true, \"traces\": [");
+    for (resident_t *t = server.traces; t != NULL; t = t->next) {
+        fprintf(out, "%s{\"name\": \"%s\", \"records\": %zu, \"bytes\": %zu}",
+                t == server.traces ? "" : ", ", t->name, t->count, t->bytes);
+    }
+    fprintf(out, "], \"bytes\": %zu, \"limit\": %zu}\n", server.bytes,
+            server.mem_limit);
+    pthread_mutex_unlock(&server.lock);
+}
+
+/** @brief Stops accepting connections and lets the workers drain */
+static void handle_shutdown(FILE *out) {
+    /* Answer before the accept loop can wake up and exit */
+    fprintf(out, "{\"ok\": true}\n");
+    fflush(out);
+    pthread_mutex_lock(&server.lock);
+    server.stopping = true;
+    pthread_cond_broadcast(&server.work);
+    pthread_mutex_unlock(&server.lock);
+    shutdown(server.listen_fd, SHUT_RDWR);
+}
+
+/** @brief Answers the requests of one client until it disconnects */
+static void *serve_client(void *arg) {
+    int fd = (int)(intptr_t)arg;
+    int out_fd = dup(fd);
+    FILE *in = fdopen(fd, "r");
+    FILE *out = out_fd >= 0 ? fdopen(out_fd, "w") : NULL;
+    if (in == NULL || out == NULL) {
+        if (in != NULL) {
+            fclose(in);
+        } else {
+            close(fd);
+        }
+        if (out_fd >= 0 && out == NULL) {
+            close(out_fd);
+        }
+        return NULL;
+    }
+
+    char *line = NULL;
+    size_t line_cap = 0;
+    bool open = true;
+    bool busy = false;
+    while (open && getline(&line, &line_cap, in) != -1) {
+        char *args[64];
+        size_t num_args = 0;
+        char *save;
+        for (char *tok = strtok_r(line, " \t\r\n", &save);
+             tok != NULL && num_args < 64;
+             tok = strtok_r(NULL, " \t\r\n", &save)) {
+            args[num_args++] = tok;
+        }
+        if (num_args == 0) {
+            continue;
+        }
+        const char *cmd = args[0];
+        if (strcmp(cmd, "UPLOAD") != 0) {
+            set_busy(&busy, true);
+        }
+        if (num_args >= 2 && !valid_name(args[1])) {
+            reply_error(out, "invalid trace name");
+        } else if (strcmp(cmd, "LOAD") == 0 && num_args == 3) {
+            handle_load(out, args[1], args[2]);
+        } else if (strcmp(cmd, "UPLOAD") == 0 && num_args == 3) {
+            char *end;
+            size_t length = strtoul(args[2], &end, 10);
+            if (*end != '\0') {
+                reply_error(out, "invalid length");
+                open = false;
+            } else {
+                open = handle_upload(in, out, args[1], length, &busy);
+            }
+        } else if (strcmp(cmd, "SIM") == 0 && num_args >= 3) {
+            handle_sim(out, args[1], &args[2], num_args - 2);
+        } else if (strcmp(cmd, "DROP") == 0 && num_args == 2) {
+            handle_drop(out, args[1]);
+        } else if (strcmp(cmd, "LIST") == 0 && num_args == 1) {
+            handle_list(out);
+        } else if (strcmp(cmd, "SHUTDOWN") == 0 && num_args == 1) {
+            handle_shutdown(out);
+            open = false;
+        } else {
+            reply_error(out, "invalid request");
+        }
+        open = fflush(out) == 0 && open;
+        set_busy(&busy, false);
+    }
+
+    free(line);
+    fclose(in);
+    fclose(out);
+    return NULL;
+}
+
+int serve_main(const char *path, const char *cache_dir, unsigned threads,
+               size_t mem_limit) {
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Error: socket path '%s' is too long\n", path);
+        return 1;
+    }
+    strcpy(addr.sun_path, path);
+
+    server.cache_dir = cache_dir;
+    server.mem_limit = mem_limit;
+    server.listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path);
+    if (server.listen_fd < 0 ||
+        bind(server.listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(server.listen_fd, SOMAXCONN) != 0) {
+        fprintf(stderr, "Error: cannot listen on '%s': %s\n", path,
+                strerror(errno));
+        return 1;
+    }
+
+    /* Clients that hang up early must not kill the server */
+    signal(SIGPIPE, SIG_IGN);
+
+    if (threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (unsigned)cpus : 1;
+    }
+    pthread_t *workers = calloc(threads, sizeof(pthread_t));
+    if (workers == NULL) {
+        fprintf(stderr, "Error: insufficient memory for workers\n");
+        return 1;
+    }
+    unsigned started = 0;
+    while (started < threads &&
+           pthread_create(&workers[started], NULL, worker, NULL) == 0) {
+        started++;
+    }
+    if (started == 0) {
+        fprintf(stderr, "Error: cannot start worker threads\n");
+        free(workers);
+        return 1;
+    }
+    fprintf(stderr, "csim: serving on '%s' with %u threads\n", path,
+            started);
+
+    for (;;) {
+        int fd = accept(server.listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        pthread_t client;
+        if (pthread_create(&client, NULL, serve_client,
+                           (void *)(intptr_t)fd) != 0) {
+            close(fd);
+            continue;
+        }
+        pthread_detach(client);
+    }
+
+    pthread_mutex_lock(&server.lock);
+    bool stopping = server.stopping;
+    server.stopping = true;
+    pthread_cond_broadcast(&server.work);
+    pthread_mutex_unlock(&server.lock);
+    for (unsigned i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    pthread_mutex_lock(&server.lock);
+    while (server.busy > 0) {
+        pthread_cond_wait(&server.idle, &server.lock);
+    }
+    pthread_mutex_unlock(&server.lock);
+    free(workers);
+    close(server.listen_fd);
+    unlink(path);
+
+    if (!stopping) {
+        fprintf(stderr, "Error: accept failed: %s\n", strerror(errno));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file csim-serve.h
+ * @brief Simulation server over a Unix domain socket
+ *
+ * `csim --serve=<socket>` keeps decoded traces in memory and runs
+ * simulation jobs on a pool of threads, so that scripts which simulate
+ * the same traces many times pay for process startup and parsing once.
+ *
+ * Clients send one request per line, and get one line of JSON back, which
+ * always holds "ok" and, when ok is false, "error":
+ *
+ *     LOAD <name> <path>          decode the trace at path as <name>
+ *     UPLOAD <name> <length>      decode the <length> bytes of trace text
+ *                                 that follow the line as <name>
+ *     SIM <name> <s>,<E>,<b>...   simulate <name> on each configuration, in
+ *         [policy=lru]            parallel, and return their statistics in
+ *         [index=<f>]             order as "results"; index is one of the
+ *                                 indexing functions of csim --index
+ *     DROP <name>                 forget <name>
+ *     LIST                        list the resident traces as "traces"
+ *     SHUTDOWN                    stop the server; SIM requests after it
+ *                                 fail, ones under way are answered
+ *
+ * Names are single words. Loading a name again replaces its trace. When
+ * the decoded traces outgrow the memory limit, the least recently used
+ * ones are dropped; a trace is freed once the jobs using it finish.
+ */
+
+#ifndef CSIM_SERVE_H
+#define CSIM_SERVE_H
+
+#include <stddef.h>
+
+/** @brief Default limit on the memory of resident traces, in MiB */
+#define SERVE_DEFAULT_MEM_MB 1024
+
+/**
+ * @brief Serves requests on a Unix domain socket until SHUTDOWN.
+ *
+ * @param[in] path       Path of the socket, replaced if it exists
+ * @param[in] cache_dir  Directory of decoded-trace sidecars, or NULL
+ * @param[in] threads    Number of simulation threads, or 0 for one per CPU
+ * @param[in] mem_limit  Limit on the memory of resident traces, in bytes
+ *
+ * @return 0 after a clean shutdown, 1 if the server could not start
+ */
+int serve_main(const char *path, const char *cache_dir, unsigned threads,
+               size_t mem_limit);
+
+#endif /* CSIM_SERVE_H */
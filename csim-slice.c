@@ -0,0 +1,479 @@
+/**
+ * @file csim-slice.c
+ * @brief Time-sliced parallel simulation of one decoded trace
+ *
+ * Slice k covers records [k * count / slices, (k + 1) * count / slices)
+ * and warms up on the records before it, which belong to the slices
+ * before it. The slices are run by a pool of one thread per CPU, the
+ * calling thread included, which take them in order. Statistics are taken
+ * before and after the counted records, so a slice contributes their
+ * difference, and only the last slice's cache tells which bytes are dirty
+ * at the end.
+ *
+ * The calling thread also reconciles the slices in order, as soon as each
+ * one is done, running it itself if no worker has taken it yet. In exact
+ * mode, the cache that ended the slice before is the sequential state
+ * where the next slice starts, so a slice whose saved start state equals
+ * it is kept as it is. Any other slice is simulated again on that cache,
+ * but only up to the first of its checkpoints where the two states meet:
+ * from there on its own run is exact, and the rest of it is adopted. So
+ * that finished slices waiting to be reconciled do not hold too many
+ * caches, workers stay at most SLICE_WINDOW slices per thread ahead.
+ *
+ * Each thread of the pool times its own work in a counter of its own,
+ * and the counters are added up once the workers have been joined.
+ */
+
+#define _XOPEN_SOURCE 700 // sysconf
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "csim-filter.h"
+#include "csim-slice.h"
+#include "csim-stats.h"
+
+/** @brief Slices per thread that may be done but not yet reconciled */
+#define SLICE_WINDOW 2
+
+/** @brief One slice and what it measured */
+typedef struct {
+    size_t warm_begin; /* first record of the warm-up */
+    size_t begin;      /* first record counted */
+    size_t end;        /* one past the last record counted */
+    size_t checkpoint[SLICE_CHECKPOINTS]; /* records where state is saved */
+    unsigned num_checkpoints;
+
+    csim_cache_t *cache; /* state at the end, if kept */
+    csim_cache_t *start; /* state after the warm-up, in exact mode */
+    csim_cache_t *saved[SLICE_CHECKPOINTS]; /* state at each checkpoint */
+    bool ok;
+    bool done;           /* guarded by the pool's lock */
+    csim_stats_t before; /* statistics after the warm-up */
+    csim_stats_t at[SLICE_CHECKPOINTS]; /* statistics at each checkpoint */
+    csim_stats_t after;  /* statistics at the end */
+    unsigned long accesses;
+} slice_t;
+
+/** @brief The slices of a run and the threads taking them */
+typedef struct {
+    const csim_access_t *records;
+    unsigned long s, E, b;
+    csim_indexing_t indexing;
+    bool exact;
+    slice_t *slice;
+    unsigned slices;
+    unsigned window; /* most slices taken past the last reconciled one */
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    unsigned next;       /* next slice to take */
+    unsigned reconciled; /* slices reconciled so far */
+    bool failed;         /* stop taking slices */
+} pool_t;
+
+/** @brief A thread of the pool and its own counters */
+typedef struct {
+    pool_t *pool;
+    pthread_t thread;
+    uint64_t busy_ns; /* time spent simulating */
+} worker_t;
+
+/**
+ * @brief Simulates records on a cache.
+ *
+ * @param[in,out] accesses  Count of accesses, not counting markers, that
+ *                          those of the records are added to
+ *
+ * @return false if a set of the cache could not be allocated
+ */
+static bool simulate(csim_cache_t *cache, unsigned long b,
+                     const csim_access_t *records, size_t count,
+                     unsigned long *accesses) {
+    run_filter_t filter;
+    run_filter_init(&filter, cache, b);
+    *accesses += run_filter_batch(&filter, records, count);
+    return run_filter_flush(&filter);
+}
+
+/** @brief Warms a slice up and simulates it, saving its checkpoints */
+static void run_slice(const pool_t *pool, unsigned k) {
+    slice_t *slice = &pool->slice[k];
+    csim_cache_t *cache = cache_new_indexing(pool->s, pool->E, pool->b,
+                                             false, pool->indexing);
+    if (cache == NULL) {
+        return;
+    }
+    unsigned long warmed = 0;
+    if (!simulate(cache, pool->b, pool->records + slice->warm_begin,
+                  slice->begin - slice->warm_begin, &warmed)) {
+        cache_free(cache);
+        return;
+    }
+    cache_stats(cache, &slice->before);
+    if (pool->exact && k > 0 && (slice->start = cache_clone(cache)) == NULL) {
+        cache_free(cache);
+        return;
+    }
+
+    size_t pos = slice->begin;
+    for (unsigned j = 0; j < slice->num_checkpoints; j++) {
+        if (!simulate(cache, pool->b, pool->records + pos,
+                      slice->checkpoint[j] - pos, &slice->accesses)) {
+            cache_free(cache);
+            return;
+        }
+        pos = slice->checkpoint[j];
+        cache_stats(cache, &slice->at[j]);
+        if ((slice->saved[j] = cache_clone(cache)) == NULL) {
+            cache_free(cache);
+            return;
+        }
+    }
+    if (!simulate(cache, pool->b, pool->records + pos, slice->end - pos,
+                  &slice->accesses)) {
+        cache_free(cache);
+        return;
+    }
+    cache_stats(cache, &slice->after);
+
+    /* Only exact mode can adopt a slice's end state, besides the last */
+    if (pool->exact || k + 1 == pool->slices) {
+        slice->cache = cache;
+    } else {
+        cache_free(cache);
+    }
+    slice->ok = true;
+}
+
+/** @brief Runs a slice, timing it on the thread that runs it */
+static void time_slice(worker_t *self, unsigned k) {
+    uint64_t start = stats_now_ns();
+    run_slice(self->pool, k);
+    self->busy_ns += stats_now_ns() - start;
+}
+
+/** @brief Body of a worker thread of the pool */
+static void *pool_worker(void *arg) {
+    worker_t *self = arg;
+    pool_t *pool = self->pool;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->failed && pool->next < pool->slices &&
+               pool->next >= pool->reconciled + pool->window) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        }
+        if (pool->failed || pool->next == pool->slices) {
+            break;
+        }
+        unsigned k = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        time_slice(self, k);
+        pthread_mutex_lock(&pool->lock);
+        pool->slice[k].done = true;
+        pthread_cond_broadcast(&pool->cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/** @brief Waits for a slice to be done, running it if no worker took it */
+static void await_slice(worker_t *self, unsigned k) {
+    pool_t *pool = self->pool;
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->slice[k].done && pool->next > k) {
+        pthread_cond_wait(&pool->cond, &pool->lock);
+    }
+    bool take = !pool->slice[k].done;
+    if (take) {
+        pool->next++;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    if (take) {
+        time_slice(self, k);
+        pool->slice[k].done = true;
+    }
+}
+
+/** @brief Returns count * k / slices, without overflowing */
+static size_t slice_start(size_t count, unsigned slices, unsigned k) {
+    return count / slices * k + count % slices * k / slices;
+}
+
+/** @brief Adds the statistics gathered between two snapshots */
+static void add_delta(csim_stats_t *total, const csim_stats_t *before,
+                      const csim_stats_t *after) {
+    total->hits += after->hits - before->hits;
+    total->misses += after->misses - before->misses;
+    total->evictions += after->evictions - before->evictions;
+    total->dirty_evictions +=
+        after->dirty_evictions - before->dirty_evictions;
+}
+
+/** @brief Frees what a slice still holds */
+static void free_slice(slice_t *slice) {
+    if (slice->cache != NULL) {
+        cache_free(slice->cache);
+        slice->cache = NULL;
+    }
+    if (slice->start != NULL) {
+        cache_free(slice->start);
+        slice->start = NULL;
+    }
+    for (unsigned j = 0; j < slice->num_checkpoints; j++) {
+        if (slice->saved[j] != NULL) {
+            cache_free(slice->saved[j]);
+            slice->saved[j] = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Simulates a slice in exact mode again, on the sequential state
+ *        before it, until that state meets the slice's own at a
+ *        checkpoint.
+ *
+ * @param[in,out] last      Sequential state before the slice, and after it
+ * @param[in,out] accesses  Count that the accesses simulated again are
+ *                          added to
+ *
+ * @return false if a set of the cache could not be allocated
+ */
+static bool resimulate(const pool_t *pool, slice_t *slice,
+                       csim_cache_t **last, csim_stats_t *stats,
+                       unsigned long *accesses) {
+    csim_stats_t from, to;
+    cache_stats(*last, &from);
+    size_t pos = slice->begin;
+    for (unsigned j = 0; j < slice->num_checkpoints; j++) {
+        if (!simulate(*last, pool->b, pool->records + pos,
+                      slice->checkpoint[j] - pos, accesses)) {
+            return false;
+        }
+        pos = slice->checkpoint[j];
+        if (cache_same_state(*last, slice->saved[j])) {
+            /* The rest of the slice's own run is exact */
+            cache_stats(*last, &to);
+            add_delta(stats, &from, &to);
+            add_delta(stats, &slice->at[j], &slice->after);
+            cache_free(*last);
+            *last = slice->cache;
+            slice->cache = NULL;
+            return true;
+        }
+    }
+    if (!simulate(*last, pool->b, pool->records + pos, slice->end - pos,
+                  accesses)) {
+        return false;
+    }
+    cache_stats(*last, &to);
+    add_delta(stats, &from, &to);
+    return true;
+}
+
+/**
+ * @brief Counts a finished slice into the statistics.
+ *
+ * @param[in,out] last  Cache that ended the slice before, then this one
+ *
+ * @return false if the slice had to be simulated again and a set of the
+ *         cache could not be allocated
+ */
+static bool reconcile(const pool_t *pool, unsigned k, csim_cache_t **last,
+                      csim_stats_t *stats, csim_slice_report_t *report) {
+    slice_t *slice = &pool->slice[k];
+    report->accesses += slice->accesses;
+    if (pool->exact && k > 0 && !cache_same_state(slice->start, *last)) {
+        if (!resimulate(pool, slice, last, stats,
+                        &report->resimulated_accesses)) {
+            return false;
+        }
+        report->resimulated++;
+    } else {
+        if (k > 0 && !pool->exact) {
+            report->uncertain +=
+                (slice->after.misses - slice->before.misses) -
+                (slice->after.evictions - slice->before.evictions);
+        }
+        add_delta(stats, &slice->before, &slice->after);
+        if (slice->cache != NULL) {
+            if (*last != NULL) {
+                cache_free(*last);
+            }
+            *last = slice->cache;
+            slice->cache = NULL;
+        }
+    }
+    free_slice(slice);
+    return true;
+}
+
+/** @brief Lays the slices and their checkpoints out over the trace */
+static void plan_slices(slice_t *slice, unsigned slices, size_t count,
+                        unsigned long warmup, bool exact) {
+    for (unsigned k = 0; k < slices; k++) {
+        slice[k].begin = slice_start(count, slices, k);
+        slice[k].end = slice_start(count, slices, k + 1);
+        slice[k].warm_begin =
+            slice[k].begin > warmup ? slice[k].begin - warmup : 0;
+        if (!exact || k == 0) {
+            continue;
+        }
+
+        /* A diverged state mostly meets its own within another warm-up */
+        size_t length = slice[k].end - slice[k].begin;
+        size_t step = length / (SLICE_CHECKPOINTS + 1);
+        if (warmup > 0 && warmup < step) {
+            step = warmup;
+        }
+        for (unsigned j = 0; step > 0 && j < SLICE_CHECKPOINTS; j++) {
+            slice[k].checkpoint[j] = slice[k].begin + (j + 1) * step;
+            slice[k].num_checkpoints++;
+        }
+    }
+}
+
+csim_cache_t *slice_simulate(const csim_access_t *records, size_t count,
+                             unsigned long s, unsigned long E,
+                             unsigned long b, csim_indexing_t indexing,
+                             unsigned slices, unsigned long warmup,
+                             bool exact, csim_stats_t *stats,
+                             csim_slice_report_t *report) {
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > (long)slices) {
+        threads = (long)slices;
+    }
+    pool_t pool = {
+        .records = records,
+        .s = s,
+        .E = E,
+        .b = b,
+        .indexing = indexing,
+        .exact = exact,
+        .slices = slices,
+        .window = exact ? SLICE_WINDOW * (unsigned)threads : slices,
+    };
+    pool.slice = calloc(slices, sizeof(slice_t));
+    worker_t *workers = calloc((size_t)threads, sizeof(worker_t));
+    if (pool.slice == NULL || workers == NULL) {
+        fprintf(stderr, "Error: insufficient memory for %u slices\n",
+                slices);
+        free(pool.slice);
+        free(workers);
+        return NULL;
+    }
+    if (warmup == SLICE_WARMUP_AUTO) {
+        unsigned long length = count / slices;
+        warmup = length;
+        if (s < 64 && E <= (length / SLICE_WARMUP_PER_LINE) >> s) {
+            warmup = (E << s) * SLICE_WARMUP_PER_LINE;
+        }
+    }
+    plan_slices(pool.slice, slices, count, warmup, exact);
+
+    /* The calling thread is one of the pool, the last one */
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.cond, NULL);
+    for (long t = 0; t < threads; t++) {
+        workers[t].pool = &pool;
+    }
+    worker_t *self = &workers[threads - 1];
+    long started = 0;
+    while (started < threads - 1 &&
+           pthread_create(&workers[started].thread, NULL, pool_worker,
+                          &workers[started]) == 0) {
+        started++;
+    }
+
+    *report = (csim_slice_report_t){
+        .slices = slices,
+        .warmup = warmup,
+        .bounded = indexing != CSIM_INDEXING_SKEW,
+        .exact = exact,
+    };
+    *stats = (csim_stats_t){0};
+    csim_cache_t *last = NULL;
+    bool ok = true;
+    for (unsigned k = 0; k < slices; k++) {
+        await_slice(self, k);
+        ok = pool.slice[k].ok;
+        if (ok) {
+            uint64_t start = stats_now_ns();
+            ok = reconcile(&pool, k, &last, stats, report);
+            self->busy_ns += stats_now_ns() - start;
+        }
+        pthread_mutex_lock(&pool.lock);
+        pool.reconciled = k + 1;
+        pool.failed = !ok;
+        pthread_cond_broadcast(&pool.cond);
+        pthread_mutex_unlock(&pool.lock);
+        if (!ok) {
+            break;
+        }
+    }
+
+    for (long t = 0; t < started; t++) {
+        pthread_join(workers[t].thread, NULL);
+    }
+    report->threads = (unsigned)started + 1;
+    for (long t = 0; t < threads; t++) {
+        report->busy_ns += workers[t].busy_ns;
+    }
+    for (unsigned k = 0; k < slices; k++) {
+        free_slice(&pool.slice[k]);
+    }
+    pthread_cond_destroy(&pool.cond);
+    pthread_mutex_destroy(&pool.lock);
+    free(workers);
+    free(pool.slice);
+    if (!ok) {
+        fprintf(stderr, "Error: insufficient memory for the slice caches\n");
+        if (last != NULL) {
+            cache_free(last);
+        }
+        return NULL;
+    }
+
+    csim_stats_t end;
+    cache_stats(last, &end);
+    stats->dirty_bytes = end.dirty_bytes;
+    return last;
+}
+
+void slice_print(FILE *out, const csim_slice_report_t *report) {
+    fprintf(out, "Slices: %u, each warmed up on %lu accesses\n",
+            report->slices, report->warmup);
+    if (report->exact) {
+        fprintf(out,
+                "Slice error: none, %u of %u slices simulated again from "
+                "the state before them,\n             for %lu of %lu "
+                "accesses\n",
+                report->resimulated, report->slices,
+                report->resimulated_accesses, report->accesses);
+        return;
+    }
+    double percent = 0.0;
+    if (report->accesses > 0) {
+        percent = 100.0 * (double)report->uncertain /
+                  (double)report->accesses;
+    }
+    if (!report->bounded) {
+        fprintf(out,
+                "Slice error: not bounded under skewed indexing, %lu misses "
+                "(%.3f%% of accesses) filled an empty line\n",
+                report->uncertain, percent);
+    } else {
+        fprintf(out,
+                "Slice error: hits, misses and evictions are each within %lu "
+                "(%.3f%% of accesses)\n",
+                report->uncertain, percent);
+    }
+    fprintf(out, "Warning: dirty bytes, in the cache and evicted, are not "
+                 "bounded; use\n         --slices-exact for exact ones\n");
+}
@@ -0,0 +1,104 @@
+/**
+ * @file csim-slice.h
+ * @brief Time-sliced parallel simulation of one decoded trace
+ *
+ * The trace is cut into contiguous slices that are simulated at the same
+ * time, each on a cache of its own that starts empty. Before counting
+ * anything, a slice warms its cache up on the accesses just before it, so
+ * that it starts from nearly the state a sequential run would be in.
+ *
+ * A slice can only go wrong where its cache holds fewer lines than the
+ * sequential one: on a miss that fills an empty line, which the
+ * sequential run may have found cached or taken by evicting another line.
+ * Under every indexing but skew, each set is an LRU stack that depends on
+ * its own accesses only, so the hits, misses and evictions of the sliced
+ * run are each within that many of the sequential ones. Dirty bytes have
+ * no such bound, and neither does skewed indexing, where a full set of
+ * candidates can still hold other lines than the sequential run's.
+ *
+ * In exact mode, the state each slice started from is compared with the
+ * state the slice before it ended in, once that one is known to be exact.
+ * Slices whose warm-up reached the same state are exact as they are. Those
+ * that diverged are simulated again from the previous state, but only up
+ * to the first of their checkpoints where the two states meet; the rest
+ * of the slice's own run is exact and is kept.
+ */
+
+#ifndef CSIM_SLICE_H
+#define CSIM_SLICE_H
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cachelab.h"
+#include "csim-cache.h"
+#include "csim-trace.h"
+
+/** @brief Most slices a trace is cut into */
+#define SLICE_MAX 1024
+
+/**
+ * @brief Points in each slice, a warm-up apart, where exact mode saves the
+ *        state for a re-simulation to meet
+ */
+#define SLICE_CHECKPOINTS 4
+
+/**
+ * @brief Default warm-up, in accesses per line of the cache, which is
+ *        never longer than a slice
+ */
+#define SLICE_WARMUP_PER_LINE 4
+
+/** @brief Warm-up argument that asks for the default */
+#define SLICE_WARMUP_AUTO ULONG_MAX
+
+/** @brief How a sliced run went */
+typedef struct {
+    unsigned slices;          /* slices simulated */
+    unsigned long warmup;     /* accesses each slice warmed up on */
+    unsigned long accesses;   /* accesses simulated, not counting warm-up */
+    unsigned long uncertain;  /* misses after a warm-up that filled an
+                                 empty line, or 0 in exact mode */
+    bool bounded;             /* uncertain bounds the error (not skewed) */
+    bool exact;               /* results equal those of a sequential run */
+    unsigned resimulated;     /* slices simulated again in exact mode */
+    unsigned long resimulated_accesses; /* accesses simulated again */
+    unsigned threads;         /* threads the slices ran on */
+    uint64_t busy_ns;         /* time spent simulating, summed over them */
+} csim_slice_report_t;
+
+/**
+ * @brief Simulates a decoded trace in slices, on a thread per CPU.
+ *
+ * @param[in]  records   Decoded trace, markers included
+ * @param[in]  count     Number of records
+ * @param[in]  s         Number of set index bits
+ * @param[in]  E         Associativity
+ * @param[in]  b         Number of block bits
+ * @param[in]  indexing  Indexing function of the sets
+ * @param[in]  slices    Number of slices, at most SLICE_MAX
+ * @param[in]  warmup    Accesses to warm up on before each slice, or
+ *                       SLICE_WARMUP_AUTO for the default
+ * @param[in]  exact     Simulate diverged slices again until they meet
+ *                       their own run
+ * @param[out] stats     Statistics of the whole trace
+ * @param[out] report    How the run went
+ *
+ * @return The cache that simulated the end of the trace, for the caller
+ *         to inspect and free, or NULL (after printing an error) if the
+ *         caches could not be allocated
+ */
+csim_cache_t *slice_simulate(const csim_access_t *records, size_t count,
+                             unsigned long s, unsigned long E,
+                             unsigned long b, csim_indexing_t indexing,
+                             unsigned slices, unsigned long warmup,
+                             bool exact, csim_stats_t *stats,
+                             csim_slice_report_t *report);
+
+/** @brief Writes a summary of a sliced run after the statistics */
+void slice_print(FILE *out, const csim_slice_report_t *report);
+
+#endif /* CSIM_SLICE_H */
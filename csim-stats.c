@@ -0,0 +1,153 @@
+/**
+ * @file csim-stats.c
+ * @brief Self-profiling counters and machine-readable statistics for csim
+ */
+
+#define _XOPEN_SOURCE 700 // clock_gettime, getrusage
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "csim-stats.h"
+
+uint64_t stats_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/** @brief Adds one set's counter to a histogram */
+static void hist_add(stats_hist_t *hist, unsigned long value) {
+    unsigned bucket = 0;
+    while (value != 0) {
+        bucket++;
+        value >>= 1;
+    }
+    hist->buckets[bucket]++;
+    if (bucket + 1 > hist->used) {
+        hist->used = bucket + 1;
+    }
+}
+
+/** @brief Adds the counters of one set to the histograms of a profile */
+static void collect_set(void *arg, unsigned long set,
+                        const csim_set_stats_t *stats) {
+    csim_profile_t *profile = arg;
+    hist_add(&profile->occupancy, stats->valid);
+    hist_add(&profile->evictions, stats->evictions);
+}
+
+void stats_collect_sets(csim_profile_t *profile, const csim_cache_t *cache) {
+    profile->num_sets = cache_num_sets(cache);
+    profile->sparse_sets = cache_is_sparse(cache);
+    profile->fixed_engine = cache_is_fixed(cache);
+    memset(&profile->occupancy, 0, sizeof(stats_hist_t));
+    memset(&profile->evictions, 0, sizeof(stats_hist_t));
+
+    /* Sets that were never touched are empty and never evicted */
+    unsigned long untouched =
+        profile->num_sets - cache_each_set(cache, collect_set, profile);
+    if (untouched > 0) {
+        profile->occupancy.buckets[0] += untouched;
+        profile->evictions.buckets[0] += untouched;
+        if (profile->occupancy.used == 0) {
+            profile->occupancy.used = 1;
+        }
+        if (profile->evictions.used == 0) {
+            profile->evictions.used = 1;
+        }
+    }
+}
+
+/** @brief Writes a string as a JSON string literal */
+static void print_json_string(FILE *out, const char *str) {
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)str; *p != '\0';
+         p++) {
+        if (*p == '"' || *p == '\\') {
+            fprintf(out, "\\%c", *p);
+        } else if (*p < 0x20) {
+            fprintf(out, "\\u%04x", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fputc('"', out);
+}
+
+/**
+ * @brief Writes the nonempty buckets of a histogram as an array of
+ *        {min, max, sets} objects.
+ */
+static void print_json_hist(FILE *out, const stats_hist_t *hist) {
+    const char *sep = "";
+    fprintf(out, "[");
+    for (unsigned k = 0; k < hist->used; k++) {
+        if (hist->buckets[k] == 0) {
+            continue;
+        }
+        unsigned long min = k == 0 ? 0 : 1UL << (k - 1);
+        unsigned long max = k == 0 ? 0 : (min - 1) + min;
+        fprintf(out, "%s{\"min\": %lu, \"max\": %lu, \"sets\": %lu}", sep,
+                min, max, hist->buckets[k]);
+        sep = ", ";
+    }
+    fprintf(out, "]");
+}
+
+void stats_print_json(FILE *out, const char *trace, unsigned long s,
+                      unsigned long E, unsigned long b,
+                      const csim_stats_t *stats,
+                      const csim_profile_t *profile) {
+    struct rusage usage;
+    long peak_rss_kb = 0;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        peak_rss_kb = usage.ru_maxrss;
+    }
+
+    double parse_s = (double)profile->parse_ns / 1e9;
+    double simulate_s = (double)profile->simulate_ns / 1e9;
+    double io_wait_s = (double)profile->io_wait_ns / 1e9;
+    double io_read_s = (double)profile->io_read_ns / 1e9;
+    double rate =
+        simulate_s > 0 ? (double)profile->accesses / simulate_s : 0.0;
+
+    fprintf(out, "{\n  \"trace\": ");
+    print_json_string(out, trace);
+    fprintf(out, ",\n  \"cache\": {\"s\": %lu, \"E\": %lu, \"b\": %lu},\n", s,
+            E, b);
+    fprintf(out,
+            "  \"stats\": {\"hits\": %lu, \"misses\": %lu, "
+            "\"evictions\": %lu, \"dirty_bytes_in_cache\": %lu, "
+            "\"dirty_bytes_evicted\": %lu},\n",
+            stats->hits, stats->misses, stats->evictions, stats->dirty_bytes,
+            stats->dirty_evictions);
+    fprintf(out,
+            "  \"profile\": {\"accesses\": %lu, \"trace_cached\": %s, "
+            "\"fixed_engine\": %s, \"parse_seconds\": %.6f, "
+            "\"io_wait_seconds\": %.6f, \"io_read_seconds\": %.6f, "
+            "\"simulate_seconds\": %.6f, \"accesses_per_second\": %.0f, "
+            "\"peak_rss_kb\": %ld},\n",
+            profile->accesses, profile->trace_cached ? "true" : "false",
+            profile->fixed_engine ? "true" : "false", parse_s, io_wait_s,
+            io_read_s, simulate_s, rate, peak_rss_kb);
+    if (profile->slices > 0) {
+        fprintf(out,
+                "  \"slices\": {\"count\": %u, \"uncertain_accesses\": %lu, "
+                "\"resimulated\": %u, \"threads\": %u, "
+                "\"busy_seconds\": %.6f},\n",
+                profile->slices, profile->slice_uncertain,
+                profile->slices_resimulated, profile->slice_threads,
+                (double)profile->slice_busy_ns / 1e9);
+    }
+    fprintf(out, "  \"sets\": {\"count\": %lu, \"sparse\": %s,\n",
+            profile->num_sets, profile->sparse_sets ? "true" : "false");
+    fprintf(out, "    \"occupancy_histogram\": ");
+    print_json_hist(out, &profile->occupancy);
+    fprintf(out, ",\n    \"eviction_histogram\": ");
+    print_json_hist(out, &profile->evictions);
+    fprintf(out, "}\n}\n");
+}
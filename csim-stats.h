@@ -0,0 +1,91 @@
+/**
+ * @file csim-stats.h
+ * @brief Self-profiling counters and machine-readable statistics for csim
+ *
+ * A run profile times the two halves of the simulation loop, decoding the
+ * trace and simulating its accesses, and summarizes the per-set counters
+ * of the cache as histograms. It can then be written as a JSON document
+ * holding the standard statistics next to the simulator's own metrics.
+ *
+ * The profile is filled by the thread that runs the simulation loop.
+ * Helper threads never write to it: each keeps counters of its own in
+ * state that only it writes, and hands them over where it already
+ * synchronizes with that thread. The read-ahead thread times the reads
+ * of each chunk into the chunk it publishes, and the threads simulating
+ * time slices keep a counter each that is added up once they are joined.
+ * The server, which runs no profile, times each job on the worker that
+ * runs it and hands the time over with the finished job.
+ */
+
+#ifndef CSIM_STATS_H
+#define CSIM_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cachelab.h"
+#include "csim-cache.h"
+
+/** @brief Number of power-of-two buckets in a histogram */
+#define STATS_HIST_BUCKETS 65
+
+/**
+ * @brief Histogram of a per-set counter.
+ *
+ * Bucket 0 counts the sets where the counter is 0, and bucket k > 0 the
+ * sets where it is in [2**(k-1), 2**k).
+ */
+typedef struct {
+    unsigned long buckets[STATS_HIST_BUCKETS];
+    unsigned used; /* one past the last nonempty bucket */
+} stats_hist_t;
+
+/** @brief What a run measured about itself */
+typedef struct {
+    unsigned long accesses;   /* accesses simulated */
+    uint64_t parse_ns;        /* time spent decoding the trace */
+    uint64_t simulate_ns;     /* time spent simulating accesses */
+    uint64_t io_wait_ns;      /* part of parse_ns spent waiting on reads */
+    uint64_t io_read_ns;      /* time the read-ahead thread spent reading */
+    bool trace_cached;        /* accesses came from a mapped sidecar */
+    bool fixed_engine;        /* batches ran on an engine for the geometry */
+    unsigned long num_sets;   /* sets in the cache */
+    bool sparse_sets;         /* sets were allocated on first touch */
+    stats_hist_t occupancy;   /* valid lines per set at the end */
+    stats_hist_t evictions;   /* evictions per set */
+
+    /* Time-sliced runs only */
+    unsigned slices;               /* slices simulated, or 0 */
+    unsigned long slice_uncertain; /* bound on their error, see csim-slice.h */
+    unsigned slices_resimulated;   /* slices simulated again to be exact */
+    unsigned slice_threads;        /* threads the slices ran on */
+    uint64_t slice_busy_ns;        /* their simulating time, summed */
+} csim_profile_t;
+
+/** @brief Reads a monotonic clock, in nanoseconds */
+uint64_t stats_now_ns(void);
+
+/**
+ * @brief Fills the per-set histograms of a profile from a cache.
+ *
+ * Call this once the whole trace has been simulated.
+ */
+void stats_collect_sets(csim_profile_t *profile, const csim_cache_t *cache);
+
+/**
+ * @brief Writes the statistics and profile of a run as one JSON object.
+ *
+ * The peak resident set size of the process is read when this is called.
+ *
+ * @param[in] trace  Path of the simulated trace
+ * @param[in] s      Number of set index bits
+ * @param[in] E      Associativity
+ * @param[in] b      Number of block bits
+ */
+void stats_print_json(FILE *out, const char *trace, unsigned long s,
+                      unsigned long E, unsigned long b,
+                      const csim_stats_t *stats,
+                      const csim_profile_t *profile);
+
+#endif /* CSIM_STATS_H */
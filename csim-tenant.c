@@ -0,0 +1,295 @@
+/**
+ * @file csim-tenant.c
+ * @brief Several traces sharing one cache, as co-located workloads
+ *
+ * Every tenant reads its trace in batches and keeps the position of its
+ * next access, skipping markers as it goes and taking its time from the
+ * time stamps among them. The quantum schemes, round robin and ratio,
+ * give each tenant a fixed number of accesses per turn; the time scheme
+ * looks at the next access of every tenant before each access.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "csim-tenant.h"
+#include "csim-trace.h"
+
+/** @brief A trace sharing the cache, and what happened to its accesses */
+typedef struct {
+    const char *path;
+    csim_trace_t *trace;
+    const csim_access_t *batch;
+    size_t count; /* records in the batch */
+    size_t pos;   /* next record of the batch */
+    bool done;    /* the trace has ended */
+
+    unsigned long quantum; /* accesses per turn */
+    unsigned long ways;    /* ways its misses may fill */
+    unsigned long time;    /* time stamp of its next access */
+
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;       /* evictions caused by its misses */
+    unsigned long dirty_evictions; /* dirty lines among those */
+} tenant_t;
+
+struct csim_tenants {
+    tenant_t tenants[TENANT_MAX];
+    unsigned count;
+    bool by_time;     /* interleave by time stamp, not by quantum */
+    bool partitioned; /* some tenant has a way mask */
+
+    /* evicted[evictor * count + victim] */
+    unsigned long evicted[TENANT_MAX * TENANT_MAX];
+};
+
+csim_tenants_t *tenants_open(const char *const paths[], unsigned count,
+                             const char *cache_dir) {
+    csim_tenants_t *tenants = calloc(1, sizeof(csim_tenants_t));
+    if (tenants == NULL) {
+        fprintf(stderr, "Error: insufficient memory for the tenants\n");
+        return NULL;
+    }
+    for (unsigned i = 0; i < count; i++) {
+        tenant_t *t = &tenants->tenants[i];
+        t->path = paths[i];
+        t->quantum = 1;
+        t->ways = CSIM_ALL_WAYS;
+        t->trace = trace_open(paths[i], cache_dir);
+        if (t->trace == NULL) {
+            tenants_close(tenants);
+            return NULL;
+        }
+        tenants->count++;
+    }
+    return tenants;
+}
+
+/**
+ * @brief Parses a positive decimal number that ends at a separator.
+ *
+ * @return The number, or 0 if there is none
+ */
+static unsigned long parse_count(const char *s, char **end, char sep) {
+    errno = 0;
+    unsigned long n = strtoul(s, end, 10);
+    if (*end == s || (**end != sep && **end != '\0') || errno != 0 ||
+        *s == '-') {
+        return 0;
+    }
+    return n;
+}
+
+bool tenants_interleave(csim_tenants_t *tenants, const char *scheme) {
+    char *end;
+    if (strcmp(scheme, "time") == 0) {
+        tenants->by_time = true;
+        return true;
+    }
+    if (strcmp(scheme, "rr") == 0 || strncmp(scheme, "rr:", 3) == 0) {
+        unsigned long quantum = 1;
+        if (scheme[2] == ':' &&
+            ((quantum = parse_count(scheme + 3, &end, '\0')) == 0)) {
+            fprintf(stderr, "Error: invalid quantum in '%s'\n", scheme);
+            return false;
+        }
+        for (unsigned i = 0; i < tenants->count; i++) {
+            tenants->tenants[i].quantum = quantum;
+        }
+        return true;
+    }
+    if (strncmp(scheme, "ratio:", 6) == 0) {
+        const char *p = scheme + 6;
+        for (unsigned i = 0; i < tenants->count; i++) {
+            unsigned long n = parse_count(p, &end, ':');
+            if (n == 0 || (*end == '\0') != (i + 1 == tenants->count)) {
+                fprintf(stderr,
+                        "Error: '%s' needs a positive share for each of the "
+                        "%u traces\n",
+                        scheme, tenants->count);
+                return false;
+            }
+            tenants->tenants[i].quantum = n;
+            p = end + 1;
+        }
+        return true;
+    }
+    fprintf(stderr, "Error: unknown interleaving '%s'\n", scheme);
+    return false;
+}
+
+bool tenants_ways(csim_tenants_t *tenants, const char *masks,
+                  unsigned long E) {
+    unsigned long lines = E < CSIM_MASK_WAYS ? (1UL << E) - 1 : CSIM_ALL_WAYS;
+    const char *p = masks;
+    for (unsigned i = 0; i < tenants->count; i++) {
+        char *end;
+        errno = 0;
+        unsigned long ways = strtoul(p, &end, 16);
+        if (end == p || errno != 0 || *p == '-' ||
+            (*end != ',' && *end != '\0') ||
+            (*end == '\0') != (i + 1 == tenants->count)) {
+            fprintf(stderr,
+                    "Error: '%s' needs a hexadecimal way mask for each of "
+                    "the %u traces\n",
+                    masks, tenants->count);
+            return false;
+        }
+        if ((ways & lines) == 0) {
+            fprintf(stderr, "Error: way mask %lx allows none of %lu ways\n",
+                    ways, E);
+            return false;
+        }
+        tenants->tenants[i].ways = ways;
+        p = end + 1;
+    }
+    tenants->partitioned = true;
+    return true;
+}
+
+bool tenants_partitioned(const csim_tenants_t *tenants) {
+    return tenants->partitioned;
+}
+
+/**
+ * @brief Returns the next access of a tenant without taking it, or NULL
+ *        once its trace has ended.
+ */
+static const csim_access_t *tenant_peek(tenant_t *t) {
+    while (!t->done) {
+        if (t->pos == t->count) {
+            t->count = trace_next(t->trace, &t->batch);
+            t->pos = 0;
+            t->done = t->count == 0;
+            continue;
+        }
+        const csim_access_t *acc = &t->batch[t->pos];
+        if (acc->op != CSIM_OP_MARKER) {
+            return acc;
+        }
+        if (acc->size != 0) {
+            t->time = acc->addr;
+        }
+        t->pos++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Simulates an access of a tenant and accounts for it.
+ *
+ * @return false if the set of the access could not be allocated
+ */
+static bool tenant_access(csim_tenants_t *tenants, unsigned i,
+                          csim_cache_t *cache, const csim_access_t *acc) {
+    tenant_t *t = &tenants->tenants[i];
+    csim_outcome_t outcome;
+    if (!cache_access_masked(cache, acc->addr, acc->op, i, t->ways,
+                             &outcome)) {
+        return false;
+    }
+    t->pos++;
+    if (outcome.hit) {
+        t->hits++;
+        return true;
+    }
+    t->misses++;
+    if (outcome.evicted) {
+        t->evictions++;
+        if (outcome.dirty_evicted) {
+            t->dirty_evictions++;
+        }
+        tenants->evicted[i * tenants->count + outcome.victim]++;
+    }
+    return true;
+}
+
+bool tenants_run(csim_tenants_t *tenants, csim_cache_t *cache) {
+    const csim_access_t *acc;
+    if (tenants->by_time) {
+        for (;;) {
+            unsigned next = tenants->count;
+            for (unsigned i = 0; i < tenants->count; i++) {
+                tenant_t *t = &tenants->tenants[i];
+                if (tenant_peek(t) != NULL &&
+                    (next == tenants->count ||
+                     t->time < tenants->tenants[next].time)) {
+                    next = i;
+                }
+            }
+            if (next == tenants->count) {
+                return true;
+            }
+            if (!tenant_access(tenants, next, cache,
+                               tenant_peek(&tenants->tenants[next]))) {
+                return false;
+            }
+        }
+    }
+
+    bool active = true;
+    while (active) {
+        active = false;
+        for (unsigned i = 0; i < tenants->count; i++) {
+            tenant_t *t = &tenants->tenants[i];
+            for (unsigned long n = 0;
+                 n < t->quantum && (acc = tenant_peek(t)) != NULL; n++) {
+                if (!tenant_access(tenants, i, cache, acc)) {
+                    return false;
+                }
+                active = true;
+            }
+        }
+    }
+    return true;
+}
+
+void tenants_print(const csim_tenants_t *tenants, unsigned long block_bytes,
+                   FILE *out) {
+    unsigned n = tenants->count;
+    int width = (int)strlen("Trace");
+    for (unsigned i = 0; i < n; i++) {
+        int len = (int)strlen(tenants->tenants[i].path);
+        width = len > width ? len : width;
+    }
+
+    fprintf(out, "%6s %-*s %12s %12s %12s %12s %16s\n", "Tenant", width,
+            "Trace", "Hits", "Misses", "Evictions", "Dirty bytes", "Ways");
+    for (unsigned i = 0; i < n; i++) {
+        const tenant_t *t = &tenants->tenants[i];
+        fprintf(out, "%6u %-*s %12lu %12lu %12lu %12lu", i, width, t->path,
+                t->hits, t->misses, t->evictions,
+                t->dirty_evictions * block_bytes);
+        if (t->ways == CSIM_ALL_WAYS) {
+            fprintf(out, " %16s\n", "all");
+        } else {
+            fprintf(out, " %16lx\n", t->ways);
+        }
+    }
+
+    fprintf(out, "\nEvictions by tenant (row evicted column):\n%6s", "");
+    for (unsigned j = 0; j < n; j++) {
+        fprintf(out, " %12u", j);
+    }
+    fprintf(out, "\n");
+    for (unsigned i = 0; i < n; i++) {
+        fprintf(out, "%6u", i);
+        for (unsigned j = 0; j < n; j++) {
+            fprintf(out, " %12lu", tenants->evicted[i * n + j]);
+        }
+        fprintf(out, "\n");
+    }
+}
+
+int tenants_close(csim_tenants_t *tenants) {
+    int status = 0;
+    for (unsigned i = 0; i < tenants->count; i++) {
+        status |= trace_close(tenants->tenants[i].trace);
+    }
+    free(tenants);
+    return status;
+}
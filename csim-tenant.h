@@ -0,0 +1,96 @@
+/**
+ * @file csim-tenant.h
+ * @brief Several traces sharing one cache, as co-located workloads
+ *
+ * Each trace is a tenant. Their accesses are interleaved into one stream
+ * by one of these schemes:
+ *
+ *     rr:<q>             <q> accesses of each tenant in turn (rr is rr:1)
+ *     ratio:<n>:<n>...   as many accesses of each tenant in turn as its
+ *                        number, in the order the traces were given
+ *     time               the access with the earliest time stamp first,
+ *                        from the time stamp markers of the traces (see
+ *                        CSIM_OP_MARKER), ties going to the earlier trace
+ *
+ * A tenant whose trace ends drops out and the others go on. Every line
+ * belongs to the tenant that brought it into the cache, so each eviction
+ * is counted against the pair of the tenant that caused it and the tenant
+ * that lost the line.
+ *
+ * Tenants can also be given way masks, as with Intel CAT: a tenant hits
+ * any line, but its misses only fill and evict the ways in its mask.
+ */
+
+#ifndef CSIM_TENANT_H
+#define CSIM_TENANT_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "csim-cache.h"
+
+/** @brief Most traces that can share a cache */
+#define TENANT_MAX 16
+
+/** @brief Opaque handle for the tenants of a run */
+typedef struct csim_tenants csim_tenants_t;
+
+/**
+ * @brief Opens the traces of the tenants, interleaved round robin one
+ *        access at a time until told otherwise.
+ *
+ * @param[in] paths      Paths of the traces, at most TENANT_MAX
+ * @param[in] count      Number of traces
+ * @param[in] cache_dir  Directory holding decoded sidecars, or NULL
+ *
+ * @return The tenants, or NULL (after printing an error) on failure
+ */
+csim_tenants_t *tenants_open(const char *const paths[], unsigned count,
+                             const char *cache_dir);
+
+/**
+ * @brief Sets the interleaving scheme from its description.
+ *
+ * @return False (after printing an error) if the description is invalid
+ */
+bool tenants_interleave(csim_tenants_t *tenants, const char *scheme);
+
+/**
+ * @brief Sets the way masks of the tenants from a comma-separated list of
+ *        hexadecimal masks, one per tenant in order.
+ *
+ * @param[in] E  Associativity of the cache, which each mask must allow a
+ *               way of
+ *
+ * @return False (after printing an error) if the list is invalid
+ */
+bool tenants_ways(csim_tenants_t *tenants, const char *masks,
+                  unsigned long E);
+
+/** @brief True if the tenants have way masks, for cache_new_partitioned() */
+bool tenants_partitioned(const csim_tenants_t *tenants);
+
+/**
+ * @brief Simulates the interleaved traces.
+ *
+ * @return false if a set of the cache could not be allocated, in which
+ *         case the rest of the traces is not simulated
+ */
+bool tenants_run(csim_tenants_t *tenants, csim_cache_t *cache);
+
+/**
+ * @brief Prints the statistics of each tenant and the eviction matrix.
+ *
+ * @param[in] block_bytes  Size of a cache block, to report dirty bytes
+ */
+void tenants_print(const csim_tenants_t *tenants, unsigned long block_bytes,
+                   FILE *out);
+
+/**
+ * @brief Closes the traces and frees the tenants.
+ *
+ * @return 0 if every trace was read without errors, 1 otherwise
+ */
+int tenants_close(csim_tenants_t *tenants);
+
+#endif /* CSIM_TENANT_H */
@@ -0,0 +1,618 @@
+/**
+ * @file csim-trace.c
+ * @brief Trace decoding and decoded-trace sidecars
+ *
+ * Text traces are read ahead in large blocks by a csim_reader_t and parsed
+ * line by line into batches of csim_access_t. When a cache directory is in
+ * use, every decoded batch is also appended to a sidecar file, which is
+ * renamed into place once the whole trace has parsed cleanly.
+ *
+ * A sidecar is keyed by the real path of the trace, and records the size,
+ * modification time and content hash of the text it was decoded from. If
+ * the size and modification time still match, the sidecar is mapped and
+ * the text is not read at all. If only the modification time changed, the
+ * text is hashed, and the sidecar is reused (and its timestamp refreshed)
+ * when the content is unchanged. Anything else rebuilds it.
+ */
+
+#define _XOPEN_SOURCE 700 // realpath, mmap, st_mtim
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "csim-reader.h"
+#include "csim-trace.h"
+
+/** @brief Size of the blocks the text trace is read in */
+#define READ_BUFSIZE (1 << 20)
+
+/** @brief Maximum number of accesses returned in one batch */
+#define BATCH_SIZE 4096
+
+/** @brief Magic bytes at the start of every sidecar */
+#define SIDECAR_MAGIC "CSIMTRC"
+
+/**
+ * @brief Bumped whenever the sidecar layout, csim_access_t or what a line
+ *        decodes to changes
+ */
+#define SIDECAR_VERSION 2
+
+#define FNV_OFFSET 0xcbf29ce484222325UL
+#define FNV_PRIME 0x100000001b3UL
+
+/**
+ * @brief Header at the start of a sidecar, followed by `count` records
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t path_hash;      /* hash of the real path of the trace */
+    uint64_t src_size;       /* size of the text trace in bytes */
+    int64_t src_mtime_sec;   /* modification time of the text trace */
+    int64_t src_mtime_nsec;
+    uint64_t src_hash;       /* FNV-1a hash of the text trace */
+    uint64_t count;          /* number of records that follow */
+} sidecar_header_t;
+
+struct csim_trace {
+    const char *path;
+    int fd;
+    int status;
+    bool done;
+
+    /* Text parsing state */
+    csim_reader_t *reader;
+    char *buf;
+    size_t buf_len;
+    size_t buf_pos;
+    bool eof;
+    unsigned long line_num;
+    csim_access_t *batch;
+    uint64_t hash;
+
+    /* Sidecar being written while parsing */
+    FILE *side_fp;
+    char *side_path;
+    char *side_tmp;
+    sidecar_header_t header;
+
+    /* Sidecar being read instead of parsing */
+    void *map;
+    size_t map_len;
+    const csim_access_t *recs;
+    size_t nrecs;
+    size_t next;
+};
+
+static uint64_t fnv1a(uint64_t hash, const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hashes the whole text trace without moving its file offset.
+ *
+ * @return True if the trace could be read completely
+ */
+static bool hash_trace(const csim_trace_t *trace, uint64_t *hash) {
+    char *buf = malloc(READ_BUFSIZE);
+    if (buf == NULL) {
+        return false;
+    }
+
+    uint64_t h = FNV_OFFSET;
+    off_t off = 0;
+    ssize_t len;
+    while ((len = pread(trace->fd, buf, READ_BUFSIZE, off)) > 0) {
+        h = fnv1a(h, buf, (size_t)len);
+        off += len;
+    }
+
+    free(buf);
+    *hash = h;
+    return len == 0;
+}
+
+/**
+ * @brief Fills in the sidecar key for a trace and picks its file name.
+ *
+ * @return True if the trace can be cached in cache_dir
+ */
+static bool sidecar_init(csim_trace_t *trace, const char *cache_dir) {
+    struct stat st;
+    if (fstat(trace->fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+        return false;
+    }
+
+    if (mkdir(cache_dir, 0777) < 0 && errno != EEXIST) {
+        fprintf(stderr, "Warning: cannot create trace cache '%s': %s\n",
+                cache_dir, strerror(errno));
+        return false;
+    }
+
+    char *real = realpath(trace->path, NULL);
+    const char *key = real != NULL ? real : trace->path;
+    sidecar_header_t *h = &trace->header;
+    memcpy(h->magic, SIDECAR_MAGIC, sizeof(h->magic));
+    h->version = SIDECAR_VERSION;
+    h->record_size = (uint32_t)sizeof(csim_access_t);
+    h->path_hash = fnv1a(FNV_OFFSET, key, strlen(key));
+    h->src_size = (uint64_t)st.st_size;
+    h->src_mtime_sec = (int64_t)st.st_mtim.tv_sec;
+    h->src_mtime_nsec = (int64_t)st.st_mtim.tv_nsec;
+    free(real);
+
+    size_t len = strlen(cache_dir) + 64;
+    trace->side_path = malloc(len);
+    trace->side_tmp = malloc(len);
+    if (trace->side_path == NULL || trace->side_tmp == NULL) {
+        return false;
+    }
+    snprintf(trace->side_path, len, "%s/%016llx.trace", cache_dir,
+             (unsigned long long)h->path_hash);
+    snprintf(trace->side_tmp, len, "%s/%016llx.%ld.tmp", cache_dir,
+             (unsigned long long)h->path_hash, (long)getpid());
+    return true;
+}
+
+/**
+ * @brief Maps an existing sidecar if it still matches the text trace.
+ *
+ * @return True if the trace will be read from the sidecar
+ */
+static bool sidecar_map(csim_trace_t *trace) {
+    int fd = open(trace->side_path, O_RDWR);
+    if (fd < 0) {
+        return false;
+    }
+
+    const sidecar_header_t *want = &trace->header;
+    struct stat st;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(*want)) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+
+    const sidecar_header_t *h = map;
+    size_t records_len = (size_t)st.st_size - sizeof(*h);
+    bool valid = memcmp(h->magic, want->magic, sizeof(h->magic)) == 0 &&
+                 h->version == want->version &&
+                 h->record_size == want->record_size &&
+                 h->path_hash == want->path_hash &&
+                 h->src_size == want->src_size &&
+                 records_len == h->count * sizeof(csim_access_t);
+
+    if (valid && (h->src_mtime_sec != want->src_mtime_sec ||
+                  h->src_mtime_nsec != want->src_mtime_nsec)) {
+        /* Touched but possibly unchanged, so fall back to the content */
+        uint64_t hash;
+        valid = hash_trace(trace, &hash) && hash == h->src_hash;
+        if (valid) {
+            sidecar_header_t fresh = *h;
+            fresh.src_mtime_sec = want->src_mtime_sec;
+            fresh.src_mtime_nsec = want->src_mtime_nsec;
+            ssize_t res = pwrite(fd, &fresh, sizeof(fresh), 0);
+            (void)res;
+        }
+    }
+    close(fd);
+
+    if (!valid) {
+        munmap(map, (size_t)st.st_size);
+        return false;
+    }
+
+    trace->map = map;
+    trace->map_len = (size_t)st.st_size;
+    trace->recs = (const csim_access_t *)(h + 1);
+    trace->nrecs = (size_t)h->count;
+    return true;
+}
+
+/**
+ * @brief Starts writing a new sidecar next to its final location.
+ */
+static void sidecar_create(csim_trace_t *trace) {
+    trace->side_fp = fopen(trace->side_tmp, "wb");
+    if (trace->side_fp == NULL) {
+        fprintf(stderr, "Warning: cannot write trace cache '%s': %s\n",
+                trace->side_tmp, strerror(errno));
+        return;
+    }
+
+    /* The header is rewritten with the final count and hash on commit */
+    if (fwrite(&trace->header, sizeof(trace->header), 1, trace->side_fp) !=
+        1) {
+        fclose(trace->side_fp);
+        trace->side_fp = NULL;
+        unlink(trace->side_tmp);
+    }
+}
+
+/**
+ * @brief Discards a partially written sidecar.
+ */
+static void sidecar_abort(csim_trace_t *trace) {
+    if (trace->side_fp != NULL) {
+        fclose(trace->side_fp);
+        trace->side_fp = NULL;
+        unlink(trace->side_tmp);
+    }
+}
+
+/**
+ * @brief Finishes a sidecar and atomically moves it into place.
+ */
+static void sidecar_commit(csim_trace_t *trace) {
+    FILE *fp = trace->side_fp;
+    trace->header.src_hash = trace->hash;
+
+    bool ok = fseek(fp, 0, SEEK_SET) == 0 &&
+              fwrite(&trace->header, sizeof(trace->header), 1, fp) == 1;
+    ok = (fclose(fp) == 0) && ok;
+    trace->side_fp = NULL;
+
+    if (!ok || rename(trace->side_tmp, trace->side_path) < 0) {
+        fprintf(stderr, "Warning: failed to store trace cache '%s'\n",
+                trace->side_path);
+        unlink(trace->side_tmp);
+    }
+}
+
+/**
+ * @brief Reads more of the text trace behind the unparsed remainder.
+ *
+ * @return False on a read error or a line that does not fit the buffer
+ */
+static bool fill_buffer(csim_trace_t *trace) {
+    size_t left = trace->buf_len - trace->buf_pos;
+    memmove(trace->buf, trace->buf + trace->buf_pos, left);
+    trace->buf_len = left;
+    trace->buf_pos = 0;
+
+    if (left == READ_BUFSIZE) {
+        fprintf(stderr, "Error: line %lu of '%s' is too long\n",
+                trace->line_num + 1, trace->path);
+        return false;
+    }
+
+    ssize_t len =
+        reader_read(trace->reader, trace->buf + left, READ_BUFSIZE - left);
+    if (len < 0) {
+        fprintf(stderr, "Error reading '%s': %s\n", trace->path,
+                strerror(errno));
+        return false;
+    }
+    if (len == 0) {
+        trace->eof = true;
+    }
+
+    trace->hash = fnv1a(trace->hash, trace->buf + left, (size_t)len);
+    trace->buf_len += (size_t)len;
+    return true;
+}
+
+static bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static int hex_digit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * @brief Decodes the label of a marker into its time stamp, if the label
+ *        is a decimal number.
+ */
+static void parse_time(const char *s, const char *end, csim_access_t *acc) {
+    while (s < end && is_blank(*s)) {
+        s++;
+    }
+    unsigned long time = 0;
+    int digits = 0;
+    for (; s < end && *s >= '0' && *s <= '9'; s++) {
+        unsigned long digit = (unsigned long)(*s - '0');
+        if (time > (ULONG_MAX - digit) / 10) {
+            return;
+        }
+        time = time * 10 + digit;
+        digits++;
+    }
+    while (s < end && is_blank(*s)) {
+        s++;
+    }
+    if (digits > 0 && s == end) {
+        acc->addr = time;
+        acc->size = 1;
+    }
+}
+
+/**
+ * @brief Parses one line of the form "<op> <hex addr>,<size>", or a marker
+ *        line of the form "M [<label>]".
+ *
+ * @return 1 if an access was decoded, 0 for a blank line, -1 on error
+ */
+static int parse_line(const char *s, const char *end, csim_access_t *acc) {
+    while (s < end && is_blank(*s)) {
+        s++;
+    }
+    if (s == end) {
+        return 0;
+    }
+
+    /* Clear the padding too, so that sidecars are byte-for-byte repeatable */
+    memset(acc, 0, sizeof(*acc));
+    char op = *s++;
+    if (op == CSIM_OP_MARKER && (s == end || is_blank(*s))) {
+        acc->op = op;
+        parse_time(s, end, acc);
+        return 1;
+    }
+    if ((op != 'L' && op != 'S') || s == end || !is_blank(*s)) {
+        return -1;
+    }
+    while (s < end && is_blank(*s)) {
+        s++;
+    }
+
+    unsigned long addr = 0;
+    int digits = 0;
+    int d;
+    while (s < end && (d = hex_digit(*s)) >= 0) {
+        if (++digits > 16) {
+            return -1;
+        }
+        addr = (addr << 4) | (unsigned long)d;
+        s++;
+    }
+    if (digits == 0 || s == end || *s++ != ',') {
+        return -1;
+    }
+
+    unsigned long size = 0;
+    digits = 0;
+    while (s < end && *s >= '0' && *s <= '9') {
+        size = size * 10 + (unsigned long)(*s - '0');
+        if (size > UINT_MAX) {
+            return -1;
+        }
+        digits++;
+        s++;
+    }
+    while (s < end && is_blank(*s)) {
+        s++;
+    }
+    if (digits == 0 || s != end) {
+        return -1;
+    }
+
+    acc->addr = addr;
+    acc->size = (unsigned int)size;
+    acc->op = op;
+    return 1;
+}
+
+/**
+ * @brief Parses up to BATCH_SIZE accesses from the text trace.
+ *
+ * @return The number of accesses decoded, 0 at the end or on error
+ */
+static size_t parse_batch(csim_trace_t *trace) {
+    size_t n = 0;
+    while (n < BATCH_SIZE) {
+        char *line = trace->buf + trace->buf_pos;
+        size_t avail = trace->buf_len - trace->buf_pos;
+        char *end = memchr(line, '\n', avail);
+        size_t consumed;
+        if (end != NULL) {
+            consumed = (size_t)(end - line) + 1;
+        } else if (!trace->eof) {
+            if (!fill_buffer(trace)) {
+                trace->status = 1;
+                return 0;
+            }
+            continue;
+        } else if (avail > 0) {
+            /* Last line without a trailing newline */
+            end = line + avail;
+            consumed = avail;
+        } else {
+            break;
+        }
+
+        trace->buf_pos += consumed;
+        trace->line_num++;
+
+        int res = parse_line(line, end, &trace->batch[n]);
+        if (res < 0) {
+            fprintf(stderr, "Error: malformed line %lu in '%s': '%.*s'\n",
+                    trace->line_num, trace->path, (int)(end - line), line);
+            trace->status = 1;
+            return 0;
+        }
+        n += (size_t)res;
+    }
+    return n;
+}
+
+csim_trace_t *trace_open(const char *path, const char *cache_dir) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    csim_trace_t *trace = calloc(1, sizeof(*trace));
+    if (trace == NULL) {
+        fprintf(stderr, "Error: insufficient memory to read '%s'\n", path);
+        close(fd);
+        return NULL;
+    }
+    trace->path = path;
+    trace->fd = fd;
+    trace->hash = FNV_OFFSET;
+
+    if (cache_dir != NULL && sidecar_init(trace, cache_dir)) {
+        if (sidecar_map(trace)) {
+            return trace;
+        }
+        sidecar_create(trace);
+    }
+
+    trace->buf = malloc(READ_BUFSIZE);
+    trace->batch = malloc(BATCH_SIZE * sizeof(csim_access_t));
+    trace->reader = reader_open(fd);
+    if (trace->buf == NULL || trace->batch == NULL || trace->reader == NULL) {
+        fprintf(stderr, "Error: insufficient memory to read '%s'\n", path);
+        trace_close(trace);
+        return NULL;
+    }
+    return trace;
+}
+
+size_t trace_next(csim_trace_t *trace, const csim_access_t **batch) {
+    if (trace->map != NULL) {
+        size_t n = trace->nrecs - trace->next;
+        if (n > BATCH_SIZE) {
+            n = BATCH_SIZE;
+        }
+        *batch = trace->recs + trace->next;
+        trace->next += n;
+        return n;
+    }
+
+    if (trace->done) {
+        return 0;
+    }
+
+    size_t n = parse_batch(trace);
+    if (trace->side_fp != NULL && n > 0) {
+        if (fwrite(trace->batch, sizeof(csim_access_t), n, trace->side_fp) !=
+            n) {
+            sidecar_abort(trace);
+        }
+        trace->header.count += n;
+    }
+
+    if (n == 0) {
+        trace->done = true;
+        if (trace->side_fp != NULL) {
+            if (trace->status == 0) {
+                sidecar_commit(trace);
+            } else {
+                sidecar_abort(trace);
+            }
+        }
+    }
+
+    *batch = trace->batch;
+    return n;
+}
+
+bool trace_is_cached(const csim_trace_t *trace) {
+    return trace->map != NULL;
+}
+
+uint64_t trace_io_wait_ns(const csim_trace_t *trace) {
+    return trace->reader != NULL ? reader_wait_ns(trace->reader) : 0;
+}
+
+uint64_t trace_io_read_ns(const csim_trace_t *trace) {
+    return trace->reader != NULL ? reader_read_ns(trace->reader) : 0;
+}
+
+int trace_close(csim_trace_t *trace) {
+    int status = trace->status;
+    if (trace->map == NULL && !trace->done) {
+        status = 1;
+    }
+
+    sidecar_abort(trace);
+    if (trace->map != NULL) {
+        munmap(trace->map, trace->map_len);
+    }
+    if (trace->reader != NULL) {
+        reader_close(trace->reader);
+    }
+    close(trace->fd);
+    free(trace->side_path);
+    free(trace->side_tmp);
+    free(trace->buf);
+    free(trace->batch);
+    free(trace);
+    return status;
+}
+
+bool trace_load(const char *path, const char *cache_dir,
+                csim_access_t **accesses, size_t *count, size_t *bytes) {
+    csim_trace_t *tfp = trace_open(path, cache_dir);
+    if (tfp == NULL) {
+        return false;
+    }
+
+    csim_access_t *records = NULL;
+    size_t used = 0;
+    size_t capacity = 0;
+    bool ok = true;
+    const csim_access_t *batch;
+    size_t n;
+    while ((n = trace_next(tfp, &batch)) > 0) {
+        if (used + n > capacity) {
+            size_t grown = capacity == 0 ? n : capacity;
+            while (grown < used + n) {
+                grown *= 2;
+            }
+            csim_access_t *larger =
+                realloc(records, grown * sizeof(csim_access_t));
+            if (larger == NULL) {
+                fprintf(stderr, "Error: insufficient memory to keep '%s'\n",
+                        path);
+                ok = false;
+                break;
+            }
+            records = larger;
+            capacity = grown;
+        }
+        memcpy(&records[used], batch, n * sizeof(csim_access_t));
+        used += n;
+    }
+    ok = trace_close(tfp) == 0 && ok;
+
+    if (!ok) {
+        free(records);
+        return false;
+    }
+    *accesses = records;
+    *count = used;
+    *bytes = capacity * sizeof(csim_access_t);
+    return true;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file csim-trace.h
+ * @brief Trace decoding for the cache simulator
+ *
+ * A trace is read as a stream of batches of decoded accesses. When a cache
+ * directory is given, the decoded accesses are also stored in a binary
+ * sidecar file that later runs map directly instead of parsing the text.
+ */
+
+#ifndef CSIM_TRACE_H
+#define CSIM_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A single decoded memory access from a trace
+ */
+typedef struct {
+    unsigned long addr; /* address of the access */
+    unsigned int size;  /* size of the access in bytes */
+    char op;            /* 'L' for loads, 'S' for stores, or a marker */
+} csim_access_t;
+
+/**
+ * @brief Op of a marker record, which separates phases of a trace.
+ *
+ * A trace line "M" (optionally followed by a label) decodes to a record
+ * with this op. Markers are not memory accesses and must not be simulated.
+ * A marker whose label is a decimal number is a time stamp, the time of
+ * the accesses after it: its record holds the number as addr and has size
+ * 1. Other markers have addr and size 0.
+ */
+#define CSIM_OP_MARKER 'M'
+
+/** @brief Opaque handle for a trace being read */
+typedef struct csim_trace csim_trace_t;
+
+/** @brief Environment variable naming the default sidecar cache directory */
+#define CSIM_TRACE_CACHE_ENV "CSIM_TRACE_CACHE"
+
+/**
+ * @brief Opens a trace for reading.
+ *
+ * @param[in] path       Path of the text trace
+ * @param[in] cache_dir  Directory holding decoded sidecars, or NULL to
+ *                       always parse the text
+ *
+ * @return The trace handle, or NULL if the trace could not be opened
+ */
+csim_trace_t *trace_open(const char *path, const char *cache_dir);
+
+/**
+ * @brief Returns the next batch of decoded accesses.
+ *
+ * The batch stays valid until the next call on the same trace.
+ *
+ * @return The number of accesses in the batch, 0 at the end of the trace
+ *         or after a parse error
+ */
+size_t trace_next(csim_trace_t *trace, const csim_access_t **batch);
+
+/** @brief True if the accesses are being read from a mapped sidecar */
+bool trace_is_cached(const csim_trace_t *trace);
+
+/**
+ * @brief Returns the time spent waiting for the text trace to be read, in
+ *        nanoseconds, which is 0 for a mapped sidecar.
+ */
+uint64_t trace_io_wait_ns(const csim_trace_t *trace);
+
+/**
+ * @brief Returns the time the read-ahead thread spent reading the text
+ *        trace, in nanoseconds, which is 0 for a mapped sidecar.
+ */
+uint64_t trace_io_read_ns(const csim_trace_t *trace);
+
+/**
+ * @brief Decodes a whole trace into memory, markers included.
+ *
+ * @param[out] accesses  The records, to be released with free()
+ * @param[out] count     Number of records
+ * @param[out] bytes     Memory held by the records
+ *
+ * @return False if the trace could not be opened or decoded, or did not
+ *         fit in memory
+ */
+bool trace_load(const char *path, const char *cache_dir,
+                csim_access_t **accesses, size_t *count, size_t *bytes);
+
+/**
+ * @brief Closes a trace.
+ *
+ * @return 0 if the whole trace was read without errors, 1 otherwise
+ */
+int trace_close(csim_trace_t *trace);
+
+#endif /* CSIM_TRACE_H */
@@ -1,282 +1,304 @@
 #include "cachelab.h"
+#include "csim-cache.h"
+#include "csim-diff.h"
+#include "csim-filter.h"
+#include "csim-interval.h"
+#include "csim-nest.h"
+#include "csim-outcome.h"
+#include "csim-pressure.h"
+#include "csim-region.h"
+#include "csim-serve.h"
+#include "csim-slice.h"
+#include "csim-stats.h"
+#include "csim-tenant.h"
+#include "csim-trace.h"
 #include <errno.h>
 #include <getopt.h>
-#include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
-struct instruction {
-    unsigned long addr;
-    unsigned long size;
-    char op;
-};
-
-typedef struct instruction *instruction_t;
-
-struct line {
-    unsigned long tag;
-    long cycles_since_use;
-    bool isDirty;
-    bool isValid;
-};
-
-typedef struct line *line_t;
-
 csim_stats_t *stats;
 
 void sufficient_memory_check(void *val, const char err_msg[]) {
     if (val == NULL) {
         printf("%s", err_msg);
+        exit(1);
     }
 }
 
-line_t get_cache_index(line_t cache[], int num_lines, unsigned long i,
-                       unsigned long j) {
-    return cache[(i * ((unsigned long)num_lines)) + j];
+/* The engine leaves it to csim to give up when a set cannot be allocated */
+void simulated_check(bool simulated) {
+    if (!simulated) {
+        printf("Insufficient Memory for cache sets on Heap!\n");
+        exit(1);
+    }
 }
 
-void display_instruction(instruction_t instruct) {
-    printf("Op: %c, Addr: %lu, Size: %lu\n", instruct->op, instruct->addr,
+void display_instruction(const csim_access_t *instruct) {
+    printf("Op: %c, Addr: %lu, Size: %u\n", instruct->op, instruct->addr,
            instruct->size);
 }
 
+/**
+ * @brief Gets the next batch of accesses, from the generated loop nest if
+ *        there is one and else from the trace.
+ */
+static size_t next_batch(csim_trace_t *tfp, csim_nest_t *nest,
+                         const csim_access_t **batch) {
+    return nest != NULL ? nest_next(nest, batch) : trace_next(tfp, batch);
+}
+
 int process_trace_file(
-    const char *trace, unsigned long v_flag,
-    unsigned long req_flags[3]) { // 0 for success, 1 for error
-    FILE *tfp = fopen(trace, "rt");
-    if (!tfp) {
-        fprintf(stderr, "Error opening '%s': %s\n", trace, strerror(errno));
+    const char *trace, csim_nest_t *nest, const char *cache_dir,
+    unsigned long v_flag, unsigned long req_flags[3],
+    csim_indexing_t indexing, csim_regions_t *regions,
+    csim_intervals_t *intervals, csim_pressure_t *pressure,
+    csim_outcomes_t *outcomes,
+    csim_profile_t *profile) { // 0 for success, 1 for error
+    csim_trace_t *tfp = nest == NULL ? trace_open(trace, cache_dir) : NULL;
+    if (!tfp && nest == NULL) {
+        if (intervals != NULL) {
+            intervals_close(intervals, NULL);
+        }
+        if (pressure != NULL) {
+            pressure_close(pressure, NULL);
+        }
+        if (outcomes != NULL) {
+            outcomes_close(outcomes);
+        }
         return 1;
     }
 
-    stats = calloc(1, sizeof(long) * 5);
+    stats = calloc(1, sizeof(csim_stats_t));
     sufficient_memory_check(stats, "Insufficient Memory!");
-    int num_sets = (int)pow(2, (int)req_flags[0]);
-    int num_lines = (int)req_flags[1];
-
-    const int LINELEN = 22;
-    char linebuf[LINELEN];
-    int parse_error = 0;
-    unsigned long line_num = 0;
-
-    char separators[2] = {' ', ','};
-    char *token;
-
-    line_t cache[num_sets * num_lines];
-    for (int i = 0; i < num_sets * num_lines; i++) {
-        cache[i] = calloc(1, sizeof(struct line));
-        sufficient_memory_check(
-            cache[i], "Insufficient Memory to create cache on Heap!\n");
-        cache[i]->isValid = false;
-        cache[i]->isDirty = false;
-    }
-
-    unsigned long sb_sum = req_flags[0] + req_flags[2];
-    unsigned long tag_shl = (unsigned long)64 - sb_sum;
-    unsigned long set_mask = ~(0xFFFFFFFFFFFFFFFFL << (long)req_flags[0]);
-    unsigned long tag_mask;
-    if (tag_shl == 64) {
-        tag_mask = 0xFFFFFFFFFFFFFFFFL;
-    } else {
-        tag_mask = ~(0xFFFFFFFFFFFFFFFFL << (long)(64 - sb_sum));
-    }
 
-    if (v_flag) {
-        printf("set_mask: %lu, tag_mask: %lu\n", set_mask, tag_mask);
+    csim_cache_t *cache = cache_new_indexing(req_flags[0], req_flags[1],
+                                             req_flags[2], v_flag != 0,
+                                             indexing);
+    sufficient_memory_check(cache,
+                            "Insufficient Memory to create cache on Heap!\n");
+
+    profile->trace_cached = tfp != NULL && trace_is_cached(tfp);
+    if (v_flag && profile->trace_cached) {
+        printf("Reading decoded accesses from the trace cache\n");
     }
 
-    while (fgets(linebuf, LINELEN, tfp)) {
-        line_num++;
-        if (v_flag) {
-            printf("\nNext Line to be processed is #%lu: '%s'\n", line_num,
-                   linebuf);
+    /* Collapse same-block runs unless something observes each access */
+    bool filtered = !v_flag && regions == NULL && intervals == NULL &&
+                    pressure == NULL && outcomes == NULL;
+    run_filter_t filter;
+    run_filter_init(&filter, cache, req_flags[2]);
+
+    const csim_access_t *batch;
+    size_t count;
+    unsigned long access_num = 0;
+    uint64_t start = stats_now_ns();
+    while ((count = next_batch(tfp, nest, &batch)) > 0) {
+        uint64_t parsed = stats_now_ns();
+        profile->parse_ns += parsed - start;
+        if (filtered) {
+            access_num += run_filter_batch(&filter, batch, count);
+            count = 0;
         }
-
-        if (strcmp(linebuf, "\n\0")) {
-
-            size_t info_index = 0; // 0 = op, 1 = addr, 2 = size
-            token = strtok(linebuf, separators);
-
-            instruction_t curData = calloc(1, sizeof(struct instruction));
-            sufficient_memory_check(curData, "Insufficient memory!");
-
-            while (token != NULL) {
-                if (v_flag) {
-                    printf("    Next token to be processed: %s (with "
-                           "info_index of %zu)\n",
-                           token, info_index);
+        for (size_t i = 0; i < count; i++) {
+            if (batch[i].op == CSIM_OP_MARKER) {
+                if (intervals != NULL) {
+                    intervals_marker(intervals, cache);
                 }
-
-                if (info_index == 0) {
-                    if ((!strcmp(token, "L")) || (!strcmp(token, "S"))) {
-                        curData->op = token[0];
-                    } else {
-                        printf("Incorrect instruction type on line #%lu. "
-                               "Received: %s\n",
-                               line_num, token);
-                        exit(0);
-                    }
-                } else if (info_index == 1) {
-                    size_t length = 0;
-                    while (token[length] != '\0') {
-                        length++;
-                    }
-
-                    /*if (length > 16 || ) {
-
-                    }*/
-                    curData->addr = strtoul(token, NULL, 16);
-                } else {
-                    curData->size = strtoul(token, NULL, 10);
-                }
-
-                info_index++;
-                token = strtok(NULL, separators);
-            }
-            info_index = 0;
-
-            instruction_t curInstruction = curData;
-
-            unsigned long tag =
-                (curInstruction->addr >> (long)sb_sum) & tag_mask;
-            unsigned long set =
-                (curInstruction->addr >> req_flags[2]) & set_mask;
-            if (v_flag) {
-                printf("Next Instruction: Op: (%c), Addr: (%lu), Size: (%lu)\n",
-                       curInstruction->op, curInstruction->addr,
-                       curInstruction->size);
-                printf("Tag: %lu, Set: %lu\n\n", tag, set);
+                continue;
             }
-
-            bool isHit = false;
-            long valid_count = 0;
-            long LRU = 1;
-            long LRU_cycles = -1;
+            access_num++;
             if (v_flag) {
-                printf("Beginning check of set for instructed tag now\n");
+                printf("\nNext access to be processed is #%lu: ", access_num);
+                display_instruction(&batch[i]);
             }
-            for (int l = 0; l < num_lines; l++) {
-                if (v_flag) {
-                    printf("Checking Line %d: ", l);
+            if (regions != NULL || outcomes != NULL) {
+                csim_outcome_t outcome;
+                unsigned region = 0;
+                if (regions != NULL) {
+                    region = regions_lookup(regions, batch[i].addr);
                 }
-                line_t curLine =
-                    get_cache_index(cache, num_lines, set, (unsigned long)l);
-
-                if (curLine->tag == tag && curLine->isValid) {
-                    if (v_flag) {
-                        printf("This line had the instructed tag!!\n");
-                    }
-                    isHit = true;
-                    LRU = l; // LRU is overloaded to also hold the index of the
-                             // line where the HIT occured in the set
-                } else if (curLine->isValid) {
-                    valid_count++;
-
-                    if (!isHit && curLine->cycles_since_use > LRU_cycles) {
-                        if (v_flag) {
-                            printf(
-                                "This is the new least recently used line!\n");
-                        }
-                        LRU = l;
-                        LRU_cycles = curLine->cycles_since_use;
-                    }
-
-                    curLine->cycles_since_use++;
-                } else if (!isHit) {
-                    if (v_flag) {
-                        printf("This line was unused!\n");
-                    }
-                    LRU = l; // LRU overloaded yet again to hold the index of
-                             // the line that is currently not used
-                    LRU_cycles = 9999999;
-                } else {
-                    if (v_flag) {
-                        printf("\n");
-                    }
+                simulated_check(cache_access_owned(
+                    cache, batch[i].addr, batch[i].op, region, &outcome));
+                if (regions != NULL) {
+                    regions_record(regions, region, &outcome);
                 }
-            }
-
-            if (isHit) {
-                stats->hits++;
-                if (v_flag) {
-                    printf("Hit! With line #%lu\n\n\n", LRU);
+                if (outcomes != NULL) {
+                    outcomes_record(outcomes, &outcome);
                 }
-                line_t hit_line =
-                    get_cache_index(cache, num_lines, set, (unsigned long)LRU);
-                hit_line->cycles_since_use = 0;
-
             } else {
-                stats->misses++;
-                if (valid_count == num_lines) {
-                    stats->evictions++;
-
-                    line_t evicted_line = get_cache_index(cache, num_lines, set,
-                                                          (unsigned long)LRU);
-                    if (v_flag) {
-                        printf("Miss and eviction! Line #%ld was evicted and "
-                               "had tag %lu, but now has tag %lu\n\n\n",
-                               LRU, evicted_line->tag, tag);
-                    }
-                    if (evicted_line->isDirty) {
-                        stats->dirty_evictions++;
-                        stats->dirty_bytes--;
-                        evicted_line->isDirty = false;
-                    }
-                    evicted_line->tag = tag;
-                    evicted_line->cycles_since_use = 0;
-                } else {
-                    if (v_flag) {
-                        printf("Miss, no eviction! Inserting the address into "
-                               "line #%ld with tag %lu\n\n\n",
-                               LRU, tag);
-                    }
-                    line_t new_line = get_cache_index(cache, num_lines, set,
-                                                      (unsigned long)LRU);
-                    new_line->isValid = true;
-                    new_line->tag = tag;
-                }
+                simulated_check(
+                    cache_access(cache, batch[i].addr, batch[i].op));
             }
-
-            if (curInstruction->op == 'S') {
-                line_t cur_line =
-                    get_cache_index(cache, num_lines, set, (unsigned long)LRU);
-                if (!cur_line->isDirty) {
-                    stats->dirty_bytes++;
-                }
-                cur_line->isDirty = true;
+            if (intervals != NULL) {
+                intervals_access(intervals, cache, batch[i].addr);
             }
-
-            free(curData);
-        } else {
-            if (v_flag) {
-                printf("Skipping this line...\n");
+            if (pressure != NULL) {
+                pressure_access(pressure, batch[i].addr);
             }
         }
+        start = stats_now_ns();
+        profile->simulate_ns += start - parsed;
+    }
+    profile->parse_ns += stats_now_ns() - start;
+    profile->io_wait_ns = tfp != NULL ? trace_io_wait_ns(tfp) : 0;
+    profile->io_read_ns = tfp != NULL ? trace_io_read_ns(tfp) : 0;
+    simulated_check(run_filter_flush(&filter));
+    profile->accesses = access_num;
+
+    cache_stats(cache, stats);
+    stats_collect_sets(profile, cache);
+    int status = 0;
+    if (intervals != NULL) {
+        status = intervals_close(intervals, cache);
+    }
+    if (pressure != NULL) {
+        status |= pressure_close(pressure, cache);
+    }
+    if (outcomes != NULL) {
+        status |= outcomes_close(outcomes);
     }
+    cache_free(cache);
 
-    unsigned long multiplier = (unsigned long)pow(2, (int)req_flags[2]);
-    stats->dirty_bytes = (stats->dirty_bytes * multiplier);
-    stats->dirty_evictions = (stats->dirty_evictions * multiplier);
+    return (tfp != NULL ? trace_close(tfp) : 0) | status;
+}
+
+int process_trace_sliced(const char *trace, const char *cache_dir,
+                         unsigned long req_flags[3], csim_indexing_t indexing,
+                         unsigned slices, unsigned long warmup, bool exact,
+                         csim_slice_report_t *report,
+                         csim_profile_t *profile) { // 0 for success
+    csim_access_t *records;
+    size_t count;
+    size_t bytes;
+    uint64_t start = stats_now_ns();
+    if (!trace_load(trace, cache_dir, &records, &count, &bytes)) {
+        return 1;
+    }
+    uint64_t loaded = stats_now_ns();
+    profile->parse_ns = loaded - start;
+
+    stats = calloc(1, sizeof(csim_stats_t));
+    sufficient_memory_check(stats, "Insufficient Memory!");
+    csim_cache_t *cache = slice_simulate(
+        records, count, req_flags[0], req_flags[1], req_flags[2], indexing,
+        slices, warmup, exact, stats, report);
+    free(records);
+    if (cache == NULL) {
+        return 1;
+    }
+    profile->simulate_ns = stats_now_ns() - loaded;
+    profile->accesses = report->accesses;
+    profile->slices = report->slices;
+    profile->slice_uncertain = report->uncertain;
+    profile->slices_resimulated = report->resimulated;
+    profile->slice_threads = report->threads;
+    profile->slice_busy_ns = report->busy_ns;
+
+    /* The per-set counters are those of the cache that ran the end */
+    stats_collect_sets(profile, cache);
+    cache_free(cache);
+    return 0;
+}
 
-    for (int i = 0; i < num_sets * num_lines; i++) {
-        free(cache[i]);
+int process_tenants(const char *const traces[], unsigned num_traces,
+                    const char *cache_dir, unsigned long req_flags[3],
+                    csim_indexing_t indexing, const char *interleave,
+                    const char *ways,
+                    csim_tenants_t **result) { // 0 for success, 1 for error
+    csim_tenants_t *tenants = tenants_open(traces, num_traces, cache_dir);
+    if (tenants == NULL) {
+        return 1;
+    }
+    if ((interleave != NULL && !tenants_interleave(tenants, interleave)) ||
+        (ways != NULL && !tenants_ways(tenants, ways, req_flags[1]))) {
+        tenants_close(tenants);
+        exit(1);
     }
 
-    fclose(tfp);
-    return parse_error;
+    stats = calloc(1, sizeof(csim_stats_t));
+    sufficient_memory_check(stats, "Insufficient Memory!");
+    csim_cache_t *cache;
+    if (tenants_partitioned(tenants)) {
+        cache = cache_new_partitioned(req_flags[0], req_flags[1],
+                                      req_flags[2], indexing);
+    } else {
+        cache = cache_new_indexing(req_flags[0], req_flags[1], req_flags[2],
+                                   false, indexing);
+    }
+    sufficient_memory_check(cache,
+                            "Insufficient Memory to create cache on Heap!\n");
+
+    simulated_check(tenants_run(tenants, cache));
+    cache_stats(cache, stats);
+    cache_free(cache);
+    *result = tenants;
+    return 0;
 }
 
 void usage(void) {
     printf(
-        "Usage: ./csim -ref [-v] -s <s> -E <E> -b <b> -t <trace >\n ./csim "
-        "-ref -h\n -h Print this help message and exit\n -v Verbose mode: "
-        "report effects of each memory operation\n -s <s> Number of set index "
-        "bits (there are 2**s sets)\n -b <b> Number of block bits (there are "
-        "2**b blocks)\n -E <E> Number of lines per set ( associativity )\n -t "
-        "<trace > File name of the memory trace to process\n");
+        "Usage: ./csim -ref [-v] -s <s> -E <E> -b <b> -t <trace > [-c <dir>]\n"
+        "             [-r <map>] [--stats=json] [--stats-file=<file>]\n"
+        "             [--interval=<n>|markers] [--interval-file=<file>]\n"
+        "             [--interval-format=csv|binary]\n"
+        "             [--index=mod|xor|prime|skew] [--set-report=<file>]\n"
+        "             [--slices=<n> [--warmup=<n>] [--slices-exact]]\n"
+        "             [--outcomes=<file>]\n"
+        " ./csim -ref [-v] -s <s> -E <E> -b <b> --nest=<file> [-r <map>]\n"
+        "             [--stats=json] [--interval=<n>|markers] "
+        "[--outcomes=<file>]\n"
+        " ./csim -ref -s <s> -E <E> -b <b> -t <trace> -t <trace>... "
+        "[--interleave=<f>]\n"
+        "             [--ways=<mask>,<mask>...]\n"
+        " ./csim -ref --diff=<file> --diff=<file> [-t <trace> [-t <trace>]]\n"
+        "             [-r <map> [-r <map>]]\n"
+        " ./csim -ref --serve=<socket> [--serve-threads=<n>] "
+        "[--serve-mem=<MiB>] [-c <dir>]\n"
+        " ./csim -ref -h\n -h Print this help message and exit\n -v Verbose "
+        "mode: report effects of each memory operation\n -s <s> Number of set "
+        "index bits (there are 2**s sets)\n -b <b> Number of block bits (there "
+        "are 2**b blocks)\n -E <E> Number of lines per set ( associativity )\n "
+        "-t <trace > File name of the memory trace to process\n -c <dir> "
+        "Cache decoded traces in <dir> (default: $" CSIM_TRACE_CACHE_ENV ")\n"
+        " -r <map> Attribute accesses to the regions named in <map>\n"
+        " --stats=json Also report statistics and profile as JSON\n"
+        " --stats-file=<file> Write the JSON to <file> instead of stdout\n"
+        " --interval=<n> Report statistics every <n> accesses and at markers\n"
+        " --interval=markers Report statistics at markers only\n"
+        " --interval-file=<file> Write intervals to <file> instead of stdout\n"
+        " --interval-format=csv|binary Format of the intervals (default: "
+        "csv)\n"
+        " --index=<f> Index sets by the s bits above the block offset "
+        "(mod, the\n   default), by those XORed with all higher s bits (xor), "
+        "by the block\n   number modulo a prime (prime), or by a hash per way "
+        "(skew)\n"
+        " --set-report=<file> Write per-set load and index bit entropy to "
+        "<file>\n   (- for stdout)\n"
+        " --slices=<n> Simulate <n> time slices of the trace in parallel\n"
+        " --warmup=<n> Warm each slice up on the <n> accesses before it "
+        "(default:\n   4 per line of the cache, at most a slice)\n"
+        " --slices-exact Simulate slices again where their warm-up fell "
+        "short, until\n   they meet their own run\n"
+        " --interleave=<f> Interleave several traces round robin (rr, or "
+        "rr:<n> for\n   <n> accesses a turn), by shares (ratio:<n>:<n>...) "
+        "or by time stamp\n   markers (time)\n"
+        " --ways=<mask>,<mask>... Confine the fills of each trace to the "
+        "ways in its\n   hexadecimal mask\n"
+        " --outcomes=<file> Write the outcome of every access to <file>\n"
+        " --nest=<file> Simulate the accesses of the loop nest described in "
+        "<file>\n   instead of a trace\n"
+        " --diff=<file> Compare the outcome files of two runs, aligned by "
+        "access\n   number, or by address given the trace of each run, "
+        "and with -r, by\n   offset into the regions of the same name\n"
+        " --serve=<socket> Serve simulation requests on a Unix socket\n"
+        " --serve-threads=<n> Simulate on <n> threads (default: one per "
+        "CPU)\n"
+        " --serve-mem=<MiB> Limit resident decoded traces to <MiB> (default: "
+        "1024)\n");
 }
 
 int main(int argc, char **argv) {
@@ -284,9 +306,57 @@ int main(int argc, char **argv) {
     int ch;
     unsigned long v_flag = 0;
     unsigned long req_flags[] = {0, 0, 0}; // -s, -E, -b
-    char *file_name;
-
-    while ((ch = getopt(argc, argv, "s:E:b:t:v")) != -1) {
+    const char *file_name = NULL;
+    const char *trace_files[TENANT_MAX];
+    unsigned num_traces = 0;
+    const char *interleave = NULL;
+    const char *way_masks = NULL;
+    const char *cache_dir = getenv(CSIM_TRACE_CACHE_ENV);
+    const char *region_maps[2];
+    unsigned num_maps = 0;
+    const char *region_map = NULL;
+    const char *outcome_file = NULL;
+    const char *nest_file = NULL;
+    const char *diff_files[2];
+    unsigned num_diffs = 0;
+    bool json_stats = false;
+    const char *stats_file = NULL;
+    bool use_intervals = false;
+    unsigned long interval_period = 0;
+    const char *interval_file = NULL;
+    bool interval_binary = false;
+    const char *serve_socket = NULL;
+    unsigned long serve_threads = 0;
+    unsigned long serve_mem_mb = SERVE_DEFAULT_MEM_MB;
+    csim_indexing_t indexing = CSIM_INDEXING_MODULO;
+    const char *set_report = NULL;
+    unsigned long slices = 0;
+    unsigned long warmup = SLICE_WARMUP_AUTO;
+    bool slices_exact = false;
+    static const struct option long_options[] = {
+        {"stats", required_argument, NULL, 'J'},
+        {"stats-file", required_argument, NULL, 'F'},
+        {"interval", required_argument, NULL, 'I'},
+        {"interval-file", required_argument, NULL, 'O'},
+        {"interval-format", required_argument, NULL, 'T'},
+        {"serve", required_argument, NULL, 'U'},
+        {"serve-threads", required_argument, NULL, 'P'},
+        {"serve-mem", required_argument, NULL, 'M'},
+        {"index", required_argument, NULL, 'X'},
+        {"set-report", required_argument, NULL, 'R'},
+        {"slices", required_argument, NULL, 'K'},
+        {"warmup", required_argument, NULL, 'W'},
+        {"slices-exact", no_argument, NULL, 'Z'},
+        {"interleave", required_argument, NULL, 'L'},
+        {"ways", required_argument, NULL, 'A'},
+        {"outcomes", required_argument, NULL, 'Q'},
+        {"diff", required_argument, NULL, 'D'},
+        {"nest", required_argument, NULL, 'N'},
+        {NULL, 0, NULL, 0},
+    };
+
+    while ((ch = getopt_long(argc, argv, "s:E:b:t:c:r:v", long_options,
+                             NULL)) != -1) {
         switch (ch) {
         case 's':
             req_flags[0] = strtoul(optarg, NULL, 10);
@@ -304,41 +374,182 @@ int main(int argc, char **argv) {
             break;
 
         case 't':
-            printf("");
-            size_t index = 0;
-            while (optarg[index] != '\0') {
-                index++;
+            if (num_traces == TENANT_MAX) {
+                printf("Error: at most %d traces can share the cache\n",
+                       TENANT_MAX);
+                exit(1);
             }
+            trace_files[num_traces++] = optarg;
+            file_name = trace_files[0];
 
-            size_t length = index + 1;
-            file_name = malloc(sizeof(char) * length);
+            break;
 
-            index = 0;
-            while (index < length) {
-                file_name[index] = optarg[index];
-                index++;
-            }
-            file_name[length - 1] = '\0';
+        case 'c':
+            cache_dir = optarg;
+            break;
 
+        case 'r':
+            if (num_maps == 2) {
+                printf("Error: at most 2 region maps can be given\n");
+                exit(1);
+            }
+            region_maps[num_maps++] = optarg;
+            region_map = region_maps[0];
             break;
 
         case 'v':
             v_flag = 1;
             break;
 
+        case 'J':
+            if (strcmp(optarg, "json") != 0) {
+                printf("Error: unknown stats format '%s'\n", optarg);
+                exit(1);
+            }
+            json_stats = true;
+            break;
+
+        case 'F':
+            stats_file = optarg;
+            break;
+
+        case 'I':
+            use_intervals = true;
+            if (strcmp(optarg, "markers") != 0) {
+                char *end;
+                interval_period = strtoul(optarg, &end, 10);
+                if (*end != '\0' || interval_period == 0) {
+                    printf("Error: invalid interval '%s'\n", optarg);
+                    exit(1);
+                }
+            }
+            break;
+
+        case 'O':
+            interval_file = optarg;
+            break;
+
+        case 'U':
+            serve_socket = optarg;
+            break;
+
+        case 'P':
+            serve_threads = strtoul(optarg, NULL, 10);
+            break;
+
+        case 'M':
+            serve_mem_mb = strtoul(optarg, NULL, 10);
+            break;
+
+        case 'X':
+            if (!cache_indexing_parse(optarg, &indexing)) {
+                printf("Error: unknown indexing '%s'\n", optarg);
+                exit(1);
+            }
+            break;
+
+        case 'R':
+            set_report = optarg;
+            break;
+
+        case 'K': {
+            char *end;
+            slices = strtoul(optarg, &end, 10);
+            if (*end != '\0' || slices == 0 || slices > SLICE_MAX) {
+                printf("Error: slices must be between 1 and %d\n",
+                       SLICE_MAX);
+                exit(1);
+            }
+            break;
+        }
+
+        case 'W': {
+            char *end;
+            warmup = strtoul(optarg, &end, 10);
+            if (*end != '\0' || warmup == SLICE_WARMUP_AUTO) {
+                printf("Error: invalid warm-up '%s'\n", optarg);
+                exit(1);
+            }
+            break;
+        }
+
+        case 'Z':
+            slices_exact = true;
+            break;
+
+        case 'L':
+            interleave = optarg;
+            break;
+
+        case 'A':
+            way_masks = optarg;
+            break;
+
+        case 'Q':
+            outcome_file = optarg;
+            break;
+
+        case 'N':
+            nest_file = optarg;
+            break;
+
+        case 'D':
+            if (num_diffs == 2) {
+                printf("Error: --diff compares 2 outcome files\n");
+                exit(1);
+            }
+            diff_files[num_diffs++] = optarg;
+            break;
+
+        case 'T':
+            if (strcmp(optarg, "binary") == 0) {
+                interval_binary = true;
+            } else if (strcmp(optarg, "csv") != 0) {
+                printf("Error: unknown interval format '%s'\n", optarg);
+                exit(1);
+            }
+            break;
+
         default:
             usage();
             exit(0);
         }
     }
 
-    unsigned long curFlag;
-    for (int i = 0; i < 3; i++) {
-        curFlag = req_flags[i];
-        if (curFlag < 0 || (i == 1 && curFlag == 0)) {
-            printf("Error: E must be > 0 and s, b >= 0\n");
-            exit(0);
+    if (cache_dir != NULL && cache_dir[0] == '\0') {
+        cache_dir = NULL;
+    }
+
+    if (serve_socket != NULL) {
+        return serve_main(serve_socket, cache_dir, (unsigned)serve_threads,
+                          (size_t)serve_mem_mb << 20);
+    }
+
+    if (num_diffs > 0) {
+        if (num_diffs != 2) {
+            printf("Error: --diff compares 2 outcome files\n");
+            exit(1);
+        }
+        return diff_main(diff_files, trace_files, num_traces, region_maps,
+                         num_maps, cache_dir, stdout);
+    }
+
+    if (num_maps > 1) {
+        printf("Error: a run takes one region map\n");
+        exit(1);
+    }
+
+    if (req_flags[1] == 0) {
+        printf("Error: E must be > 0 and s, b >= 0\n");
+        exit(0);
+    }
+
+    if (nest_file != NULL) {
+        if (file_name != NULL || slices > 0) {
+            printf("Error: --nest cannot be combined with -t or --slices\n");
+            exit(1);
         }
+        file_name = nest_file;
     }
 
     if (file_name == NULL) {
@@ -351,19 +562,139 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
+    if (indexing == CSIM_INDEXING_PRIME && req_flags[0] > 32) {
+        printf("Error: prime indexing needs s <= 32\n");
+        exit(1);
+    }
+
+    if (slices > 0 && (v_flag || region_map != NULL || use_intervals ||
+                       set_report != NULL || outcome_file != NULL)) {
+        printf("Error: --slices cannot be combined with -v, -r, --interval, "
+               "--set-report\n       or --outcomes\n");
+        exit(1);
+    }
+
+    if ((interleave != NULL || way_masks != NULL) && num_traces < 2) {
+        printf("Error: --interleave and --ways need several traces\n");
+        exit(1);
+    }
+
+    if (num_traces > 1 &&
+        (v_flag || region_map != NULL || use_intervals ||
+         set_report != NULL || slices > 0 || json_stats ||
+         outcome_file != NULL)) {
+        printf("Error: several traces cannot be combined with -v, -r, "
+               "--interval,\n       --set-report, --slices, --stats or "
+               "--outcomes\n");
+        exit(1);
+    }
+
     if (v_flag) {
         printf("Verbose argumet set to 1...\n");
     }
 
-    int error_status =
-        process_trace_file(file_name, v_flag, req_flags);
+    csim_regions_t *regions = NULL;
+    if (region_map != NULL) {
+        regions = regions_load(region_map);
+        if (regions == NULL) {
+            exit(1);
+        }
+    }
+
+    csim_intervals_t *intervals = NULL;
+    if (use_intervals) {
+        if (interval_binary && interval_file == NULL) {
+            printf("Error: binary intervals need --interval-file\n");
+            exit(1);
+        }
+        intervals = intervals_open(interval_file, interval_binary,
+                                   interval_period, req_flags[2]);
+        if (intervals == NULL) {
+            exit(1);
+        }
+    }
+
+    csim_pressure_t *pressure = NULL;
+    if (set_report != NULL) {
+        pressure = pressure_open(set_report, req_flags[0], req_flags[2],
+                                 indexing);
+        if (pressure == NULL) {
+            exit(1);
+        }
+    }
+
+    csim_outcomes_t *outcomes = NULL;
+    if (outcome_file != NULL) {
+        outcomes = outcomes_open(outcome_file, req_flags[0], req_flags[1],
+                                 req_flags[2], indexing);
+        if (outcomes == NULL) {
+            exit(1);
+        }
+    }
+
+    csim_nest_t *nest = NULL;
+    if (nest_file != NULL) {
+        nest = nest_load(nest_file);
+        if (nest == NULL) {
+            exit(1);
+        }
+    }
+
+    csim_profile_t profile = {0};
+    csim_slice_report_t slice_report;
+    csim_tenants_t *tenants = NULL;
+    int error_status;
+    if (num_traces > 1) {
+        error_status =
+            process_tenants(trace_files, num_traces, cache_dir, req_flags,
+                            indexing, interleave, way_masks, &tenants);
+    } else if (slices > 0) {
+        error_status = process_trace_sliced(
+            file_name, cache_dir, req_flags, indexing, (unsigned)slices,
+            warmup, slices_exact, &slice_report, &profile);
+    } else {
+        error_status = process_trace_file(file_name, nest, cache_dir, v_flag,
+                                          req_flags, indexing, regions,
+                                          intervals, pressure, outcomes,
+                                          &profile);
+        nest_free(nest);
+    }
     if (error_status != 0) {
         printf("Fatal error in parsing the trace file...\n");
         exit(1);
     }
 
     printSummary(stats);
+    if (slices > 0) {
+        slice_print(stdout, &slice_report);
+    }
+    if (tenants != NULL) {
+        printf("\n");
+        tenants_print(tenants, 1UL << req_flags[2], stdout);
+        if (tenants_close(tenants) != 0) {
+            printf("Fatal error in parsing the trace file...\n");
+            exit(1);
+        }
+    }
+    if (regions != NULL) {
+        printf("\n");
+        regions_print(regions, 1UL << req_flags[2], stdout);
+        regions_free(regions);
+    }
+
+    if (json_stats) {
+        FILE *out = stdout;
+        if (stats_file != NULL && (out = fopen(stats_file, "w")) == NULL) {
+            printf("Error: cannot open '%s': %s\n", stats_file,
+                   strerror(errno));
+            exit(1);
+        }
+        stats_print_json(out, file_name, req_flags[0], req_flags[1],
+                         req_flags[2], stats, &profile);
+        if (out != stdout) {
+            fclose(out);
+        }
+    }
 
     free(stats);
-    free(file_name);
 }
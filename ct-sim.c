@@ -0,0 +1,262 @@
+/**
+ * @file ct-sim.c
+ * @brief ContTech runtime that simulates accesses instead of tracing them
+ *
+ * This replaces ct/ct.bc when building tracegen-sim. The CLabInst pass
+ * instruments trans.c with calls into the ContTech runtime around every
+ * memory access. The stock runtime buffers those accesses, serializes them
+ * to the CONTECH_TRACE file, and csim parses them again later. Here, each
+ * access made between __roi_begin() and __roi_end() is fed straight into an
+ * embedded cache simulator instead, and the statistics of every region of
+ * interest are reported with printSummary() when it ends.
+ *
+ * The simulated cache defaults to the geometry used by test-trans
+ * (TEST_LOG_SET, TEST_ASSOC, TEST_LOG_BLOCK). -l selects the Haswell L1
+ * geometry, and -s, -E and -b set it explicitly. These options are
+ * consumed here before the remaining arguments are passed to entry().
+ *
+ * Only the entry points that the CLabInst pass emits calls to are defined.
+ * The ones ct/ct.bc uses internally (__ctGetCurrentTick, __ctInitThread and
+ * the like) are not, so until this has been linked against the real pass,
+ * its programs are built by 'make experimental' rather than 'make all'.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cachelab.h"
+#include "csim-cache.h"
+#include "ct-sim.h"
+
+/** @brief Address bits kept by the ContTech memory operation encoding */
+#define CT_ADDR_MASK ((1UL << 50) - 1)
+
+/**
+ * @brief Layout-compatible stand-in for the ContTech serial buffer.
+ *
+ * Instrumented code only hands buffer pointers back to the runtime, and
+ * nothing is ever stored in this one since accesses are simulated at once.
+ */
+typedef struct {
+    unsigned int pos;
+    unsigned int length;
+    unsigned int id;
+    unsigned int basePos;
+    void *next;
+    char data[64];
+} ct_buffer_t;
+
+static ct_buffer_t buffer;
+static unsigned int next_ctid = 0;
+
+/* Geometry of the simulated cache, set on the command line */
+static unsigned long sim_s = TEST_LOG_SET;
+static unsigned long sim_E = TEST_ASSOC;
+static unsigned long sim_b = TEST_LOG_BLOCK;
+
+/* Cache for the active region of interest, NULL outside of it */
+static csim_cache_t *cache = NULL;
+
+/* Entry point of tracegen-ct */
+extern int entry(int argc, char *argv[]);
+
+static void simulate(const void *addr, char op) {
+    if (cache != NULL &&
+        !cache_access(cache, (uintptr_t)addr & CT_ADDR_MASK, op)) {
+        fprintf(stderr, "Error: insufficient memory for cache sets\n");
+        exit(1);
+    }
+}
+
+void __roi_begin(void) {
+    if (cache != NULL) {
+        cache_free(cache);
+    }
+    cache = cache_new(sim_s, sim_E, sim_b, false);
+    if (cache == NULL) {
+        fprintf(stderr, "Error: insufficient memory for simulated cache\n");
+        exit(1);
+    }
+}
+
+void ct_sim_geometry(unsigned long *s, unsigned long *E, unsigned long *b) {
+    *s = sim_s;
+    *E = sim_E;
+    *b = sim_b;
+}
+
+void ct_sim_end(csim_stats_t *stats) {
+    if (cache == NULL) {
+        *stats = (csim_stats_t){0};
+        return;
+    }
+
+    cache_stats(cache, stats);
+    cache_free(cache);
+    cache = NULL;
+}
+
+void __roi_end(void) {
+    if (cache == NULL) {
+        return;
+    }
+
+    csim_stats_t stats;
+    ct_sim_end(&stats);
+    printSummary(&stats);
+}
+
+void *__ctGetBuffer(void) {
+    return &buffer;
+}
+
+unsigned int __ctGetBufferPos(void *buf) {
+    return ((ct_buffer_t *)buf)->pos;
+}
+
+void *__ctStoreBasicBlock(unsigned int id, unsigned int pos, void *buf) {
+    return ((ct_buffer_t *)buf)->data;
+}
+
+void __ctStoreMemOp(void *addr, char isWrite, unsigned int logSize,
+                    unsigned int index, void *block) {
+    simulate(addr, (isWrite & 1) ? 'S' : 'L');
+}
+
+unsigned int __ctStoreBasicBlockComplete(unsigned int numOps, unsigned int pos,
+                                         void *buf) {
+    return pos;
+}
+
+void __ctCheckBufferSize(unsigned int pos) {}
+
+void __ctCheckBufferBySize(unsigned int numOps) {}
+
+void __ctQueueBuffer(bool alloc) {}
+
+void __ctAllocateLocalBuffer(void) {}
+
+unsigned int __ctAllocateCTid(void) {
+    return __atomic_fetch_add(&next_ctid, 1, __ATOMIC_SEQ_CST);
+}
+
+unsigned int __ctGetLocalNumber(void) {
+    return 0;
+}
+
+void __ctStoreMemoryEvent(bool isAlloc, uint64_t size, void *addr) {
+    fprintf(stderr, "ERROR: ALLOC EVENT\n");
+    exit(1);
+}
+
+/**
+ * @brief Records a bulk operation the same way as the stock runtime: a pair
+ *        of 4-byte loads for every 8 elements of the two arrays.
+ */
+void __ctStoreBulkMemoryEvent(size_t count, void *dst, void *src) {
+    for (size_t i = 0; i < count; i += 8) {
+        simulate((const uint32_t *)src + i, 'L');
+        simulate((const uint32_t *)dst + i, 'L');
+    }
+}
+
+int __ctThreadCreateActual(pthread_t *thread, const pthread_attr_t *attr,
+                           void *(*start_routine)(void *), void *arg) {
+    return pthread_create(thread, attr, start_routine, arg);
+}
+
+/**
+ * @brief Takes a simulator option and its decimal value, either attached
+ *        to the flag ("-s5") or as the following argument ("-s 5").
+ *
+ * Other arguments that merely start with the flag are left alone.
+ *
+ * @return false if argv[*i] is not the option
+ */
+static bool take_option(int argc, char *argv[], int *i, const char *flag,
+                        unsigned long *out) {
+    size_t len = strlen(flag);
+    const char *value = argv[*i] + len;
+    if (strncmp(argv[*i], flag, len) != 0 ||
+        (*value != '\0' && !isdigit((unsigned char)*value))) {
+        return false;
+    }
+    if (*value == '\0') {
+        if (*i + 1 >= argc) {
+            fprintf(stderr, "Error: option %s requires a value\n", flag);
+            exit(1);
+        }
+        value = argv[++*i];
+    }
+
+    char *end;
+    errno = 0;
+    *out = strtoul(value, &end, 10);
+    if (!isdigit((unsigned char)*value) || *end != '\0' || errno != 0) {
+        fprintf(stderr, "Error: invalid value '%s' for option %s\n", value,
+                flag);
+        exit(1);
+    }
+    return true;
+}
+
+/**
+ * @brief Prints the simulator options, ahead of the usage of tracegen-ct
+ */
+static void usage_sim(void) {
+    fprintf(stderr, "Simulator options, taken before the options below:\n");
+    fprintf(stderr, "  -l      Simulate the Haswell L1 (s=%d, E=%d, b=%d)\n",
+            HASWELL_L1_SET, HASWELL_L1_ASSOC, HASWELL_L1_BLOCK);
+    fprintf(stderr, "  -s S    Simulate 2**S sets (default: %d)\n",
+            TEST_LOG_SET);
+    fprintf(stderr, "  -E E    Simulate E lines per set (default: %d)\n",
+            TEST_ASSOC);
+    fprintf(stderr, "  -b B    Simulate 2**B byte blocks (default: %d)\n",
+            TEST_LOG_BLOCK);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char *argv[]) {
+    char **args = calloc((size_t)argc + 1, sizeof(*args));
+    if (args == NULL) {
+        fprintf(stderr, "Error: insufficient memory\n");
+        exit(1);
+    }
+
+    /* Take the simulator options, and leave the rest to tracegen-ct */
+    int nargs = 0;
+    args[nargs++] = argv[0];
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "-l") == 0) {
+            sim_s = HASWELL_L1_SET;
+            sim_E = HASWELL_L1_ASSOC;
+            sim_b = HASWELL_L1_BLOCK;
+        } else if (strcmp(arg, "-h") == 0) {
+            usage_sim();
+            args[nargs++] = argv[i];
+        } else if (!take_option(argc, argv, &i, "-s", &sim_s) &&
+                   !take_option(argc, argv, &i, "-E", &sim_E) &&
+                   !take_option(argc, argv, &i, "-b", &sim_b)) {
+            args[nargs++] = argv[i];
+        }
+    }
+
+    if (sim_E == 0 || sim_s + sim_b > 63) {
+        fprintf(stderr, "Error: E must be > 0 and s + b at most 63\n");
+        exit(1);
+    }
+
+    int status = entry(nargs, args);
+    if (cache != NULL) {
+        cache_free(cache);
+    }
+    free(args);
+    return status;
+}
@@ -0,0 +1,23 @@
+/**
+ * @file ct-sim.h
+ * @brief Interface to the simulating ContTech runtime for its drivers
+ *
+ * Programs linked against ct-sim.c, such as tracegen-sim and trans-tune,
+ * provide entry() and may use these to inspect the simulated cache.
+ */
+
+#ifndef CT_SIM_H
+#define CT_SIM_H
+
+#include "cachelab.h"
+
+/** @brief Reports the geometry of the simulated cache */
+void ct_sim_geometry(unsigned long *s, unsigned long *E, unsigned long *b);
+
+/**
+ * @brief Ends the current region of interest like __roi_end(), but hands
+ *        its statistics to the caller instead of printing them.
+ */
+void ct_sim_end(csim_stats_t *stats);
+
+#endif /* CT_SIM_H */
@@ -7,11 +7,15 @@
  * instructors (csim-ref).
  */
 
+#define _XOPEN_SOURCE 700 // mkdtemp, fdopen, sysconf
+
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
 #include <signal.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -58,124 +62,413 @@ static const trace_info_t TRACE_INFO[N] = {
 
 static int num_runs = 0; // used to randomize input to students' csim
 
+/** @brief Maximum number of simulations run at once (0 = number of CPUs) */
+static long max_jobs = 0;
+
+/** @brief Directory test-csim was started in, used to build absolute paths */
+static char base_dir[MAX_STR / 2];
+
+/**
+ * @brief Variable that hands base_dir to the commands of the jobs, which
+ *        run in directories of their own.
+ *
+ * Commands only name it as a quoted "$TEST_CSIM_DIR", so that the shell
+ * takes the directory as one word, whatever characters it contains.
+ */
+#define BASE_DIR_ENV "TEST_CSIM_DIR"
+#define BASE_DIR "\"$" BASE_DIR_ENV "\""
+
+/**
+ * @brief File, in the directory test-csim was started in, that records the
+ *        results of the reference simulator.
+ *
+ * The reference results of a test only depend on the trace, the cache
+ * parameters and csim-ref itself, so each line records them under a hash
+ * of the trace, the parameters and a hash of csim-ref:
+ *
+ *     <csim-ref hash> <trace hash> <s> <E> <b> <hits> <misses> <evictions>
+ *         <dirty bytes> <dirty evictions>
+ *
+ * Hashes are 64-bit FNV-1a hashes of the file contents, in hexadecimal.
+ * Tests with recorded results only run the simulator being tested.
+ */
+#define REF_RESULTS_FILE ".csim-ref-results"
+
+/** @brief Whether to use recorded reference results */
+static bool use_recorded = true;
+
+#define FNV_OFFSET 0xcbf29ce484222325UL
+#define FNV_PRIME 0x100000001b3UL
+
+/** @brief Results of the reference simulator on one test */
+typedef struct {
+    uint64_t ref_hash;   /* hash of csim-ref */
+    uint64_t trace_hash; /* hash of the trace */
+    int s;
+    int E;
+    int b;
+    csim_stats_t stats;
+} ref_result_t;
+
+/**
+ * @brief A single simulator run scheduled on the worker pool.
+ *
+ * Each run gets a private working directory and a results pipe passed
+ * through CSIM_RESULTS_FD, so that no two runs share .csim_results.
+ * Simulators that ignore CSIM_RESULTS_FD (such as csim-ref) still write
+ * .csim_results, which is then picked up from the private directory.
+ */
+typedef struct {
+    char cmd[2 * MAX_STR];     /* shell command that runs the simulator */
+    const char *name;          /* "reference" or "test", for messages */
+    csim_stats_t *stats;       /* where the results are stored */
+    bool success;              /* whether the results were collected */
+    pid_t pid;                 /* process running the command */
+    int fd;                    /* read end of the results pipe */
+    char dir[MAX_STR];         /* private working directory */
+    char results[2 * MAX_STR]; /* .csim_results in that directory */
+    bool recorded;             /* results were recorded, so it is not run */
+} job_t;
+
+/* Jobs being run, for the timeout handler to clean up after */
+static job_t *volatile active_jobs = NULL;
+static volatile int num_active_jobs = 0;
+
 /*
  * usage - Prints usage info
  */
 static void usage(char *argv[]) {
-    printf("Usage: %s [-h]\n", argv[0]);
+    printf("Usage: %s [-h] [-j <jobs>] [-r]\n", argv[0]);
     printf("Options:\n");
-    printf("  -h    Print this help message.\n");
+    printf("  -h         Print this help message.\n");
+    printf("  -j <jobs>  Run at most <jobs> simulations at once "
+           "(default: one per CPU).\n");
+    printf("  -r         Run the reference simulator even where its results "
+           "are recorded\n             in " REF_RESULTS_FILE ".\n");
 }
 
 /**
  * @brief SIGALRM handler
+ *
+ * Kills the process group of every running job, reaps it and removes its
+ * directory, using only async-signal-safe calls.
  */
 static void sigalrm_handler(int signum) {
     const char *msg = "Error: Program timed out.\n"
                       "TEST_CSIM_RESULTS=0\n";
     ssize_t res = write(STDOUT_FILENO, msg, strlen(msg));
     (void)res;
+
+    job_t *jobs = active_jobs;
+    for (int i = 0; jobs != NULL && i < num_active_jobs; i++) {
+        pid_t pid = jobs[i].pid;
+        if (pid <= 0) {
+            continue;
+        }
+        (void)kill(-pid, SIGKILL);
+        (void)waitpid(pid, NULL, 0);
+        (void)unlink(jobs[i].results);
+        (void)rmdir(jobs[i].dir);
+    }
     _exit(1);
 }
 
 /**
- * @brief Runs a cache simulation and collects the resulting statistics.
+ * @brief Starts a simulation job in its own directory.
  *
- * @param[in]  cmd    The command used to invoke csim
- * @param[out] stats  The statistics collected from this simulation run
- *
- * @return false if any problems, true if OK.
+ * @return false if the job could not be started, true if OK.
  */
-static bool run_csim(const char *cmd, csim_stats_t *stats) {
-    int status;
+static bool start_job(job_t *job) {
+    int fds[2];
 
-    status = unlink(".csim_results");
-    if (status < 0 && errno != ENOENT) {
-        fprintf(stderr, "Error removing old simulation results: %s\n",
-                strerror(errno));
+    snprintf(job->dir, sizeof(job->dir), "/tmp/test-csim.XXXXXX");
+    if (mkdtemp(job->dir) == NULL) {
+        fprintf(stderr, "Error creating run directory: %s\n", strerror(errno));
+        return false;
+    }
+    snprintf(job->results, sizeof(job->results), "%s/%s", job->dir,
+             CSIM_RESULTS_FILE);
+
+    /* Keep the pipe out of every other job's processes */
+    if (pipe(fds) < 0 || fcntl(fds[0], F_SETFD, FD_CLOEXEC) < 0 ||
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC) < 0) {
+        fprintf(stderr, "Error creating results pipe: %s\n", strerror(errno));
+        rmdir(job->dir);
         return false;
     }
 
-    /* Run the simulator command */
-    status = system(cmd);
-    if (status < 0) {
+    job->pid = fork();
+    if (job->pid < 0) {
         fprintf(stderr, "Error invoking csim: %s\n", strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
+        rmdir(job->dir);
         return false;
     }
+
+    if (job->pid == 0) {
+        /* Lead a process group, so a timeout can kill the whole command */
+        (void)setpgid(0, 0);
+        char fd_str[32];
+        snprintf(fd_str, sizeof(fd_str), "%d", fds[1]);
+        if (chdir(job->dir) < 0 || fcntl(fds[1], F_SETFD, 0) < 0 ||
+            setenv(CSIM_RESULTS_FD_ENV, fd_str, 1) < 0 ||
+            setenv(BASE_DIR_ENV, base_dir, 1) < 0) {
+            _exit(127);
+        }
+        unsetenv(CSIM_RESULTS_ENV);
+        execl("/bin/sh", "sh", "-c", job->cmd, (char *)NULL);
+        _exit(127);
+    }
+
+    (void)setpgid(job->pid, job->pid);
+    close(fds[1]);
+    job->fd = fds[0];
+    return true;
+}
+
+/**
+ * @brief Collects the results of a finished simulation job.
+ *
+ * @param[in,out] job    The job that finished
+ * @param[in]     status Exit status of the job, as returned by waitpid
+ */
+static void finish_job(job_t *job, int status) {
+    job->success = false;
     if (WIFEXITED(status) && WEXITSTATUS(status) != 0) {
         fprintf(stderr, "Error running csim: Status %d\n", WEXITSTATUS(status));
-        return false;
+    } else if (!WIFEXITED(status)) {
+        fprintf(stderr, "Error running csim: Signal %d\n", WTERMSIG(status));
+    } else {
+        /* Prefer the pipe, and fall back to .csim_results */
+        FILE *fp = fdopen(job->fd, "r");
+        int c = EOF;
+        if (fp != NULL && (c = fgetc(fp)) != EOF) {
+            ungetc(c, fp);
+            job->success = readSummary(fp, job->stats);
+        } else {
+            FILE *rfp = fopen(job->results, "r");
+            if (rfp != NULL) {
+                job->success = readSummary(rfp, job->stats);
+                fclose(rfp);
+            }
+        }
+        if (fp != NULL) {
+            fclose(fp);
+            job->fd = -1;
+        }
+        if (!job->success) {
+            fprintf(stderr, "Error: Results for csim not found. Use the "
+                            "printSummary() function\n");
+        }
     }
 
-    /* Get the results from the simulator */
-    bool success = loadSummary(stats);
-    if (!success) {
-        fprintf(stderr, "Error: Results for csim not found. Use the "
-                        "printSummary() function\n");
+    if (job->fd >= 0) {
+        close(job->fd);
+    }
+    (void)unlink(job->results);
+    (void)rmdir(job->dir);
+
+    if (!job->success) {
+        fprintf(stderr, "Running %s simulator failed: '%s'\n", job->name,
+                job->cmd);
+        fprintf(stderr, "\n");
+    }
+}
+
+/**
+ * @brief Runs all jobs, keeping at most max_jobs of them running at once.
+ */
+static void run_jobs(job_t jobs[], int njobs) {
+    long limit = max_jobs > 0 ? max_jobs : sysconf(_SC_NPROCESSORS_ONLN);
+    if (limit < 1) {
+        limit = 1;
     }
 
-    status = unlink(".csim_results");
-    (void)status;
+    active_jobs = jobs;
+    num_active_jobs = njobs;
+
+    int next = 0;
+    long running = 0;
+    while (next < njobs || running > 0) {
+        while (next < njobs && running < limit) {
+            if (jobs[next].recorded) {
+                jobs[next].pid = -1;
+            } else if (start_job(&jobs[next])) {
+                running++;
+            } else {
+                jobs[next].pid = -1;
+            }
+            next++;
+        }
+        if (running == 0) {
+            continue;
+        }
 
-    return success;
+        int status;
+        pid_t pid = wait(&status);
+        if (pid < 0) {
+            fprintf(stderr, "Error waiting for csim: %s\n", strerror(errno));
+            break;
+        }
+        for (int i = 0; i < next; i++) {
+            if (jobs[i].pid == pid) {
+                /* Reaped, so the timeout handler must leave it alone */
+                jobs[i].pid = -1;
+                finish_job(&jobs[i], status);
+                running--;
+                break;
+            }
+        }
+    }
+    active_jobs = NULL;
 }
 
 /*
- * @brief Collects run results for a particular trace
+ * @brief Prepares the runs for a particular trace
  *
- * Runs the reference and trace simulators on a particular trace and set of
- * cache parameters, and collects the results for the caller.
+ * Sets up the reference and test simulator runs on a particular trace and
+ * set of cache parameters, which store their results for the caller.
  *
  * @param[in]  info        Information about the trace to run
+ * @param[out] ref_job     Job running the reference simulator
+ * @param[out] test_job    Job running the simulator being tested
  * @param[out] ref_stats   Statistics for the reference simulator
  * @param[out] test_stats  Statistics for the simulator being tested
- *
- * @return false if any problems, true if OK.
  */
-static bool runtrace(const trace_info_t *info, csim_stats_t *ref_stats,
+static void runtrace(const trace_info_t *info, job_t *ref_job,
+                     job_t *test_job, csim_stats_t *ref_stats,
                      csim_stats_t *test_stats) {
-    char cmd[MAX_STR];
-
     /* Run the reference simulator */
-    sprintf(cmd, "./csim-ref -s %d -E %d -b %d -t %s > /dev/null", info->s,
-            info->E, info->b, info->filename);
-    if (!run_csim(cmd, ref_stats)) {
-        fprintf(stderr, "Running reference simulator failed: '%s'\n", cmd);
-        fprintf(stderr, "\n");
-        return false;
-    }
+    snprintf(ref_job->cmd, sizeof(ref_job->cmd),
+             BASE_DIR "/csim-ref -s %d -E %d -b %d -t " BASE_DIR
+                      "/%s > /dev/null",
+             info->s, info->E, info->b, info->filename);
+    ref_job->name = "reference";
+    ref_job->stats = ref_stats;
 
     /* Run the test simulator */
     /* addition 9/28/2017 F17: randomize input to csim to test
      * that students don't hardcode argument parsing */
+    char *cmd = test_job->cmd;
+    size_t len = sizeof(test_job->cmd);
     switch (num_runs % 4) {
     case 0:
-        sprintf(cmd, "./csim -b %d -s %d -t %s -E %d > /dev/null", info->b,
-                info->s, info->filename, info->E);
+        snprintf(cmd, len,
+                 BASE_DIR "/csim -b %d -s %d -t " BASE_DIR
+                          "/%s -E %d > /dev/null",
+                 info->b, info->s, info->filename, info->E);
         break;
     case 1:
-        sprintf(cmd, "./csim -t %s -E %d -s %d -b %d > /dev/null",
-                info->filename, info->E, info->s, info->b);
+        snprintf(cmd, len,
+                 BASE_DIR "/csim -t " BASE_DIR
+                          "/%s -E %d -s %d -b %d > /dev/null",
+                 info->filename, info->E, info->s, info->b);
         break;
     case 2:
-        sprintf(cmd, "./csim -E %d -b %d -t %s -s %d > /dev/null", info->E,
-                info->b, info->filename, info->s);
+        snprintf(cmd, len,
+                 BASE_DIR "/csim -E %d -b %d -t " BASE_DIR
+                          "/%s -s %d > /dev/null",
+                 info->E, info->b, info->filename, info->s);
         break;
     case 3:
-        sprintf(cmd, "./csim -s %d -E %d -b %d -t %s > /dev/null", info->s,
-                info->E, info->b, info->filename);
+        snprintf(cmd, len,
+                 BASE_DIR "/csim -s %d -E %d -b %d -t " BASE_DIR
+                          "/%s > /dev/null",
+                 info->s, info->E, info->b, info->filename);
         break;
     }
+    test_job->name = "test";
+    test_job->stats = test_stats;
 
     num_runs = num_runs + 1;
+}
 
-    if (!run_csim(cmd, test_stats)) {
-        fprintf(stderr, "Running test simulator failed: '%s'\n", cmd);
-        fprintf(stderr, "\n");
+/**
+ * @brief Hashes the contents of a file.
+ *
+ * @return false if the file could not be read, true if OK.
+ */
+static bool hash_file(const char *path, uint64_t *hash) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
         return false;
     }
+    char buf[1 << 16];
+    uint64_t h = FNV_OFFSET;
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        for (size_t i = 0; i < len; i++) {
+            h ^= (unsigned char)buf[i];
+            h *= FNV_PRIME;
+        }
+    }
+    bool ok = !ferror(fp);
+    fclose(fp);
+    *hash = h;
+    return ok;
+}
 
-    return true;
+/**
+ * @brief Reads the recorded reference results, skipping malformed lines.
+ *
+ * @return The results, to be released with free(), or NULL if there are
+ *         none
+ */
+static ref_result_t *load_results(const char *path, size_t *count) {
+    *count = 0;
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return NULL;
+    }
+
+    ref_result_t *results = NULL;
+    size_t capacity = 0;
+    char line[MAX_STR];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        ref_result_t r;
+        unsigned long long ref_hash;
+        unsigned long long trace_hash;
+        if (sscanf(line, "%llx %llx %d %d %d %lu %lu %lu %lu %lu", &ref_hash,
+                   &trace_hash, &r.s, &r.E, &r.b, &r.stats.hits,
+                   &r.stats.misses, &r.stats.evictions, &r.stats.dirty_bytes,
+                   &r.stats.dirty_evictions) != 10) {
+            continue;
+        }
+        if (*count == capacity) {
+            capacity = capacity == 0 ? 2 * N : 2 * capacity;
+            ref_result_t *grown =
+                realloc(results, capacity * sizeof(ref_result_t));
+            if (grown == NULL) {
+                break;
+            }
+            results = grown;
+        }
+        r.ref_hash = ref_hash;
+        r.trace_hash = trace_hash;
+        results[(*count)++] = r;
+    }
+    fclose(fp);
+    return results;
+}
+
+/**
+ * @brief Finds the recorded results of the reference simulator on a test.
+ *
+ * @return The results, or NULL if they are not recorded
+ */
+static const ref_result_t *find_result(const ref_result_t *results,
+                                       size_t count, uint64_t ref_hash,
+                                       uint64_t trace_hash,
+                                       const trace_info_t *info) {
+    for (size_t i = 0; i < count; i++) {
+        const ref_result_t *r = &results[i];
+        if (r->ref_hash == ref_hash && r->trace_hash == trace_hash &&
+            r->s == info->s && r->E == info->E && r->b == info->b) {
+            return r;
+        }
+    }
+    return NULL;
 }
 
 /**
@@ -230,9 +523,62 @@ static void test_csim(void) {
                 ULONG_MAX;
     }
 
-    /* Run the individual tests */
+    /* Run the individual tests concurrently */
+    job_t jobs[2 * N];
+    memset(jobs, 0, sizeof(jobs));
+    for (int i = 0; i < N; i++) {
+        runtrace(&TRACE_INFO[i], &jobs[2 * i], &jobs[2 * i + 1], &ref_stats[i],
+                 &test_stats[i]);
+    }
+
+    /* Only run the reference simulator where its results are not known */
+    char path[MAX_STR];
+    snprintf(path, sizeof(path), "%s/csim-ref", base_dir);
+    uint64_t ref_hash = 0;
+    uint64_t trace_hash[N] = {0};
+    bool hashed = use_recorded && hash_file(path, &ref_hash);
+    for (int i = 0; hashed && i < N; i++) {
+        snprintf(path, sizeof(path), "%s/%s", base_dir, TRACE_INFO[i].filename);
+        hashed = hash_file(path, &trace_hash[i]);
+    }
+    snprintf(path, sizeof(path), "%s/%s", base_dir, REF_RESULTS_FILE);
+    size_t num_recorded = 0;
+    ref_result_t *recorded = hashed ? load_results(path, &num_recorded) : NULL;
+    for (int i = 0; hashed && i < N; i++) {
+        const ref_result_t *r = find_result(recorded, num_recorded, ref_hash,
+                                            trace_hash[i], &TRACE_INFO[i]);
+        if (r != NULL) {
+            ref_stats[i] = r->stats;
+            jobs[2 * i].recorded = true;
+            jobs[2 * i].success = true;
+        }
+    }
+    free(recorded);
+
+    run_jobs(jobs, 2 * N);
+
+    /* Record the reference results that were new */
+    FILE *db = NULL;
+    for (int i = 0; hashed && i < N; i++) {
+        if (jobs[2 * i].recorded || !jobs[2 * i].success) {
+            continue;
+        }
+        if (db == NULL && (db = fopen(path, "a")) == NULL) {
+            break;
+        }
+        const csim_stats_t *st = &ref_stats[i];
+        fprintf(db, "%016llx %016llx %d %d %d %lu %lu %lu %lu %lu\n",
+                (unsigned long long)ref_hash,
+                (unsigned long long)trace_hash[i], TRACE_INFO[i].s,
+                TRACE_INFO[i].E, TRACE_INFO[i].b, st->hits, st->misses,
+                st->evictions, st->dirty_bytes, st->dirty_evictions);
+    }
+    if (db != NULL) {
+        fclose(db);
+    }
+
     for (int i = 0; i < N; i++) {
-        bool success = runtrace(&TRACE_INFO[i], &ref_stats[i], &test_stats[i]);
+        bool success = jobs[2 * i].success && jobs[2 * i + 1].success;
         if (success) {
             points[i] = count_matches(&ref_stats[i], &test_stats[i]) *
                         TRACE_INFO[i].weight;
@@ -264,8 +610,14 @@ int main(int argc, char *argv[]) {
     int c;
 
     /* Parse command line args */
-    while ((c = getopt(argc, argv, "h")) != -1) {
+    while ((c = getopt(argc, argv, "hj:r")) != -1) {
         switch (c) {
+        case 'j':
+            max_jobs = atol(optarg);
+            break;
+        case 'r':
+            use_recorded = false;
+            break;
         case 'h':
             usage(argv);
             exit(0);
@@ -275,6 +627,12 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    if (getcwd(base_dir, sizeof(base_dir)) == NULL) {
+        fprintf(stderr, "Unable to determine working directory: %s\n",
+                strerror(errno));
+        exit(1);
+    }
+
     /* Install timeout handler */
     if (signal(SIGALRM, sigalrm_handler) == SIG_ERR) {
         fprintf(stderr, "Unable to install SIGALRM handler\n");
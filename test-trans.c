@@ -7,8 +7,11 @@
  * official submitted version as well.
  */
 
+#define _XOPEN_SOURCE 700 // mkdtemp, sysconf, posix_memalign, clock_gettime
+
 #include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <limits.h> // for LONG_MAX
 #include <signal.h>
@@ -18,16 +21,58 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/wait.h> // for WEXITSTATUS
+#include <time.h>
 #include <unistd.h>
 
 #include "cachelab.h"
+#include "trans-simd.h"
 
-#define CMD_BUFSIZE 334
+#define CMD_BUFSIZE 1024
 #define FILENAME_BUFSIZE 255
 
+/** @brief Untimed runs of each function before it is benchmarked */
+#define BENCH_WARMUP 3
+
+/** @brief Default number of timed runs of each benchmarked function */
+#define BENCH_REPS 51
+
 /* Globals set on the command line */
 static size_t M = 0;
 static size_t N = 0;
+static long max_jobs = 0; /* 0 = one worker per CPU */
+static bool benchmark = false;
+static long bench_reps = BENCH_REPS;
+
+/** @brief Directory test-trans was started in, used to build absolute paths */
+static char base_dir[FILENAME_BUFSIZE];
+
+/**
+ * @brief State of one transpose function evaluated by a worker process.
+ *
+ * Each worker runs in a private directory, so its trace file and the
+ * .csim_results written by csim-ref cannot collide with other workers.
+ * Its output is kept in a log file there and replayed in function order.
+ */
+typedef struct {
+    pid_t pid;            /* worker process, or -1 if not running */
+    bool done;            /* worker has finished */
+    bool correct;         /* function validated and was simulated */
+    csim_stats_t stats;   /* simulation results if correct */
+    int fd;               /* read end of the pipe carrying the results */
+    char dir[FILENAME_BUFSIZE]; /* private working directory, or "" */
+    char trace[32];       /* name of the trace file in dir */
+} func_job_t;
+
+/** @brief Simulation of each registered function, in registration order */
+static func_job_t jobs[MAX_TRANS_FUNCS];
+
+/** @brief Native timings of one transpose function */
+typedef struct {
+    bool correct;     /* function produced the transpose */
+    double median_ns; /* median time of one transpose */
+    double p99_ns;    /* 99th percentile time of one transpose */
+    double gbps;      /* bytes read and written per second, at the median */
+} bench_result_t;
 
 /** @brief Results of testing the submitted transpose function */
 static struct {
@@ -55,8 +100,8 @@ static unsigned long get_clock_cycles(unsigned long hits,
 static bool generate_trace(const char *file_name, int i) {
     char cmd[CMD_BUFSIZE];
     snprintf(cmd, sizeof(cmd),
-             "CONTECH_TRACE=%s ./tracegen-ct -M %ld -N %ld -F %d", file_name, M,
-             N, i);
+             "CONTECH_TRACE=%s %s/tracegen-ct -M %ld -N %ld -F %d", file_name,
+             base_dir, M, N, i);
 
     int status = system(cmd);
     if (status < 0) {
@@ -97,8 +142,9 @@ static bool generate_trace(const char *file_name, int i) {
 static bool compute_stats(const char *file_name, unsigned int s, unsigned int E,
                           unsigned int b, csim_stats_t *stats) {
     char cmd[CMD_BUFSIZE];
-    snprintf(cmd, sizeof(cmd), "./csim-ref -s %u -E %u -b %u -t %s > /dev/null",
-             s, E, b, file_name);
+    snprintf(cmd, sizeof(cmd),
+             "%s/csim-ref -s %u -E %u -b %u -t %s > /dev/null", base_dir, s, E,
+             b, file_name);
 
     int status = system(cmd);
     if (status < 0) {
@@ -125,71 +171,370 @@ static bool compute_stats(const char *file_name, unsigned int s, unsigned int E,
     return true;
 }
 
+/**
+ * @brief Validate and simulate one transpose function.
+ *
+ * Runs inside a worker process, in the worker's private directory.
+ *
+ * @param[in]  i          Index of the transpose function to evaluate
+ * @param[in]  file_name  Trace file to generate in the directory
+ * @param[out] stats      Statistics computed for the function
+ *
+ * @return True if the function was correct and simulated successfully
+ */
+static bool eval_func(int i, const char *file_name, unsigned int s,
+                      unsigned int E, unsigned int b, csim_stats_t *stats) {
+    /* Run and generate a trace file */
+
+    printf("\nFunction %d out of %d (%s)\n", i, func_counter,
+           func_list[i].description);
+    printf("Step 1: Validating and generating memory traces\n");
+    fflush(stdout);
+
+    if (!generate_trace(file_name, i)) {
+        return false;
+    }
+
+    /* Run the reference simulator */
+    printf("Step 2: Evaluating performance (s=%d, E=%d, b=%d)\n", s, E, b);
+    fflush(stdout);
+    if (!compute_stats(file_name, s, E, b, stats)) {
+        return false;
+    }
+
+    (void)remove(CSIM_RESULTS_FILE);
+    (void)remove(file_name);
+
+    /* Mark this function as correct */
+    printf("Results for func %d (%s): hits:%ld, misses:%ld, evictions:%ld, "
+           "clock_cycles:%ld\n",
+           i, func_list[i].description, stats->hits, stats->misses,
+           stats->evictions, get_clock_cycles(stats->hits, stats->misses));
+    return true;
+}
+
+/**
+ * @brief Starts a worker process that evaluates transpose function i.
+ *
+ * @return True if the worker was started
+ */
+static bool start_func(func_job_t *job, int i, unsigned int s, unsigned int E,
+                       unsigned int b) {
+    int fds[2];
+
+    snprintf(job->trace, sizeof(job->trace), "trace.f%d", i);
+    snprintf(job->dir, sizeof(job->dir), "/tmp/test-trans.XXXXXX");
+    if (mkdtemp(job->dir) == NULL) {
+        printf("Failed to create work directory: %s\n", strerror(errno));
+        job->dir[0] = '\0';
+        return false;
+    }
+    if (pipe(fds) < 0) {
+        printf("Failed to create results pipe: %s\n", strerror(errno));
+        rmdir(job->dir);
+        job->dir[0] = '\0';
+        return false;
+    }
+
+    /* Don't let the workers replay our buffered output */
+    fflush(stdout);
+
+    job->pid = fork();
+    if (job->pid < 0) {
+        printf("Failed to start worker: %s\n", strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
+        rmdir(job->dir);
+        job->dir[0] = '\0';
+        return false;
+    }
+
+    if (job->pid == 0) {
+        /* Lead a process group, so a timeout can kill tracegen-ct and
+         * csim-ref along with the worker */
+        (void)setpgid(0, 0);
+        close(fds[0]);
+        int log_fd = -1;
+        if (chdir(job->dir) == 0) {
+            log_fd = open("log", O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        }
+        if (log_fd < 0 || dup2(log_fd, STDOUT_FILENO) < 0) {
+            _exit(1);
+        }
+        close(log_fd);
+
+        csim_stats_t stats;
+        bool correct = eval_func(i, job->trace, s, E, b, &stats);
+        fflush(stdout);
+        if (correct) {
+            ssize_t res = write(fds[1], &stats, sizeof(stats));
+            (void)res;
+        }
+        _exit(0);
+    }
+
+    (void)setpgid(job->pid, job->pid);
+    close(fds[1]);
+    job->fd = fds[0];
+    return true;
+}
+
+/**
+ * @brief Collects the results of a finished worker and replays its output.
+ */
+static void finish_func(func_job_t *job) {
+    char path[2 * FILENAME_BUFSIZE];
+
+    job->correct = read(job->fd, &job->stats, sizeof(job->stats)) ==
+                   (ssize_t)sizeof(job->stats);
+    close(job->fd);
+
+    snprintf(path, sizeof(path), "%s/log", job->dir);
+    FILE *log = fopen(path, "r");
+    if (log != NULL) {
+        char buf[BUFSIZ];
+        size_t len;
+        while ((len = fread(buf, 1, sizeof(buf), log)) > 0) {
+            fwrite(buf, 1, len, stdout);
+        }
+        fclose(log);
+        (void)remove(path);
+    }
+
+    /* Clean up anything left behind by a failed run */
+    snprintf(path, sizeof(path), "%s/%s", job->dir, CSIM_RESULTS_FILE);
+    (void)remove(path);
+    snprintf(path, sizeof(path), "%s/%s", job->dir, job->trace);
+    (void)remove(path);
+    (void)rmdir(job->dir);
+    job->dir[0] = '\0';
+}
+
 /**
  * @brief Evaluate the performance of the registered transpose functions
+ *
+ * Each function is validated, traced and simulated by its own worker
+ * process, with at most max_jobs workers running at once. Output and
+ * results are reported in function order once a function and all the
+ * functions before it have finished.
  */
 static void eval_perf(unsigned int s, unsigned int E, unsigned int b,
                       bool submission_only) {
-
     registerFunctions();
 
-    /* Evaluate the performance of each registered transpose function */
+    /* Remember which function is the submission */
     for (int i = 0; i < func_counter; i++) {
-        /* Remember if this function is the submission */
         if (strcmp(func_list[i].description, SUBMIT_DESCRIPTION) == 0) {
             results.funcid = i;
         }
+    }
+
+    long limit = max_jobs > 0 ? max_jobs : sysconf(_SC_NPROCESSORS_ONLN);
+    if (limit < 1) {
+        limit = 1;
+    }
+
+    int next_start = 0;
+    int next_report = 0;
+    long running = 0;
+    while (next_report < func_counter) {
+        while (next_start < func_counter && running < limit) {
+            func_job_t *job = &jobs[next_start];
+            job->pid = -1;
+            job->fd = -1;
+            if (submission_only && results.funcid != next_start) {
+                /* Skip testing non-submission functions */
+                job->done = true;
+            } else if (start_func(job, next_start, s, E, b)) {
+                running++;
+            } else {
+                job->done = true;
+            }
+            next_start++;
+        }
 
-        /* Skip testing non-submission functions */
-        if (submission_only && results.funcid != i) {
+        /* Report finished functions in order */
+        while (next_report < next_start && jobs[next_report].done) {
+            func_job_t *job = &jobs[next_report];
+            if (job->fd >= 0) {
+                finish_func(job);
+            }
+
+            /* If it is transpose_submit(), record number of misses */
+            if (results.funcid == next_report && job->correct) {
+                memcpy(&results.stats, &job->stats, sizeof(results.stats));
+                results.correct = true;
+            }
+            next_report++;
+        }
+        if (running == 0) {
             continue;
         }
 
-        /* Run and generate a trace file */
-        char file_name[FILENAME_BUFSIZE];
-        sprintf(file_name, "trace.f%d", i);
+        int status;
+        pid_t pid = wait(&status);
+        if (pid < 0) {
+            printf("Failed to wait for worker: %s\n", strerror(errno));
+            return;
+        }
+        for (int i = next_report; i < next_start; i++) {
+            if (jobs[i].pid == pid && !jobs[i].done) {
+                jobs[i].done = true;
+                running--;
+                break;
+            }
+        }
+    }
+}
 
-        printf("\nFunction %d out of %d (%s)\n", i, func_counter,
-               func_list[i].description);
-        printf("Step 1: Validating and generating memory traces\n");
+/** @brief Returns the current time in nanoseconds */
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
 
-        if (!generate_trace(file_name, i)) {
-            continue;
-        }
+static int compare_doubles(const void *a, const void *b) {
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
 
-        /* Run the reference simulator */
-        csim_stats_t stats;
+/**
+ * @brief Times one transpose function natively.
+ *
+ * The function is first run BENCH_WARMUP times, which also checks that it
+ * transposes correctly, then timed over bench_reps runs.
+ *
+ * @param[out] samples  Scratch space for bench_reps timings
+ */
+static void bench_func(const trans_func_t *func, double A[N][M],
+                       double B[M][N], double Btarg[M][N], double *tmp,
+                       double *samples, bench_result_t *res) {
+    memset(res, 0, sizeof(*res));
+    for (int r = 0; r < BENCH_WARMUP; r++) {
+        memset(B, 0, M * N * sizeof(double));
+        func->func_ptr(M, N, A, B, tmp);
+    }
+    if (memcmp(B, Btarg, M * N * sizeof(double)) != 0) {
+        return;
+    }
 
-        printf("Step 2: Evaluating performance (s=%d, E=%d, b=%d)\n", s, E, b);
-        if (!compute_stats(file_name, s, E, b, &stats)) {
-            continue;
-        }
+    for (long r = 0; r < bench_reps; r++) {
+        double start = now_ns();
+        func->func_ptr(M, N, A, B, tmp);
+        samples[r] = now_ns() - start;
+    }
+    qsort(samples, (size_t)bench_reps, sizeof(*samples), compare_doubles);
 
-        (void)remove(".csim_results");
+    size_t p99 = ((size_t)bench_reps * 99 + 99) / 100 - 1;
+    res->correct = true;
+    res->median_ns = samples[bench_reps / 2];
+    res->p99_ns = samples[p99];
+    res->gbps = (double)(2 * M * N * sizeof(double)) / res->median_ns;
+}
 
-        /* Mark this function as correct */
-        printf("Results for func %d (%s): hits:%ld, misses:%ld, evictions:%ld, "
-               "clock_cycles:%ld\n",
-               i, func_list[i].description, stats.hits, stats.misses,
-               stats.evictions, get_clock_cycles(stats.hits, stats.misses));
+/**
+ * @brief Benchmarks the registered functions, and the SIMD kernels for
+ *        reference, and prints their native and simulated rankings.
+ *
+ * Runs after eval_perf(), so the simulated cycles of each registered
+ * function are known unless it failed or was skipped.
+ */
+static void eval_native(void) {
+    static trans_func_t funcs[MAX_TRANS_FUNCS + SIMD_MAX_KERNELS];
+    static bench_result_t bench[MAX_TRANS_FUNCS + SIMD_MAX_KERNELS];
+    static long cycles[MAX_TRANS_FUNCS + SIMD_MAX_KERNELS];
+
+    int count = func_counter;
+    memcpy(funcs, func_list, (size_t)func_counter * sizeof(*funcs));
+    count += simd_kernels(&funcs[count]);
+
+    void *a_mem, *b_mem, *targ_mem, *tmp_mem;
+    double *samples = calloc((size_t)bench_reps, sizeof(*samples));
+    if (posix_memalign(&a_mem, 64, N * M * sizeof(double)) != 0 ||
+        posix_memalign(&b_mem, 64, M * N * sizeof(double)) != 0 ||
+        posix_memalign(&targ_mem, 64, M * N * sizeof(double)) != 0 ||
+        posix_memalign(&tmp_mem, 64, TMPCOUNT * sizeof(double)) != 0 ||
+        samples == NULL) {
+        printf("Failed to allocate benchmark matrices\n");
+        return;
+    }
+    double(*A)[M] = a_mem;
+    double(*B)[N] = b_mem;
+    double(*Btarg)[N] = targ_mem;
+    initMatrix(M, N, A, B);
+    correctTrans(M, N, A, Btarg);
+
+    for (int i = 0; i < count; i++) {
+        bench_func(&funcs[i], A, B, Btarg, tmp_mem, samples, &bench[i]);
+        bool simulated = i < func_counter && jobs[i].done && jobs[i].correct;
+        cycles[i] = simulated ? (long)get_clock_cycles(jobs[i].stats.hits,
+                                                       jobs[i].stats.misses)
+                              : -1;
+    }
+
+    printf("\nNative benchmark (%zux%zu, median of %ld runs after %d "
+           "warm-up runs)\n",
+           M, N, bench_reps, BENCH_WARMUP);
+    printf("%-4s %-36s %12s %4s %12s %12s %7s %4s\n", "Func", "Description",
+           "Sim cycles", "Rank", "Median ns", "p99 ns", "GB/s", "Rank");
+    for (int i = 0; i < count; i++) {
+        /* Rank each function by simulated cycles and by median time */
+        int sim_rank = 1;
+        int native_rank = 1;
+        for (int j = 0; j < count; j++) {
+            if (cycles[j] >= 0 && cycles[j] < cycles[i]) {
+                sim_rank++;
+            }
+            if (bench[j].correct && bench[j].median_ns < bench[i].median_ns) {
+                native_rank++;
+            }
+        }
 
-        /* If it is transpose_submit(), record number of misses */
-        if (results.funcid == i) {
-            memcpy(&results.stats, &stats, sizeof(results.stats));
-            results.correct = true;
+        char id[8];
+        if (i < func_counter) {
+            snprintf(id, sizeof(id), "%d", i);
+        } else {
+            snprintf(id, sizeof(id), "-");
+        }
+        printf("%-4s %-36.36s ", id, funcs[i].description);
+        if (cycles[i] >= 0) {
+            printf("%12ld %4d ", cycles[i], sim_rank);
+        } else {
+            printf("%12s %4s ", "-", "-");
+        }
+        if (bench[i].correct) {
+            printf("%12.0f %12.0f %7.2f %4d\n", bench[i].median_ns,
+                   bench[i].p99_ns, bench[i].gbps, native_rank);
+        } else {
+            printf("%12s %12s %7s %4s\n", "incorrect", "-", "-", "-");
         }
     }
+
+    free(samples);
+    free(tmp_mem);
+    free(targ_mem);
+    free(b_mem);
+    free(a_mem);
 }
 
 /**
  * @brief Print usage info
  */
 static void usage(char *argv[]) {
-    printf("Usage: %s [-h] [-s] -M <rows> -N <cols>\n", argv[0]);
+    printf("Usage: %s [-h] [-s] [-l] [-b] [-r <reps>] [-j <jobs>] -M <rows> "
+           "-N <cols>\n",
+           argv[0]);
     printf("Options:\n");
     printf("  -h          Print this help message.\n");
     printf("  -s          Check official submission only.\n");
     printf("  -l          Simulate large (Haswell L1) cache\n");
+    printf("  -b          Also benchmark each function natively\n");
+    printf("  -r <reps>   Time <reps> runs per benchmark (default: %d)\n",
+           BENCH_REPS);
+    printf("  -j <jobs>   Evaluate at most <jobs> functions at once "
+           "(default: one per CPU)\n");
     printf("  -M <rows>   Number of destination matrix rows (max %d)\n", MAXN);
     printf("  -N <cols>   Number of destination matrix columns (max %d)\n",
            MAXN);
@@ -209,12 +554,34 @@ static void sigsegv_handler(int signum) {
 
 /**
  * @brief SIGALRM handler
+ *
+ * Kills the process group of every running worker, reaps it and removes
+ * its directory, using only async-signal-safe calls.
  */
 static void sigalrm_handler(int signum) {
     const char *msg = "Error: Program timed out.\n"
                       "TEST_TRANS_RESULTS=0:0\n";
     ssize_t res = write(STDOUT_FILENO, msg, strlen(msg));
     (void)res;
+
+    for (int i = 0; i < MAX_TRANS_FUNCS; i++) {
+        func_job_t *job = &jobs[i];
+        if (job->dir[0] == '\0') {
+            continue;
+        }
+        if (job->pid > 0 && !job->done) {
+            (void)kill(-job->pid, SIGKILL);
+            (void)waitpid(job->pid, NULL, 0);
+        }
+        int dir_fd = open(job->dir, O_RDONLY | O_DIRECTORY);
+        if (dir_fd >= 0) {
+            (void)unlinkat(dir_fd, "log", 0);
+            (void)unlinkat(dir_fd, CSIM_RESULTS_FILE, 0);
+            (void)unlinkat(dir_fd, job->trace, 0);
+            close(dir_fd);
+        }
+        (void)rmdir(job->dir);
+    }
     _exit(1);
 }
 
@@ -228,8 +595,17 @@ int main(int argc, char *argv[]) {
     bool submission_only = false;
     bool use_large_cache = false;
 
-    while ((c = getopt(argc, argv, "hcslM:N:")) != -1) {
+    while ((c = getopt(argc, argv, "hcslbr:j:M:N:")) != -1) {
         switch (c) {
+        case 'j':
+            max_jobs = atol(optarg);
+            break;
+        case 'b':
+            benchmark = true;
+            break;
+        case 'r':
+            bench_reps = atol(optarg);
+            break;
         case 'M':
             M = (size_t)atoi(optarg);
             break;
@@ -257,12 +633,23 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
+    if (bench_reps < 1) {
+        printf("Error: -r must be at least 1\n");
+        exit(1);
+    }
+
     if (M > MAXN || N > MAXN) {
         printf("Error: M or N exceeds %d\n", MAXN);
         usage(argv);
         exit(1);
     }
 
+    if (getcwd(base_dir, sizeof(base_dir)) == NULL) {
+        printf("Error: Unable to determine working directory: %s\n",
+               strerror(errno));
+        exit(1);
+    }
+
     /* Install SIGSEGV and SIGALRM handlers */
     if (signal(SIGSEGV, sigsegv_handler) == SIG_ERR) {
         fprintf(stderr, "Unable to install SIGALRM handler\n");
@@ -287,6 +674,10 @@ int main(int argc, char *argv[]) {
         eval_perf(TEST_LOG_SET, TEST_ASSOC, TEST_LOG_BLOCK, submission_only);
     }
 
+    if (benchmark) {
+        eval_native();
+    }
+
     /* Emit the results for this particular test */
     if (results.funcid == -1) {
         printf("\nError: We could not find your transpose_submit() function\n");
@@ -305,12 +696,5 @@ int main(int argc, char *argv[]) {
         status = !results.correct;
     }
 
-    /* Remove hidden trace files */
-    for (int i = 0; i < MAX_TRANS_FUNCS; i++) {
-        char traceFile[FILENAME_BUFSIZE];
-        snprintf(traceFile, sizeof(traceFile), "trace.f%d", i);
-        remove(traceFile);
-    }
-
     return status;
 }
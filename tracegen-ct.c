@@ -8,9 +8,13 @@
  * all of the accesses together.
  */
 
+#define _XOPEN_SOURCE 600 // posix_memalign
+
 #include "cachelab.h"
 #include <assert.h>
+#include <errno.h>
 #include <getopt.h>
+#include <inttypes.h>
 #include <signal.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -24,21 +28,62 @@
 extern void __roi_begin(void);
 extern void __roi_end(void);
 
-/* Need to make sure A and B start on cache block boundaries */
-static double bigA[MAXN][MAXN] __attribute__((aligned(64)));
-static double bigT[TMPCOUNT] __attribute__((aligned(64)));
-static double bigB[MAXN][MAXN] __attribute__((aligned(64)));
-static double bigAcopy[MAXN][MAXN];
-static double bigBtarg[MAXN][MAXN];
+/** @brief Extra rows of B checked for out-of-bounds writes */
+#define OOB_ROWS 10
+
+/**
+ * @brief Alignment of the traced arena, and of T within it.
+ *
+ * Each cache geometry we simulate spans at most this many bytes per way, so
+ * keeping T and B at fixed offsets modulo it reproduces the set mapping of
+ * the former static [MAXN][MAXN] arrays (A, then T, then B).
+ */
+#define LAYOUT_ALIGN 65536
+
+/* Traced matrices, sized for M and N by alloc_matrices() */
+static double *bigA;
+static double *bigT;
+static double *bigB;
+static double *bigAcopy;
+static double *bigBtarg;
 static size_t M;
 static size_t N;
 
+/**
+ * @brief Allocates zeroed matrices for an M x N run.
+ *
+ * A, T and B share one arena so they keep the old relative layout: A starts
+ * the arena, T starts on the first LAYOUT_ALIGN boundary after A, and B
+ * directly follows T. All three start on cache block boundaries, and B has
+ * OOB_ROWS spare rows that validate() checks for stray writes.
+ */
+static void alloc_matrices(void) {
+    size_t a_bytes = N * M * sizeof(double);
+    size_t t_off = (a_bytes + LAYOUT_ALIGN - 1) & ~(size_t)(LAYOUT_ALIGN - 1);
+    size_t b_off = t_off + TMPCOUNT * sizeof(double);
+    size_t total = b_off + (M + OOB_ROWS) * N * sizeof(double);
+
+    void *arena;
+    int res = posix_memalign(&arena, LAYOUT_ALIGN, total);
+    bigAcopy = calloc(N * M, sizeof(double));
+    bigBtarg = calloc(M * N, sizeof(double));
+    if (res != 0 || bigAcopy == NULL || bigBtarg == NULL) {
+        fprintf(stderr, "Failed to allocate memory: %s\n",
+                strerror(res != 0 ? res : ENOMEM));
+        exit(1);
+    }
+
+    /* Clear out matrices */
+    memset(arena, 0, total);
+    bigA = arena;
+    bigT = (double *)((char *)arena + t_off);
+    bigB = (double *)((char *)arena + b_off);
+}
+
 bool validate(int fn, double A[N][M], double Acopy[N][M], double B[M][N],
               double Btarg[M][N]) {
     size_t i, j;
-    size_t xM = M + 10;
-    if (xM > MAXN)
-        xM = MAXN;
+    size_t xM = M + OOB_ROWS;
     for (i = 0; i < M; i++) {
         for (j = 0; j < N; j++) {
             if (B[i][j] != Btarg[i][j]) {
@@ -78,11 +123,38 @@ bool validate(int fn, double A[N][M], double Acopy[N][M], double B[M][N],
     return true;
 }
 
+/**
+ * @brief Writes a csim region map naming the traced matrices.
+ *
+ * A and T cover their data, and B also covers its OOB_ROWS spare rows, so
+ * stray writes are attributed to B.
+ */
+static bool write_regions(const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Error opening '%s': %s\n", path, strerror(errno));
+        return false;
+    }
+    uintptr_t a = (uintptr_t)bigA;
+    uintptr_t t = (uintptr_t)bigT;
+    uintptr_t b = (uintptr_t)bigB;
+    fprintf(fp, "# Regions of the %zux%zu transpose, for csim -r\n", M, N);
+    fprintf(fp, "A %" PRIxPTR " %" PRIxPTR "\n", a,
+            a + N * M * sizeof(double));
+    fprintf(fp, "T %" PRIxPTR " %" PRIxPTR "\n", t,
+            t + TMPCOUNT * sizeof(double));
+    fprintf(fp, "B %" PRIxPTR " %" PRIxPTR "\n", b,
+            b + (M + OOB_ROWS) * N * sizeof(double));
+    return fclose(fp) == 0;
+}
+
 static void usage(char *cmd) {
-    fprintf(stderr, "Usage: %s [-h] [-M M] [-N N] [-F ID]\n", cmd);
+    fprintf(stderr, "Usage: %s [-h] [-M M] [-N N] [-F ID] [-r FILE]\n",
+            cmd);
     fprintf(stderr, "  -N N    Set number of rows of A / cols of B\n");
     fprintf(stderr, "  -M M    Set number of cols of A / rows of B\n");
     fprintf(stderr, "  -F ID   Run function number ID\n");
+    fprintf(stderr, "  -r FILE Write a csim region map of A, T and B\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "The generated trace file is written to default.trace "
                     "by default, but a\n");
@@ -111,7 +183,8 @@ int entry(int argc, char *argv[]) {
 
     int c;
     int selectedFunc = -1;
-    while ((c = getopt(argc, argv, "hvM:N:F:")) != -1) {
+    const char *region_map = NULL;
+    while ((c = getopt(argc, argv, "hvM:N:F:r:")) != -1) {
         switch (c) {
         case 'M':
             M = (size_t)atoi(optarg);
@@ -122,6 +195,9 @@ int entry(int argc, char *argv[]) {
         case 'F':
             selectedFunc = atoi(optarg);
             break;
+        case 'r':
+            region_map = optarg;
+            break;
         case 'v':
             break;
         case 'h':
@@ -149,36 +225,40 @@ int entry(int argc, char *argv[]) {
     /*  Register transpose functions */
     registerFunctions();
 
-    /* Clear out matrices */
-    memset(bigA, 0, sizeof(bigA));
-    memset(bigB, 0, sizeof(bigB));
+    /* Allocate only what this M x N run touches */
+    alloc_matrices();
+    double(*A)[M] = (double(*)[M])bigA;
+    double(*B)[N] = (double(*)[N])bigB;
+    double(*Acopy)[M] = (double(*)[M])bigAcopy;
+    double(*Btarg)[N] = (double(*)[N])bigBtarg;
+    if (region_map != NULL && !write_regions(region_map)) {
+        exit(1);
+    }
 
     /* Fill A with data */
-    initMatrix(M, N, bigA, bigB);
+    initMatrix(M, N, A, B);
     /* Make copy of A */
-    memset(bigAcopy, 0, sizeof(bigAcopy));
-    copyMatrix(M, N, bigAcopy, bigA);
+    copyMatrix(M, N, Acopy, A);
     /* Generate target version */
-    memset(bigBtarg, 0, sizeof(bigBtarg));
-    correctTrans(M, N, bigA, bigBtarg);
+    correctTrans(M, N, A, Btarg);
 
     if (-1 == selectedFunc) {
         /* Invoke registered transpose functions */
         for (i = 0; i < func_counter; i++) {
-            memset(bigT, 0, sizeof(bigT));
+            memset(bigT, 0, TMPCOUNT * sizeof(double));
             __roi_begin();
-            (*func_list[i].func_ptr)(M, N, bigA, bigB, bigT);
+            (*func_list[i].func_ptr)(M, N, A, B, bigT);
             __roi_end();
-            if (!validate(i, bigA, bigAcopy, bigB, bigBtarg)) {
+            if (!validate(i, A, Acopy, B, Btarg)) {
                 return i + 1;
             }
         }
     } else {
-        memset(bigT, 0, sizeof(bigT));
+        memset(bigT, 0, TMPCOUNT * sizeof(double));
         __roi_begin();
-        (*func_list[selectedFunc].func_ptr)(M, N, bigA, bigB, bigT);
+        (*func_list[selectedFunc].func_ptr)(M, N, A, B, bigT);
         __roi_end();
-        if (!validate(selectedFunc, bigA, bigAcopy, bigB, bigBtarg)) {
+        if (!validate(selectedFunc, A, Acopy, B, Btarg)) {
             return 1;
         }
     }
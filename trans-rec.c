@@ -0,0 +1,265 @@
+/**
+ * @file trans-rec.c
+ * @brief Runtime of the in-source access recorder, for tracegen-rec
+ *
+ * tracegen-rec links tracegen-ct.c against a build of trans.c with
+ * TRANS_RECORD defined, where every TRANS_COPY() in the transpose functions
+ * calls trans_record_copy(). This captures the same element accesses as the
+ * ContTech pipeline of tracegen-ct without any LLVM tools, and this file
+ * stands in for its runtime: it provides main(), __roi_begin() and
+ * __roi_end() around the unchanged entry() and validate().
+ *
+ * Copies made between __roi_begin() and __roi_end() are appended to a ring
+ * of decoded accesses. A full ring, and the ring at the end of each region
+ * of interest, is drained in one go, either into a trace in the text format
+ * of tracegen-ct, or with -S into an embedded cache simulator through the
+ * same-block run filter, whose statistics are reported with printSummary()
+ * when the region ends. -l, -s, -E and -b choose the simulated geometry as
+ * for tracegen-sim, and imply -S.
+ *
+ * Only the element copies are recorded. Accesses the compiler makes on its
+ * own, such as spills of locals, are not, while the ContTech pass would
+ * record them; the transpose functions are built to keep those out.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cachelab.h"
+#include "csim-cache.h"
+#include "csim-filter.h"
+#include "csim-trace.h"
+
+/** @brief Number of accesses the ring holds */
+#define RING_SIZE 65536
+
+/** @brief Longest text line of a recorded access, "S <16 digits>,8\n" */
+#define LINE_MAX_LEN 22
+
+/** @brief Trace written when CONTECH_TRACE is not set, as by tracegen-ct */
+#define DEFAULT_TRACE "default.trace"
+
+static csim_access_t ring[RING_SIZE];
+static size_t ring_len = 0;
+static bool recording = false;
+
+/* Text trace being written, when not simulating */
+static FILE *trace_fp = NULL;
+static char text[RING_SIZE * LINE_MAX_LEN];
+
+/* Geometry of the simulated cache, set on the command line */
+static bool simulating = false;
+static unsigned long sim_s = TEST_LOG_SET;
+static unsigned long sim_E = TEST_ASSOC;
+static unsigned long sim_b = TEST_LOG_BLOCK;
+
+/* Cache for the active region of interest, NULL outside of it */
+static csim_cache_t *cache = NULL;
+static run_filter_t filter;
+
+/* Entry point of tracegen-ct */
+extern int entry(int argc, char *argv[]);
+
+/** @brief Formats the accesses of the ring as trace lines */
+static size_t format_ring(void) {
+    static const char digits[] = "0123456789abcdef";
+    char *p = text;
+    for (size_t i = 0; i < ring_len; i++) {
+        *p++ = ring[i].op;
+        *p++ = ' ';
+        unsigned long addr = ring[i].addr;
+        int shift = 60;
+        while (shift > 0 && (addr >> shift) == 0) {
+            shift -= 4;
+        }
+        for (; shift >= 0; shift -= 4) {
+            *p++ = digits[(addr >> shift) & 0xf];
+        }
+        *p++ = ',';
+        *p++ = (char)('0' + ring[i].size);
+        *p++ = '\n';
+    }
+    return (size_t)(p - text);
+}
+
+/** @brief Hands the accesses of the ring to the trace or the simulator */
+static void drain(void) {
+    if (cache != NULL) {
+        run_filter_batch(&filter, ring, ring_len);
+    } else if (trace_fp != NULL) {
+        size_t len = format_ring();
+        if (fwrite(text, 1, len, trace_fp) != len) {
+            fprintf(stderr, "Error writing the trace: %s\n",
+                    strerror(errno));
+            exit(1);
+        }
+    }
+    ring_len = 0;
+}
+
+void trans_record_copy(const double *dst, const double *src) {
+    if (!recording) {
+        return;
+    }
+    if (ring_len + 2 > RING_SIZE) {
+        drain();
+    }
+    ring[ring_len++] = (csim_access_t){
+        .addr = (uintptr_t)src, .size = sizeof(double), .op = 'L'};
+    ring[ring_len++] = (csim_access_t){
+        .addr = (uintptr_t)dst, .size = sizeof(double), .op = 'S'};
+}
+
+void __roi_begin(void) {
+    if (simulating) {
+        if (cache != NULL) {
+            cache_free(cache);
+        }
+        cache = cache_new(sim_s, sim_E, sim_b, false);
+        if (cache == NULL) {
+            fprintf(stderr,
+                    "Error: insufficient memory for simulated cache\n");
+            exit(1);
+        }
+        run_filter_init(&filter, cache, sim_b);
+    }
+    recording = true;
+}
+
+void __roi_end(void) {
+    drain();
+    recording = false;
+    if (cache == NULL) {
+        return;
+    }
+
+    if (!run_filter_flush(&filter)) {
+        fprintf(stderr, "Error: insufficient memory for cache sets\n");
+        exit(1);
+    }
+    csim_stats_t stats;
+    cache_stats(cache, &stats);
+    cache_free(cache);
+    cache = NULL;
+    printSummary(&stats);
+}
+
+/**
+ * @brief Takes a simulator option and its decimal value, either attached
+ *        to the flag ("-s5") or as the following argument ("-s 5").
+ *
+ * Other arguments that merely start with the flag are left alone.
+ *
+ * @return false if argv[*i] is not the option
+ */
+static bool take_option(int argc, char *argv[], int *i, const char *flag,
+                        unsigned long *out) {
+    size_t len = strlen(flag);
+    const char *value = argv[*i] + len;
+    if (strncmp(argv[*i], flag, len) != 0 ||
+        (*value != '\0' && !isdigit((unsigned char)*value))) {
+        return false;
+    }
+    if (*value == '\0') {
+        if (*i + 1 >= argc) {
+            fprintf(stderr, "Error: option %s requires a value\n", flag);
+            exit(1);
+        }
+        value = argv[++*i];
+    }
+
+    char *end;
+    errno = 0;
+    *out = strtoul(value, &end, 10);
+    if (!isdigit((unsigned char)*value) || *end != '\0' || errno != 0) {
+        fprintf(stderr, "Error: invalid value '%s' for option %s\n", value,
+                flag);
+        exit(1);
+    }
+    return true;
+}
+
+/**
+ * @brief Prints the recorder options, ahead of the usage of tracegen-ct
+ */
+static void usage_rec(void) {
+    fprintf(stderr, "Recorder options, taken before the options below:\n");
+    fprintf(stderr, "  -S      Simulate the accesses instead of writing a "
+                    "trace\n");
+    fprintf(stderr, "  -l      Simulate the Haswell L1 (s=%d, E=%d, b=%d)\n",
+            HASWELL_L1_SET, HASWELL_L1_ASSOC, HASWELL_L1_BLOCK);
+    fprintf(stderr, "  -s S    Simulate 2**S sets (default: %d)\n",
+            TEST_LOG_SET);
+    fprintf(stderr, "  -E E    Simulate E lines per set (default: %d)\n",
+            TEST_ASSOC);
+    fprintf(stderr, "  -b B    Simulate 2**B byte blocks (default: %d)\n",
+            TEST_LOG_BLOCK);
+    fprintf(stderr, "  -l, -s, -E and -b imply -S.\n");
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char *argv[]) {
+    char **args = calloc((size_t)argc + 1, sizeof(*args));
+    if (args == NULL) {
+        fprintf(stderr, "Error: insufficient memory\n");
+        exit(1);
+    }
+
+    /* Take the recorder options, and leave the rest to tracegen-ct */
+    int nargs = 0;
+    args[nargs++] = argv[0];
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "-S") == 0) {
+            simulating = true;
+        } else if (strcmp(arg, "-l") == 0) {
+            simulating = true;
+            sim_s = HASWELL_L1_SET;
+            sim_E = HASWELL_L1_ASSOC;
+            sim_b = HASWELL_L1_BLOCK;
+        } else if (take_option(argc, argv, &i, "-s", &sim_s) ||
+                   take_option(argc, argv, &i, "-E", &sim_E) ||
+                   take_option(argc, argv, &i, "-b", &sim_b)) {
+            simulating = true;
+        } else {
+            if (strcmp(arg, "-h") == 0) {
+                usage_rec();
+            }
+            args[nargs++] = argv[i];
+        }
+    }
+
+    if (sim_E == 0 || sim_s + sim_b > 63) {
+        fprintf(stderr, "Error: E must be > 0 and s + b at most 63\n");
+        exit(1);
+    }
+
+    if (!simulating) {
+        const char *path = getenv("CONTECH_TRACE");
+        if (path == NULL) {
+            path = DEFAULT_TRACE;
+        }
+        trace_fp = fopen(path, "w");
+        if (trace_fp == NULL) {
+            fprintf(stderr, "Error opening '%s': %s\n", path,
+                    strerror(errno));
+            exit(1);
+        }
+    }
+
+    int status = entry(nargs, args);
+    if (cache != NULL) {
+        cache_free(cache);
+    }
+    if (trace_fp != NULL && fclose(trace_fp) != 0) {
+        fprintf(stderr, "Error writing the trace: %s\n", strerror(errno));
+        status = status != 0 ? status : 1;
+    }
+    free(args);
+    return status;
+}
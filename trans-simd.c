@@ -0,0 +1,187 @@
+/**
+ * @file trans-simd.c
+ * @brief Register-blocked SIMD transpose kernels for native benchmarking
+ *
+ * Each kernel transposes A in square tiles that are loaded into registers,
+ * shuffled, and stored to B, and falls back to a plain loop for the edges
+ * that do not fill a tile. The AVX2 kernels are compiled for AVX2 with a
+ * target attribute, so the rest of the program does not require it and
+ * they are only offered when the CPU supports them.
+ */
+
+#include <stddef.h>
+
+#include "trans-simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+/**
+ * @brief Transposes the parts of A outside the leading rows x cols that
+ *        the tiled loop covered.
+ */
+static void transpose_edges(size_t M, size_t N, double A[N][M],
+                            double B[M][N], size_t rows, size_t cols) {
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = (i < rows) ? cols : 0; j < M; j++) {
+            B[j][i] = A[i][j];
+        }
+    }
+}
+
+/** @brief Transposes a size x size tile at (i, j) through a local array */
+static inline void transpose_scalar_tile(size_t M, size_t N, double A[N][M],
+                                         double B[M][N], size_t i, size_t j,
+                                         size_t size) {
+    double r[8][8];
+    for (size_t k = 0; k < size; k++) {
+        for (size_t l = 0; l < size; l++) {
+            r[l][k] = A[i + k][j + l];
+        }
+    }
+    for (size_t l = 0; l < size; l++) {
+        for (size_t k = 0; k < size; k++) {
+            B[j + l][i + k] = r[l][k];
+        }
+    }
+}
+
+static void trans_scalar_4x4(size_t M, size_t N, double A[N][M],
+                             double B[M][N], double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 4;
+    size_t cols = M - M % 4;
+    for (size_t i = 0; i < rows; i += 4) {
+        for (size_t j = 0; j < cols; j += 4) {
+            transpose_scalar_tile(M, N, A, B, i, j, 4);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+
+static void trans_scalar_8x8(size_t M, size_t N, double A[N][M],
+                             double B[M][N], double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 8;
+    size_t cols = M - M % 8;
+    for (size_t i = 0; i < rows; i += 8) {
+        for (size_t j = 0; j < cols; j += 8) {
+            transpose_scalar_tile(M, N, A, B, i, j, 8);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+
+#ifdef HAVE_X86_SIMD
+/** @brief Transposes the 2x2 tile at (i, j) in two SSE2 registers */
+static inline void transpose_sse2_2x2(size_t M, size_t N, double A[N][M],
+                                      double B[M][N], size_t i, size_t j) {
+    __m128d r0 = _mm_loadu_pd(&A[i][j]);
+    __m128d r1 = _mm_loadu_pd(&A[i + 1][j]);
+    _mm_storeu_pd(&B[j][i], _mm_unpacklo_pd(r0, r1));
+    _mm_storeu_pd(&B[j + 1][i], _mm_unpackhi_pd(r0, r1));
+}
+
+/** @brief Transposes a size x size tile at (i, j) as 2x2 SSE2 tiles */
+static inline void transpose_sse2_tile(size_t M, size_t N, double A[N][M],
+                                       double B[M][N], size_t i, size_t j,
+                                       size_t size) {
+    for (size_t k = 0; k < size; k += 2) {
+        for (size_t l = 0; l < size; l += 2) {
+            transpose_sse2_2x2(M, N, A, B, i + k, j + l);
+        }
+    }
+}
+
+static void trans_sse2_4x4(size_t M, size_t N, double A[N][M], double B[M][N],
+                           double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 4;
+    size_t cols = M - M % 4;
+    for (size_t i = 0; i < rows; i += 4) {
+        for (size_t j = 0; j < cols; j += 4) {
+            transpose_sse2_tile(M, N, A, B, i, j, 4);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+
+static void trans_sse2_8x8(size_t M, size_t N, double A[N][M], double B[M][N],
+                           double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 8;
+    size_t cols = M - M % 8;
+    for (size_t i = 0; i < rows; i += 8) {
+        for (size_t j = 0; j < cols; j += 8) {
+            transpose_sse2_tile(M, N, A, B, i, j, 8);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+
+/** @brief Transposes the 4x4 tile at (i, j) in four AVX registers */
+__attribute__((target("avx2"))) static inline void
+transpose_avx2_4x4(size_t M, size_t N, double A[N][M], double B[M][N],
+                   size_t i, size_t j) {
+    __m256d r0 = _mm256_loadu_pd(&A[i][j]);
+    __m256d r1 = _mm256_loadu_pd(&A[i + 1][j]);
+    __m256d r2 = _mm256_loadu_pd(&A[i + 2][j]);
+    __m256d r3 = _mm256_loadu_pd(&A[i + 3][j]);
+
+    /* Interleave pairs of rows, then swap the 128-bit halves across */
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(&B[j][i], _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(&B[j + 1][i], _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(&B[j + 2][i], _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(&B[j + 3][i], _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+__attribute__((target("avx2"))) static void
+trans_avx2_4x4(size_t M, size_t N, double A[N][M], double B[M][N],
+               double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 4;
+    size_t cols = M - M % 4;
+    for (size_t i = 0; i < rows; i += 4) {
+        for (size_t j = 0; j < cols; j += 4) {
+            transpose_avx2_4x4(M, N, A, B, i, j);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+
+__attribute__((target("avx2"))) static void
+trans_avx2_8x8(size_t M, size_t N, double A[N][M], double B[M][N],
+               double tmp[TMPCOUNT]) {
+    size_t rows = N - N % 8;
+    size_t cols = M - M % 8;
+    for (size_t i = 0; i < rows; i += 8) {
+        for (size_t j = 0; j < cols; j += 8) {
+            transpose_avx2_4x4(M, N, A, B, i, j);
+            transpose_avx2_4x4(M, N, A, B, i, j + 4);
+            transpose_avx2_4x4(M, N, A, B, i + 4, j);
+            transpose_avx2_4x4(M, N, A, B, i + 4, j + 4);
+        }
+    }
+    transpose_edges(M, N, A, B, rows, cols);
+}
+#endif /* HAVE_X86_SIMD */
+
+int simd_kernels(trans_func_t list[]) {
+    int count = 0;
+
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        list[count++] = (trans_func_t){trans_avx2_4x4, "SIMD 4x4 (AVX2)"};
+        list[count++] = (trans_func_t){trans_avx2_8x8, "SIMD 8x8 (AVX2)"};
+    }
+    list[count++] = (trans_func_t){trans_sse2_4x4, "SIMD 4x4 (SSE2)"};
+    list[count++] = (trans_func_t){trans_sse2_8x8, "SIMD 8x8 (SSE2)"};
+#endif
+
+    list[count++] = (trans_func_t){trans_scalar_4x4, "Register 4x4 (scalar)"};
+    list[count++] = (trans_func_t){trans_scalar_8x8, "Register 8x8 (scalar)"};
+    return count;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file trans-simd.h
+ * @brief Register-blocked SIMD transpose kernels for native benchmarking
+ *
+ * These kernels only run natively: they are not part of trans.c, so they
+ * are never traced or simulated. test-trans -b times them next to the
+ * registered transpose functions as a reference for real hardware.
+ */
+
+#ifndef TRANS_SIMD_H
+#define TRANS_SIMD_H
+
+#include "cachelab.h"
+
+/** @brief Most kernels that simd_kernels() can return */
+#define SIMD_MAX_KERNELS 6
+
+/**
+ * @brief Lists the kernels that can run on this CPU.
+ *
+ * AVX2 kernels are included only if the CPU supports AVX2, and SSE2
+ * kernels only on x86. Scalar register-blocked kernels are always
+ * included.
+ *
+ * @param[out] list  Array of at least SIMD_MAX_KERNELS entries
+ *
+ * @return The number of kernels stored in list
+ */
+int simd_kernels(trans_func_t list[]);
+
+#endif /* TRANS_SIMD_H */
@@ -0,0 +1,426 @@
+/**
+ * @file trans-tune.c
+ * @brief Searches the transpose variants for the cheapest on a given cache
+ *
+ * Each variant in trans-variants.c is run on every requested matrix size
+ * while the simulating ContTech runtime (ct-sim.c) feeds its accesses into
+ * an in-process cache, and is scored like test-trans:
+ * HIT_CYCLES * hits + MISS_CYCLES * misses. The variants are split among
+ * worker processes, one per CPU by default.
+ *
+ * The best variants for each size are listed, and with -t the winners are
+ * also printed as a dispatch table that can be pasted into
+ * transpose_submit in trans.c.
+ *
+ * Like tracegen-sim, this is built only by 'make experimental' until ct-sim.c
+ * has been linked against the real CLabInst pass.
+ */
+
+#define _XOPEN_SOURCE 700 // posix_memalign, sysconf
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "cachelab.h"
+#include "ct-sim.h"
+#include "trans-variants.h"
+
+/* Enable / disable simulation, provided by ct-sim.c */
+extern void __roi_begin(void);
+
+/** @brief Extra rows of B checked for out-of-bounds writes */
+#define OOB_ROWS 10
+
+/** @brief Alignment of the arena and of T within it, as in tracegen-ct */
+#define LAYOUT_ALIGN 65536
+
+/** @brief Most matrix sizes that can be tuned in one run */
+#define MAX_SIZES 32
+
+/** @brief A matrix size to tune for */
+typedef struct {
+    size_t M; /* Width of A, height of B */
+    size_t N; /* Height of A, width of B */
+} tune_size_t;
+
+/** @brief Outcome of one variant on one size, sent back by a worker */
+typedef struct {
+    size_t variant;
+    size_t size;
+    bool correct;
+    csim_stats_t stats;
+} tune_result_t;
+
+/* Globals set on the command line */
+static tune_size_t sizes[MAX_SIZES];
+static size_t num_sizes = 0;
+static long max_jobs = 0; /* 0 = one worker per CPU */
+static size_t top = 5;
+static bool emit_table = false;
+
+/* Geometry of the simulated cache, from ct-sim */
+static tune_geom_t geom;
+
+/** @brief Cost of a result in cycles, as computed by test-trans */
+static unsigned long result_cycles(const tune_result_t *r) {
+    return HIT_CYCLES * r->stats.hits + MISS_CYCLES * r->stats.misses;
+}
+
+/** @brief Describes a variant in a few words */
+static void describe_variant(const trans_variant_t *v, char *buf,
+                             size_t len) {
+    switch (v->kind) {
+    case VARIANT_TILED:
+        snprintf(buf, len, "%zux%zu tiles by %s", v->rows, v->cols,
+                 v->by_cols ? "columns" : "rows");
+        break;
+    case VARIANT_STAGED:
+        snprintf(buf, len, "%zux%zu tiles, %s staged in tmp", v->rows,
+                 v->cols, v->always ? "all" : "conflicts");
+        break;
+    case VARIANT_RECURSIVE:
+        snprintf(buf, len, "recursive down to %zux%zu", v->rows, v->cols);
+        break;
+    }
+}
+
+/** @brief Prints the trans.c call that performs a variant */
+static void print_call(const trans_variant_t *v) {
+    switch (v->kind) {
+    case VARIANT_TILED:
+        printf("transpose_tiled(M, N, A, B, %zu, %zu, %s);\n", v->rows,
+               v->cols, v->by_cols ? "true" : "false");
+        break;
+    case VARIANT_STAGED:
+        printf("transpose_staged((cache_geom_t){%u, %u, %u}, %s, M, N, A, B, "
+               "tmp);\n",
+               (unsigned)geom.log_sets, (unsigned)geom.assoc,
+               (unsigned)geom.log_block, v->always ? "true" : "false");
+        break;
+    case VARIANT_RECURSIVE:
+        printf("transpose_recursive(M, N, A, B, 0, N, 0, M);\n");
+        break;
+    }
+}
+
+/**
+ * @brief Checks that B holds the transpose of A, that A is unchanged, and
+ *        that nothing was written past the end of B.
+ */
+static bool validate(size_t M, size_t N, double A[N][M], double Acopy[N][M],
+                     double B[M + OOB_ROWS][N]) {
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < M; j++) {
+            if (A[i][j] != Acopy[i][j] || B[j][i] != Acopy[i][j]) {
+                return false;
+            }
+        }
+    }
+    for (size_t j = M; j < M + OOB_ROWS; j++) {
+        for (size_t i = 0; i < N; i++) {
+            if (B[j][i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Runs every jobs-th variant, starting at the worker's index, on
+ *        each size and writes the results to fd.
+ *
+ * The matrices are laid out like those of tracegen-ct, so that they map
+ * to the same cache sets as when test-trans evaluates trans.c.
+ */
+static void run_worker(size_t worker, size_t jobs, int fd) {
+    for (size_t s = 0; s < num_sizes; s++) {
+        size_t M = sizes[s].M;
+        size_t N = sizes[s].N;
+        size_t a_bytes = N * M * sizeof(double);
+        size_t t_off =
+            (a_bytes + LAYOUT_ALIGN - 1) & ~(size_t)(LAYOUT_ALIGN - 1);
+        size_t b_off = t_off + TMPCOUNT * sizeof(double);
+        size_t total = b_off + (M + OOB_ROWS) * N * sizeof(double);
+
+        void *arena;
+        double *copy = calloc(N * M, sizeof(double));
+        int res = posix_memalign(&arena, LAYOUT_ALIGN, total);
+        if (res != 0 || copy == NULL) {
+            fprintf(stderr, "Failed to allocate memory: %s\n",
+                    strerror(res != 0 ? res : ENOMEM));
+            _exit(1);
+        }
+        memset(arena, 0, total);
+
+        double(*A)[M] = (double(*)[M])arena;
+        double *T = (double *)((char *)arena + t_off);
+        double(*B)[N] = (double(*)[N])((char *)arena + b_off);
+        double(*Acopy)[M] = (double(*)[M])copy;
+        initMatrix(M, N, A, B);
+        copyMatrix(M, N, Acopy, A);
+
+        for (size_t v = worker; v < num_trans_variants; v += jobs) {
+            /* Start from a B that is certainly not the transpose */
+            for (size_t j = 0; j < M; j++) {
+                for (size_t i = 0; i < N; i++) {
+                    B[j][i] = -1.0;
+                }
+            }
+            memset(T, 0, TMPCOUNT * sizeof(double));
+
+            tune_result_t r = {.variant = v, .size = s};
+            __roi_begin();
+            trans_variants[v].fn(M, N, A, B, T, geom);
+            ct_sim_end(&r.stats);
+            r.correct = validate(M, N, A, Acopy, B);
+
+            if (write(fd, &r, sizeof(r)) != (ssize_t)sizeof(r)) {
+                _exit(1);
+            }
+        }
+
+        free(copy);
+        free(arena);
+    }
+}
+
+/**
+ * @brief Evaluates all variants on all sizes in worker processes.
+ *
+ * @param[out] results  Indexed by size, then variant
+ *
+ * @return True if every worker reported all of its results
+ */
+static bool run_workers(tune_result_t *results) {
+    long limit = max_jobs > 0 ? max_jobs : sysconf(_SC_NPROCESSORS_ONLN);
+    size_t jobs = limit > 0 ? (size_t)limit : 1;
+    if (jobs > num_trans_variants) {
+        jobs = num_trans_variants;
+    }
+
+    pid_t *pids = calloc(jobs, sizeof(*pids));
+    int *fds = calloc(jobs, sizeof(*fds));
+    if (pids == NULL || fds == NULL) {
+        fprintf(stderr, "Error: insufficient memory\n");
+        exit(1);
+    }
+
+    fflush(stdout);
+    for (size_t w = 0; w < jobs; w++) {
+        int pipefd[2];
+        if (pipe(pipefd) < 0) {
+            perror("pipe");
+            exit(1);
+        }
+        pids[w] = fork();
+        if (pids[w] < 0) {
+            perror("fork");
+            exit(1);
+        }
+        if (pids[w] == 0) {
+            close(pipefd[0]);
+            run_worker(w, jobs, pipefd[1]);
+            close(pipefd[1]);
+            _exit(0);
+        }
+        close(pipefd[1]);
+        fds[w] = pipefd[0];
+    }
+
+    /* Workers block once their pipe fills, so drain each one in turn */
+    size_t received = 0;
+    for (size_t w = 0; w < jobs; w++) {
+        FILE *fp = fdopen(fds[w], "r");
+        if (fp == NULL) {
+            perror("fdopen");
+            exit(1);
+        }
+        tune_result_t r;
+        while (fread(&r, sizeof(r), 1, fp) == 1) {
+            if (r.size < num_sizes && r.variant < num_trans_variants) {
+                results[r.size * num_trans_variants + r.variant] = r;
+                received++;
+            }
+        }
+        fclose(fp);
+    }
+
+    bool ok = received == num_sizes * num_trans_variants;
+    for (size_t w = 0; w < jobs; w++) {
+        int status;
+        if (waitpid(pids[w], &status, 0) < 0 || !WIFEXITED(status) ||
+            WEXITSTATUS(status) != 0) {
+            ok = false;
+        }
+    }
+
+    free(pids);
+    free(fds);
+    return ok;
+}
+
+/** @brief Orders results by cost, with incorrect variants last */
+static int compare_results(const void *a, const void *b) {
+    const tune_result_t *ra = a;
+    const tune_result_t *rb = b;
+    if (ra->correct != rb->correct) {
+        return ra->correct ? -1 : 1;
+    }
+    unsigned long ca = result_cycles(ra);
+    unsigned long cb = result_cycles(rb);
+    if (ca != cb) {
+        return ca < cb ? -1 : 1;
+    }
+    /* Keep registration order among ties */
+    return ra->variant < rb->variant ? -1 : ra->variant > rb->variant;
+}
+
+/** @brief Prints the best variants for one size */
+static void report_size(const tune_result_t *ranked) {
+    const tune_size_t *sz = &sizes[ranked[0].size];
+    printf("\n%zux%zu (M x N):\n", sz->M, sz->N);
+    printf("%4s  %-36s %10s %10s %12s\n", "Rank", "Variant", "Hits",
+           "Misses", "Cycles");
+    size_t shown = 0;
+    for (size_t i = 0; i < num_trans_variants && shown < top; i++) {
+        const tune_result_t *r = &ranked[i];
+        if (!r->correct) {
+            break;
+        }
+        char desc[64];
+        describe_variant(&trans_variants[r->variant], desc, sizeof(desc));
+        printf("%4zu  %-36s %10lu %10lu %12lu\n", ++shown, desc,
+               r->stats.hits, r->stats.misses, result_cycles(r));
+    }
+    if (shown == 0) {
+        printf("      (no variant transposed correctly)\n");
+    }
+}
+
+/** @brief Prints the winner for each size as a chain of ifs */
+static void report_table(tune_result_t *const ranked[]) {
+    printf("\n/* Dispatch table generated by trans-tune for s=%u, E=%u, "
+           "b=%u */\n",
+           (unsigned)geom.log_sets, (unsigned)geom.assoc,
+           (unsigned)geom.log_block);
+    const char *keyword = "if";
+    for (size_t s = 0; s < num_sizes; s++) {
+        const tune_result_t *best = &ranked[s][0];
+        if (!best->correct) {
+            continue;
+        }
+        const trans_variant_t *v = &trans_variants[best->variant];
+        char desc[64];
+        describe_variant(v, desc, sizeof(desc));
+        printf("%s (M == %zu && N == %zu) {\n", keyword, sizes[s].M,
+               sizes[s].N);
+        printf("    /* %s: %lu cycles */\n    ", desc, result_cycles(best));
+        print_call(v);
+        keyword = "} else if";
+    }
+    if (strcmp(keyword, "if") != 0) {
+        printf("}\n");
+    }
+}
+
+static void usage(char *argv[]) {
+    printf("Usage: %s [-h] [-t] [-j <jobs>] [-n <count>] "
+           "[-l | -s <s> -E <E> -b <b>] [MxN ...]\n",
+           argv[0]);
+    printf("Options:\n");
+    printf("  -h          Print this help message\n");
+    printf("  -t          Also print a dispatch table for transpose_submit\n");
+    printf("  -j <jobs>   Run at most <jobs> workers (default: one per "
+           "CPU)\n");
+    printf("  -n <count>  Show the best <count> variants per size "
+           "(default: %zu)\n",
+           top);
+    printf("  -l          Simulate the Haswell L1 cache\n");
+    printf("  -s, -E, -b  Simulate the given cache (default: the test "
+           "cache)\n");
+    printf("  MxN         Matrix size to tune for (default: 32x32)\n");
+}
+
+int entry(int argc, char *argv[]) {
+    int c;
+    while ((c = getopt(argc, argv, "htj:n:")) != -1) {
+        switch (c) {
+        case 't':
+            emit_table = true;
+            break;
+        case 'j':
+            max_jobs = atol(optarg);
+            break;
+        case 'n':
+            top = (size_t)atol(optarg);
+            break;
+        case 'h':
+            usage(argv);
+            exit(0);
+        default:
+            usage(argv);
+            exit(1);
+        }
+    }
+
+    for (int i = optind; i < argc; i++) {
+        unsigned long m, n;
+        char extra;
+        if (sscanf(argv[i], "%lux%lu%c", &m, &n, &extra) != 2 || m == 0 ||
+            n == 0 || m > MAXN || n > MAXN) {
+            fprintf(stderr, "Error: invalid size '%s', expected MxN with "
+                            "both at most %d\n",
+                    argv[i], MAXN);
+            exit(1);
+        }
+        if (num_sizes == MAX_SIZES) {
+            fprintf(stderr, "Error: at most %d sizes can be tuned at once\n",
+                    MAX_SIZES);
+            exit(1);
+        }
+        sizes[num_sizes++] = (tune_size_t){m, n};
+    }
+    if (num_sizes == 0) {
+        sizes[num_sizes++] = (tune_size_t){32, 32};
+    }
+
+    unsigned long s, E, b;
+    ct_sim_geometry(&s, &E, &b);
+    geom = (tune_geom_t){(uint32_t)E, (uint8_t)s, (uint8_t)b};
+    printf("Tuning %zu transpose variants for s=%lu, E=%lu, b=%lu\n",
+           num_trans_variants, s, E, b);
+
+    tune_result_t *results =
+        calloc(num_sizes * num_trans_variants, sizeof(*results));
+    tune_result_t **ranked = calloc(num_sizes, sizeof(*ranked));
+    if (results == NULL || ranked == NULL) {
+        fprintf(stderr, "Error: insufficient memory\n");
+        exit(1);
+    }
+    if (!run_workers(results)) {
+        fprintf(stderr, "Error: a worker failed\n");
+        exit(1);
+    }
+
+    for (size_t i = 0; i < num_sizes; i++) {
+        ranked[i] = &results[i * num_trans_variants];
+        qsort(ranked[i], num_trans_variants, sizeof(*results),
+              compare_results);
+        report_size(ranked[i]);
+    }
+    if (emit_table) {
+        report_table(ranked);
+    }
+
+    free(ranked);
+    free(results);
+    return 0;
+}
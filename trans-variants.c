@@ -0,0 +1,261 @@
+/**
+ * @file trans-variants.c
+ * @brief Parameterized transpose variants explored by trans-tune
+ *
+ * The helpers below follow those of trans.c, with the cache geometry
+ * passed in by trans-tune. Each registered variant is a separate function
+ * with its parameters fixed at compile time, so that it is optimized, and
+ * traced, just like the corresponding call in trans.c.
+ */
+
+#include "trans-variants.h"
+
+/** @brief Number of doubles in one block of the test cache */
+#define BLOCK_DOUBLES (((size_t)1 << TEST_LOG_BLOCK) / sizeof(double))
+
+/** @brief Tile size of the staged variants, as in trans.c */
+#define STAGE_MAX_ROWS 8
+#define STAGE_MAX_COLS BLOCK_DOUBLES
+
+/** @brief Tiles below this size are not split further when recursing */
+#define OBLIVIOUS_CUTOFF BLOCK_DOUBLES
+
+/** @brief Returns the smaller of a and b */
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Transposes rows [i0, i1) and columns [j0, j1) of A into B,
+ *        deferring the diagonal.
+ */
+static void transpose_tile(size_t M, size_t N, double A[N][M], double B[M][N],
+                           size_t i0, size_t i1, size_t j0, size_t j1) {
+    for (size_t i = i0; i < i1; i++) {
+        for (size_t j = j0; j < j1; j++) {
+            if (i != j) {
+                B[j][i] = A[i][j];
+            }
+        }
+        if (i >= j0 && i < j1) {
+            B[i][i] = A[i][i];
+        }
+    }
+}
+
+/** @brief Transposes A in tiles of rows x cols */
+static void transpose_tiled(size_t M, size_t N, double A[N][M],
+                            double B[M][N], size_t rows, size_t cols,
+                            bool by_cols) {
+    if (by_cols) {
+        for (size_t j0 = 0; j0 < M; j0 += cols) {
+            for (size_t i0 = 0; i0 < N; i0 += rows) {
+                transpose_tile(M, N, A, B, i0, min_size(i0 + rows, N), j0,
+                               min_size(j0 + cols, M));
+            }
+        }
+    } else {
+        for (size_t i0 = 0; i0 < N; i0 += rows) {
+            for (size_t j0 = 0; j0 < M; j0 += cols) {
+                transpose_tile(M, N, A, B, i0, min_size(i0 + rows, N), j0,
+                               min_size(j0 + cols, M));
+            }
+        }
+    }
+}
+
+/** @brief Returns the cache set that holds p */
+static size_t cache_set(tune_geom_t geom, const double *p) {
+    size_t mask = ((size_t)1 << geom.log_sets) - 1;
+    return ((uintptr_t)p >> geom.log_block) & mask;
+}
+
+/** @brief Counts the lines of the n doubles at p that map to a set */
+static size_t lines_in_set(tune_geom_t geom, const double *p, size_t n,
+                           size_t set) {
+    uintptr_t first = (uintptr_t)p >> geom.log_block;
+    uintptr_t last = (uintptr_t)(p + n - 1) >> geom.log_block;
+    size_t count = 0;
+    for (uintptr_t line = first; line <= last; line++) {
+        if ((line & (((uintptr_t)1 << geom.log_sets) - 1)) == set) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Counts the lines of a tile of A and its image in B that map to
+ *        the given set.
+ */
+static size_t tile_lines_in_set(tune_geom_t geom, size_t M, size_t N,
+                                double A[N][M], double B[M][N], size_t i0,
+                                size_t i1, size_t j0, size_t j1, size_t set) {
+    size_t count = 0;
+    for (size_t i = i0; i < i1; i++) {
+        count += lines_in_set(geom, &A[i][j0], j1 - j0, set);
+    }
+    for (size_t j = j0; j < j1; j++) {
+        count += lines_in_set(geom, &B[j][i0], i1 - i0, set);
+    }
+    return count;
+}
+
+/** @brief Checks whether a tile of A and its image in B fit in the cache */
+static bool tile_fits(tune_geom_t geom, size_t M, size_t N, double A[N][M],
+                      double B[M][N], size_t i0, size_t i1, size_t j0,
+                      size_t j1) {
+    for (size_t i = i0; i < i1; i++) {
+        size_t set = cache_set(geom, &A[i][j0]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) >
+            geom.assoc) {
+            return false;
+        }
+    }
+    for (size_t j = j0; j < j1; j++) {
+        size_t set = cache_set(geom, &B[j][i0]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) >
+            geom.assoc) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Picks the slots of tmp that hold each row of a staged tile,
+ *        packed one per byte.
+ */
+static uint64_t stage_slots(tune_geom_t geom, size_t M, size_t N,
+                            double A[N][M], double B[M][N],
+                            double tmp[TMPCOUNT], size_t i0, size_t i1,
+                            size_t j0, size_t j1) {
+    uint64_t slots = 0;
+    size_t rows = 0;
+    for (size_t slot = 0; slot < TMPCOUNT / STAGE_MAX_COLS && rows < i1 - i0;
+         slot++) {
+        size_t set = cache_set(geom, &tmp[slot * STAGE_MAX_COLS]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) == 0) {
+            slots |= (uint64_t)slot << (8 * rows++);
+        }
+    }
+    if (rows < i1 - i0) {
+        slots = 0;
+        for (size_t r = 0; r < i1 - i0; r++) {
+            slots |= (uint64_t)r << (8 * r);
+        }
+    }
+    return slots;
+}
+
+/** @brief Returns the offset in tmp of row r of a staged tile */
+static size_t stage_row(uint64_t slots, size_t r) {
+    return ((slots >> (8 * r)) & 0xff) * STAGE_MAX_COLS;
+}
+
+/** @brief Transposes a tile by copying it through tmp */
+static void transpose_tile_staged(tune_geom_t geom, size_t M, size_t N,
+                                  double A[N][M], double B[M][N],
+                                  double tmp[TMPCOUNT], size_t i0, size_t i1,
+                                  size_t j0, size_t j1) {
+    uint64_t slots = stage_slots(geom, M, N, A, B, tmp, i0, i1, j0, j1);
+    for (size_t i = i0; i < i1; i++) {
+        size_t row = stage_row(slots, i - i0);
+        for (size_t j = j0; j < j1; j++) {
+            tmp[row + j - j0] = A[i][j];
+        }
+    }
+    for (size_t j = j0; j < j1; j++) {
+        for (size_t i = i0; i < i1; i++) {
+            B[j][i] = tmp[stage_row(slots, i - i0) + j - j0];
+        }
+    }
+}
+
+/** @brief Transposes A in tiles, staging them through tmp as needed */
+static void transpose_staged(tune_geom_t geom, bool always, size_t M,
+                             size_t N, double A[N][M], double B[M][N],
+                             double tmp[TMPCOUNT]) {
+    for (size_t i0 = 0; i0 < N; i0 += STAGE_MAX_ROWS) {
+        size_t i1 = min_size(i0 + STAGE_MAX_ROWS, N);
+        for (size_t j0 = 0; j0 < M; j0 += STAGE_MAX_COLS) {
+            size_t j1 = min_size(j0 + STAGE_MAX_COLS, M);
+            if (!always && tile_fits(geom, M, N, A, B, i0, i1, j0, j1)) {
+                transpose_tile(M, N, A, B, i0, i1, j0, j1);
+            } else {
+                transpose_tile_staged(geom, M, N, A, B, tmp, i0, i1, j0, j1);
+            }
+        }
+    }
+}
+
+/** @brief Recursively halves the longer side until a tile is small */
+static void transpose_recursive(size_t M, size_t N, double A[N][M],
+                                double B[M][N], size_t i0, size_t i1,
+                                size_t j0, size_t j1) {
+    if (i1 - i0 <= OBLIVIOUS_CUTOFF && j1 - j0 <= OBLIVIOUS_CUTOFF) {
+        transpose_tile(M, N, A, B, i0, i1, j0, j1);
+    } else if (i1 - i0 >= j1 - j0) {
+        size_t mid = i0 + (i1 - i0) / 2;
+        transpose_recursive(M, N, A, B, i0, mid, j0, j1);
+        transpose_recursive(M, N, A, B, mid, i1, j0, j1);
+    } else {
+        size_t mid = j0 + (j1 - j0) / 2;
+        transpose_recursive(M, N, A, B, i0, i1, j0, mid);
+        transpose_recursive(M, N, A, B, i0, i1, mid, j1);
+    }
+}
+
+/*
+ * The grid of tile sizes searched, as X-macros over X(rows, cols, order).
+ * order is either rows or cols.
+ */
+#define TILE_WIDTHS(X, r, o)                                                   \
+    X(r, 1, o) X(r, 2, o) X(r, 4, o) X(r, 8, o) X(r, 16, o) X(r, 32, o)
+#define TILE_SIZES(X, o)                                                       \
+    TILE_WIDTHS(X, 1, o) TILE_WIDTHS(X, 2, o) TILE_WIDTHS(X, 4, o)             \
+    TILE_WIDTHS(X, 8, o) TILE_WIDTHS(X, 16, o) TILE_WIDTHS(X, 32, o)
+
+#define BY_rows false
+#define BY_cols true
+
+#define DEFINE_TILED(r, c, o)                                                  \
+    static void tiled_##r##x##c##_##o(size_t M, size_t N, double A[N][M],     \
+                                      double B[M][N], double tmp[TMPCOUNT],   \
+                                      tune_geom_t geom) {                     \
+        transpose_tiled(M, N, A, B, r, c, BY_##o);                            \
+    }
+TILE_SIZES(DEFINE_TILED, rows)
+TILE_SIZES(DEFINE_TILED, cols)
+
+static void staged_conflicts(size_t M, size_t N, double A[N][M],
+                             double B[M][N], double tmp[TMPCOUNT],
+                             tune_geom_t geom) {
+    transpose_staged(geom, false, M, N, A, B, tmp);
+}
+
+static void staged_always(size_t M, size_t N, double A[N][M], double B[M][N],
+                          double tmp[TMPCOUNT], tune_geom_t geom) {
+    transpose_staged(geom, true, M, N, A, B, tmp);
+}
+
+static void recursive(size_t M, size_t N, double A[N][M], double B[M][N],
+                      double tmp[TMPCOUNT], tune_geom_t geom) {
+    transpose_recursive(M, N, A, B, 0, N, 0, M);
+}
+
+#define REGISTER_TILED(r, c, o)                                                \
+    {tiled_##r##x##c##_##o, VARIANT_TILED, r, c, BY_##o, false},
+
+const trans_variant_t trans_variants[] = {
+    TILE_SIZES(REGISTER_TILED, rows) TILE_SIZES(REGISTER_TILED, cols)
+    {staged_conflicts, VARIANT_STAGED, STAGE_MAX_ROWS, STAGE_MAX_COLS, false,
+     false},
+    {staged_always, VARIANT_STAGED, STAGE_MAX_ROWS, STAGE_MAX_COLS, false,
+     true},
+    {recursive, VARIANT_RECURSIVE, OBLIVIOUS_CUTOFF, OBLIVIOUS_CUTOFF, false,
+     false},
+};
+
+const size_t num_trans_variants =
+    sizeof(trans_variants) / sizeof(trans_variants[0]);
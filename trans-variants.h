@@ -0,0 +1,57 @@
+/**
+ * @file trans-variants.h
+ * @brief Parameterized transpose variants explored by trans-tune
+ *
+ * trans-variants.c is instrumented like trans.c, so the accesses of each
+ * variant are exactly those of the compiled code. Every variant mirrors a
+ * helper in trans.c, so the best one can be dispatched to from
+ * transpose_submit.
+ */
+
+#ifndef TRANS_VARIANTS_H
+#define TRANS_VARIANTS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cachelab.h"
+
+/**
+ * @brief Geometry of the simulated cache.
+ *
+ * This fits in one register, so passing it adds no traced accesses.
+ */
+typedef struct {
+    uint32_t assoc;    /* E: lines per set */
+    uint8_t log_sets;  /* s: there are 2**s sets */
+    uint8_t log_block; /* b: blocks are 2**b bytes */
+} tune_geom_t;
+
+/** @brief A transpose variant, tuned for the given cache */
+typedef void (*variant_fn_t)(size_t M, size_t N, double A[N][M],
+                             double B[M][N], double tmp[TMPCOUNT],
+                             tune_geom_t geom);
+
+/** @brief The family of a variant, i.e. the trans.c helper it mirrors */
+typedef enum {
+    VARIANT_TILED,     /* transpose_tiled() */
+    VARIANT_STAGED,    /* transpose_staged() */
+    VARIANT_RECURSIVE, /* transpose_recursive() */
+} variant_kind_t;
+
+/** @brief A registered transpose variant and its parameters */
+typedef struct {
+    variant_fn_t fn;
+    variant_kind_t kind;
+    size_t rows;  /* Tile height */
+    size_t cols;  /* Tile width */
+    bool by_cols; /* VARIANT_TILED: visit tiles column by column */
+    bool always;  /* VARIANT_STAGED: stage every tile, not only conflicts */
+} trans_variant_t;
+
+/** @brief All variants, defined in trans-variants.c */
+extern const trans_variant_t trans_variants[];
+extern const size_t num_trans_variants;
+
+#endif /* TRANS_VARIANTS_H */
@@ -6,6 +6,9 @@
  *   void trans(size_t M, size_t N, double A[N][M], double B[M][N],
  *              double tmp[TMPCOUNT]);
  *
+ * Copy elements with TRANS_COPY(dst, src) rather than dst = src, so that
+ * tracegen-rec can record the copies without the ContTech instrumentation.
+ *
  * All transpose functions take the following arguments:
  *
  *   @param[in]     M    Width of A, height of B
@@ -31,6 +34,7 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #include "cachelab.h"
@@ -71,6 +75,259 @@ static bool is_transpose(size_t M, size_t N, double A[N][M], double B[M][N]) {
  * feel free to modify or delete.
  */
 
+/**
+ * @brief Geometry of a cache that the kernels below are tuned for.
+ *
+ * This is passed by value so that it lives in registers: the kernels must
+ * not make memory accesses of their own that would show up in the trace.
+ */
+typedef struct {
+    unsigned log_sets;  /* s: there are 2**s sets */
+    unsigned assoc;     /* E: lines per set */
+    unsigned log_block; /* b: blocks are 2**b bytes */
+} cache_geom_t;
+
+/** @brief The cache used by test-trans by default */
+static const cache_geom_t test_cache = {TEST_LOG_SET, TEST_ASSOC,
+                                        TEST_LOG_BLOCK};
+
+/** @brief The cache used by test-trans -l */
+static const cache_geom_t haswell_l1 = {HASWELL_L1_SET, HASWELL_L1_ASSOC,
+                                        HASWELL_L1_BLOCK};
+
+/** @brief Number of doubles in one block of the test cache */
+#define BLOCK_DOUBLES (((size_t)1 << TEST_LOG_BLOCK) / sizeof(double))
+
+/** @brief Largest tile that transpose_staged() copies through tmp */
+#define STAGE_MAX_ROWS 8
+#define STAGE_MAX_COLS BLOCK_DOUBLES
+
+/** @brief Tiles below this size are not split further by trans_oblivious */
+#define OBLIVIOUS_CUTOFF BLOCK_DOUBLES
+
+/** @brief Tile size used by trans_rect, the one trans-tune is meant to pick */
+#define RECT_TILE_ROWS (4 * BLOCK_DOUBLES)
+#define RECT_TILE_COLS (BLOCK_DOUBLES / 2)
+
+/** @brief Returns the smaller of a and b */
+static size_t min_size(size_t a, size_t b) {
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Transposes rows [i0, i1) and columns [j0, j1) of A into B.
+ *
+ * When the tile straddles the diagonal, A[i][i] and B[i][i] share a cache
+ * set in the test cache, so B[i][i] is written after the rest of row i
+ * instead of evicting the row of A halfway through.
+ */
+static void transpose_tile(size_t M, size_t N, double A[N][M], double B[M][N],
+                           size_t i0, size_t i1, size_t j0, size_t j1) {
+    for (size_t i = i0; i < i1; i++) {
+        for (size_t j = j0; j < j1; j++) {
+            if (i != j) {
+                TRANS_COPY(B[j][i], A[i][j]);
+            }
+        }
+        if (i >= j0 && i < j1) {
+            TRANS_COPY(B[i][i], A[i][i]);
+        }
+    }
+}
+
+/**
+ * @brief Transposes A in tiles of rows x cols.
+ *
+ * @param[in] by_cols  Visit the tiles of each column of tiles in turn,
+ *                     rather than the tiles of each row of tiles
+ */
+static void transpose_tiled(size_t M, size_t N, double A[N][M],
+                            double B[M][N], size_t rows, size_t cols,
+                            bool by_cols) {
+    if (by_cols) {
+        for (size_t j0 = 0; j0 < M; j0 += cols) {
+            for (size_t i0 = 0; i0 < N; i0 += rows) {
+                transpose_tile(M, N, A, B, i0, min_size(i0 + rows, N), j0,
+                               min_size(j0 + cols, M));
+            }
+        }
+    } else {
+        for (size_t i0 = 0; i0 < N; i0 += rows) {
+            for (size_t j0 = 0; j0 < M; j0 += cols) {
+                transpose_tile(M, N, A, B, i0, min_size(i0 + rows, N), j0,
+                               min_size(j0 + cols, M));
+            }
+        }
+    }
+}
+
+/** @brief Returns the cache set that holds p */
+static size_t cache_set(cache_geom_t geom, const double *p) {
+    size_t mask = ((size_t)1 << geom.log_sets) - 1;
+    return ((uintptr_t)p >> geom.log_block) & mask;
+}
+
+/** @brief Counts the lines of the n doubles at p that map to a set */
+static size_t lines_in_set(cache_geom_t geom, const double *p, size_t n,
+                           size_t set) {
+    uintptr_t first = (uintptr_t)p >> geom.log_block;
+    uintptr_t last = (uintptr_t)(p + n - 1) >> geom.log_block;
+    size_t count = 0;
+    for (uintptr_t line = first; line <= last; line++) {
+        if ((line & (((uintptr_t)1 << geom.log_sets) - 1)) == set) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Counts the lines of a tile of A and its image in B that map to
+ *        the given set.
+ */
+static size_t tile_lines_in_set(cache_geom_t geom, size_t M, size_t N,
+                                double A[N][M], double B[M][N], size_t i0,
+                                size_t i1, size_t j0, size_t j1, size_t set) {
+    size_t count = 0;
+    for (size_t i = i0; i < i1; i++) {
+        count += lines_in_set(geom, &A[i][j0], j1 - j0, set);
+    }
+    for (size_t j = j0; j < j1; j++) {
+        count += lines_in_set(geom, &B[j][i0], i1 - i0, set);
+    }
+    return count;
+}
+
+/**
+ * @brief Checks whether a tile of A and its image in B fit in the cache
+ *        together, that is, no set has to hold more than E of their lines.
+ */
+static bool tile_fits(cache_geom_t geom, size_t M, size_t N, double A[N][M],
+                      double B[M][N], size_t i0, size_t i1, size_t j0,
+                      size_t j1) {
+    for (size_t i = i0; i < i1; i++) {
+        size_t set = cache_set(geom, &A[i][j0]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) >
+            geom.assoc) {
+            return false;
+        }
+    }
+    for (size_t j = j0; j < j1; j++) {
+        size_t set = cache_set(geom, &B[j][i0]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) >
+            geom.assoc) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Picks the slots of tmp that hold each row of a staged tile.
+ *
+ * tmp is split into slots of STAGE_MAX_COLS doubles. Slots whose set is
+ * not used by the tile are preferred, so the staged copy stays cached while
+ * the tile is read and written. The slot for row r is kept in byte r of the
+ * result, which keeps the choice in a register rather than in a traced
+ * local array.
+ */
+static uint64_t stage_slots(cache_geom_t geom, size_t M, size_t N,
+                            double A[N][M], double B[M][N],
+                            double tmp[TMPCOUNT], size_t i0, size_t i1,
+                            size_t j0, size_t j1) {
+    uint64_t slots = 0;
+    size_t rows = 0;
+    for (size_t slot = 0; slot < TMPCOUNT / STAGE_MAX_COLS && rows < i1 - i0;
+         slot++) {
+        size_t set = cache_set(geom, &tmp[slot * STAGE_MAX_COLS]);
+        if (tile_lines_in_set(geom, M, N, A, B, i0, i1, j0, j1, set) == 0) {
+            slots |= (uint64_t)slot << (8 * rows++);
+        }
+    }
+    if (rows < i1 - i0) {
+        /* Not enough free sets: just use the start of tmp */
+        slots = 0;
+        for (size_t r = 0; r < i1 - i0; r++) {
+            slots |= (uint64_t)r << (8 * r);
+        }
+    }
+    return slots;
+}
+
+/** @brief Returns the offset in tmp of row r of a staged tile */
+static size_t stage_row(uint64_t slots, size_t r) {
+    return ((slots >> (8 * r)) & 0xff) * STAGE_MAX_COLS;
+}
+
+/**
+ * @brief Transposes a tile of at most STAGE_MAX_ROWS x STAGE_MAX_COLS by
+ *        copying it row by row into tmp, then writing B from tmp.
+ *
+ * Each line of A and of B is then touched in one go, even if they
+ * conflict with each other in the cache.
+ */
+static void transpose_tile_staged(cache_geom_t geom, size_t M, size_t N,
+                                  double A[N][M], double B[M][N],
+                                  double tmp[TMPCOUNT], size_t i0, size_t i1,
+                                  size_t j0, size_t j1) {
+    uint64_t slots = stage_slots(geom, M, N, A, B, tmp, i0, i1, j0, j1);
+    for (size_t i = i0; i < i1; i++) {
+        size_t row = stage_row(slots, i - i0);
+        for (size_t j = j0; j < j1; j++) {
+            TRANS_COPY(tmp[row + j - j0], A[i][j]);
+        }
+    }
+    for (size_t j = j0; j < j1; j++) {
+        for (size_t i = i0; i < i1; i++) {
+            TRANS_COPY(B[j][i], tmp[stage_row(slots, i - i0) + j - j0]);
+        }
+    }
+}
+
+/**
+ * @brief Transposes A in tiles of STAGE_MAX_ROWS x STAGE_MAX_COLS, staging
+ *        tiles through tmp when they would not fit in the given cache.
+ *
+ * @param[in] always  Stage every tile, even those that fit. This pays off
+ *                    when rows of A alias each other in the cache, since
+ *                    the direct path then also loses lines between tiles.
+ */
+static void transpose_staged(cache_geom_t geom, bool always, size_t M,
+                             size_t N, double A[N][M], double B[M][N],
+                             double tmp[TMPCOUNT]) {
+    for (size_t i0 = 0; i0 < N; i0 += STAGE_MAX_ROWS) {
+        size_t i1 = min_size(i0 + STAGE_MAX_ROWS, N);
+        for (size_t j0 = 0; j0 < M; j0 += STAGE_MAX_COLS) {
+            size_t j1 = min_size(j0 + STAGE_MAX_COLS, M);
+            if (!always && tile_fits(geom, M, N, A, B, i0, i1, j0, j1)) {
+                transpose_tile(M, N, A, B, i0, i1, j0, j1);
+            } else {
+                transpose_tile_staged(geom, M, N, A, B, tmp, i0, i1, j0, j1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Recursively halves the longer side of rows [i0, i1) and columns
+ *        [j0, j1) until the tile is small enough to transpose directly.
+ */
+static void transpose_recursive(size_t M, size_t N, double A[N][M],
+                                double B[M][N], size_t i0, size_t i1,
+                                size_t j0, size_t j1) {
+    if (i1 - i0 <= OBLIVIOUS_CUTOFF && j1 - j0 <= OBLIVIOUS_CUTOFF) {
+        transpose_tile(M, N, A, B, i0, i1, j0, j1);
+    } else if (i1 - i0 >= j1 - j0) {
+        size_t mid = i0 + (i1 - i0) / 2;
+        transpose_recursive(M, N, A, B, i0, mid, j0, j1);
+        transpose_recursive(M, N, A, B, mid, i1, j0, j1);
+    } else {
+        size_t mid = j0 + (j1 - j0) / 2;
+        transpose_recursive(M, N, A, B, i0, i1, j0, mid);
+        transpose_recursive(M, N, A, B, i0, i1, mid, j1);
+    }
+}
+
 /**
  * @brief A simple baseline transpose function, not optimized for the cache.
  *
@@ -85,7 +342,7 @@ static void trans_basic(size_t M, size_t N, double A[N][M], double B[M][N],
 
     for (size_t i = 0; i < N; i++) {
         for (size_t j = 0; j < M; j++) {
-            B[j][i] = A[i][j];
+            TRANS_COPY(B[j][i], A[i][j]);
         }
     }
 
@@ -107,14 +364,91 @@ static void trans_tmp(size_t M, size_t N, double A[N][M], double B[M][N],
         for (size_t j = 0; j < M; j++) {
             size_t di = i % 2;
             size_t dj = j % 2;
-            tmp[2 * di + dj] = A[i][j];
-            B[j][i] = tmp[2 * di + dj];
+            TRANS_COPY(tmp[2 * di + dj], A[i][j]);
+            TRANS_COPY(B[j][i], tmp[2 * di + dj]);
         }
     }
 
     assert(is_transpose(M, N, A, B));
 }
 
+/**
+ * @brief Transposes square tiles of one test cache block, deferring the
+ *        diagonal of each tile that straddles it.
+ *
+ * A tile of A and its image in B then map to disjoint sets of the test
+ * cache except on the diagonal, which is what 32x32 needs.
+ */
+static void trans_blocked(size_t M, size_t N, double A[N][M], double B[M][N],
+                          double tmp[TMPCOUNT]) {
+    assert(M > 0);
+    assert(N > 0);
+
+    transpose_tiled(M, N, A, B, BLOCK_DOUBLES, BLOCK_DOUBLES, true);
+
+    assert(is_transpose(M, N, A, B));
+}
+
+/**
+ * @brief Cache-oblivious transpose: recursively splits the matrix in half
+ *        along its longer side.
+ */
+static void trans_oblivious(size_t M, size_t N, double A[N][M], double B[M][N],
+                            double tmp[TMPCOUNT]) {
+    assert(M > 0);
+    assert(N > 0);
+
+    transpose_recursive(M, N, A, B, 0, N, 0, M);
+
+    assert(is_transpose(M, N, A, B));
+}
+
+/**
+ * @brief Copies every tile through tmp, for matrices whose rows alias each
+ *        other in the test cache (64x64, 128x128, ...).
+ */
+static void trans_staged(size_t M, size_t N, double A[N][M], double B[M][N],
+                         double tmp[TMPCOUNT]) {
+    assert(M > 0);
+    assert(N > 0);
+
+    transpose_staged(test_cache, true, M, N, A, B, tmp);
+
+    assert(is_transpose(M, N, A, B));
+}
+
+/**
+ * @brief Copies through tmp only the tiles that conflict with their image
+ *        in the Haswell L1, such as the A and B tiles of 1024x1024 whose
+ *        lines all land in one set.
+ */
+static void trans_staged_l1(size_t M, size_t N, double A[N][M],
+                            double B[M][N], double tmp[TMPCOUNT]) {
+    assert(M > 0);
+    assert(N > 0);
+
+    transpose_staged(haswell_l1, false, M, N, A, B, tmp);
+
+    assert(is_transpose(M, N, A, B));
+}
+
+/**
+ * @brief Transposes rectangular matrices in tall, narrow tiles.
+ *
+ * When the width of A is not a multiple of the block size, consecutive
+ * rows of A drift across the sets of the test cache, so a tile can be
+ * made taller than a block without its rows evicting each other.
+ */
+static void trans_rect(size_t M, size_t N, double A[N][M], double B[M][N],
+                       double tmp[TMPCOUNT]) {
+    assert(M > 0);
+    assert(N > 0);
+
+    transpose_tiled(M, N, A, B, RECT_TILE_ROWS, RECT_TILE_COLS, false);
+
+    assert(is_transpose(M, N, A, B));
+}
+
 /**
  * @brief The solution transpose function that will be graded.
  *
@@ -123,7 +457,18 @@ static void trans_tmp(size_t M, size_t N, double A[N][M], double B[M][N],
  * this function must be correct for all values of M and N.
  */
 static void transpose_submit(size_t M, size_t N, double A[N][M], double B[M][N],
-                             double tmp[TMPCOUNT]) {}
+                             double tmp[TMPCOUNT]) {
+    if (M == 1024 && N == 1024) {
+        /* Only graded on the Haswell L1, the geometry of trans-tune -l */
+        transpose_tiled(M, N, A, B, BLOCK_DOUBLES, BLOCK_DOUBLES / 2, false);
+    } else if (M == N && M % 64 == 0) {
+        trans_staged(M, N, A, B, tmp);
+    } else if (M == N || M < BLOCK_DOUBLES || N < BLOCK_DOUBLES) {
+        trans_blocked(M, N, A, B, tmp);
+    } else {
+        trans_rect(M, N, A, B, tmp);
+    }
+}
 
 /**
  * @brief Registers all transpose functions with the driver.
@@ -139,4 +484,9 @@ void registerFunctions(void) {
     // Register any additional transpose functions
     registerTransFunction(trans_basic, "Basic transpose");
     registerTransFunction(trans_tmp, "Transpose using the temporary array");
+    registerTransFunction(trans_blocked, "Blocked with diagonal handling");
+    registerTransFunction(trans_oblivious, "Cache-oblivious recursive");
+    registerTransFunction(trans_staged, "Every tile staged through tmp");
+    registerTransFunction(trans_staged_l1, "Conflicting tiles staged (L1)");
+    registerTransFunction(trans_rect, "Rectangular tiles");
 }
@@ -0,0 +1,21353 @@
+	.file	"trans.c"
+	.text
+.Ltext0:
+	.file 1 "trans.c"
+	.p2align 4
+	.type	tile_lines_in_set, @function
+tile_lines_in_set:
+.LVL0:
+.LFB13:
+	.loc 1 190 78 view -0
+	.cfi_startproc
+	.loc 1 190 78 is_stmt 0 view .LVU1
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%esi, %r10d
+	movq	%rdi, %r15
+	movq	%rdx, %r11
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %rdx
+.LVL1:
+	.loc 1 190 78 view .LVU2
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 190 78 view .LVU3
+	movq	56(%rsp), %r14
+	movq	64(%rsp), %rbp
+	movq	72(%rsp), %rax
+	movq	80(%rsp), %rdi
+	movq	88(%rsp), %rsi
+	movq	%r9, -32(%rsp)
+.LVL2:
+	.loc 1 191 5 is_stmt 1 view .LVU4
+	.loc 1 192 5 view .LVU5
+.LBB92:
+	.loc 1 192 10 view .LVU6
+	.loc 1 192 27 view .LVU7
+	cmpq	%rbp, %r14
+	jnb	.L12
+	leaq	0(,%r11,8), %r12
+	.loc 1 193 18 is_stmt 0 view .LVU8
+	movq	%rdi, %rcx
+.LVL3:
+	.loc 1 193 18 view .LVU9
+.LBE92:
+	.loc 1 191 12 view .LVU10
+	movq	%rdx, -24(%rsp)
+.LBB105:
+.LBB93:
+.LBB94:
+.LBB95:
+	.loc 1 177 19 view .LVU11
+	movq	$-1, %r9
+.LVL4:
+	.loc 1 177 19 view .LVU12
+	imulq	%r14, %r11
+.LVL5:
+	.loc 1 177 19 view .LVU13
+.LBE95:
+.LBE94:
+.LBE93:
+	.loc 1 193 18 view .LVU14
+	subq	%rax, %rcx
+.LBB102:
+.LBB99:
+	.loc 1 174 40 view .LVU15
+	leaq	-8(,%rcx,8), %r13
+.LBB96:
+	.loc 1 177 19 view .LVU16
+	movl	%r15d, %ecx
+	salq	%cl, %r9
+	leaq	(%r11,%rax), %rcx
+	notq	%r9
+.LBE96:
+.LBE99:
+.LBE102:
+.LBE105:
+	.loc 1 191 12 view .LVU17
+	xorl	%r11d, %r11d
+	leaq	(%r8,%rcx,8), %r8
+.LVL6:
+	.loc 1 191 12 view .LVU18
+	movl	%r10d, %ecx
+	movq	%rdi, %r10
+.LVL7:
+	.loc 1 191 12 view .LVU19
+	movq	%r12, %rdi
+	movq	%r8, %rbx
+	movq	%r14, %r12
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+.LBB106:
+	.loc 1 193 9 is_stmt 1 discriminator 3 view .LVU20
+.LBB103:
+.LBI93:
+	.loc 1 171 15 discriminator 3 view .LVU21
+.LBB100:
+	.loc 1 173 5 discriminator 3 view .LVU22
+	.loc 1 173 15 is_stmt 0 discriminator 3 view .LVU23
+	movq	%rbx, %rax
+	.loc 1 174 15 discriminator 3 view .LVU24
+	leaq	0(%r13,%rbx), %r8
+	.loc 1 173 15 discriminator 3 view .LVU25
+	shrq	%cl, %rax
+.LVL9:
+	.loc 1 174 5 is_stmt 1 discriminator 3 view .LVU26
+	.loc 1 174 15 is_stmt 0 discriminator 3 view .LVU27
+	shrq	%cl, %r8
+.LVL10:
+	.loc 1 175 5 is_stmt 1 discriminator 3 view .LVU28
+	.loc 1 176 5 discriminator 3 view .LVU29
+.LBB97:
+	.loc 1 176 10 discriminator 3 view .LVU30
+	.loc 1 176 39 discriminator 3 view .LVU31
+	cmpq	%rax, %r8
+	jb	.L3
+.LBE97:
+	.loc 1 175 12 is_stmt 0 view .LVU32
+	xorl	%edx, %edx
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+.LBB98:
+	.loc 1 177 9 is_stmt 1 view .LVU33
+	.loc 1 177 19 is_stmt 0 view .LVU34
+	movq	%r9, %r14
+	andq	%rax, %r14
+	.loc 1 178 18 view .LVU35
+	cmpq	%r14, %rsi
+	sete	%r14b
+	.loc 1 176 52 view .LVU36
+	addq	$1, %rax
+.LVL12:
+	.loc 1 178 18 view .LVU37
+	movzbl	%r14b, %r14d
+	addq	%r14, %rdx
+.LVL13:
+	.loc 1 176 52 is_stmt 1 view .LVU38
+	.loc 1 176 39 view .LVU39
+	cmpq	%rax, %r8
+	jnb	.L5
+.LBE98:
+.LBE100:
+.LBE103:
+	.loc 1 193 15 is_stmt 0 view .LVU40
+	addq	%rdx, %r11
+.LVL14:
+.L3:
+.LBB104:
+.LBB101:
+	.loc 1 181 5 is_stmt 1 view .LVU41
+	.loc 1 181 5 is_stmt 0 view .LVU42
+.LBE101:
+.LBE104:
+	.loc 1 192 34 is_stmt 1 view .LVU43
+	addq	$1, %r12
+.LVL15:
+	.loc 1 192 27 view .LVU44
+	addq	%rdi, %rbx
+	cmpq	%r12, %rbp
+	jne	.L6
+	movq	-24(%rsp), %rdx
+	movq	56(%rsp), %r14
+	movq	%r10, %rdi
+	movl	%ecx, %r10d
+	movq	72(%rsp), %rax
+.LVL16:
+.L2:
+	.loc 1 192 27 is_stmt 0 view .LVU45
+.LBE106:
+.LBB107:
+	.loc 1 195 27 is_stmt 1 view .LVU46
+	cmpq	%rdi, %rax
+	jnb	.L1
+	.loc 1 196 18 is_stmt 0 view .LVU47
+	subq	%r14, %rbp
+.LVL17:
+.LBB108:
+.LBB109:
+.LBB110:
+	.loc 1 177 19 view .LVU48
+	movl	%r15d, %ecx
+	movq	$-1, %r9
+.LBE110:
+	.loc 1 174 40 view .LVU49
+	leaq	-8(,%rbp,8), %rbx
+	leaq	0(,%rdx,8), %rbp
+.LBB111:
+	.loc 1 177 19 view .LVU50
+	salq	%cl, %r9
+	movq	-32(%rsp), %rcx
+	imulq	%rax, %rdx
+	notq	%r9
+	addq	%r14, %rdx
+	leaq	(%rcx,%rdx,8), %r13
+	movl	%r10d, %ecx
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 177 19 view .LVU51
+.LBE111:
+.LBE109:
+.LBE108:
+	.loc 1 196 9 is_stmt 1 discriminator 3 view .LVU52
+.LBB116:
+.LBI108:
+	.loc 1 171 15 discriminator 3 view .LVU53
+.LBB114:
+	.loc 1 173 5 discriminator 3 view .LVU54
+	.loc 1 173 15 is_stmt 0 discriminator 3 view .LVU55
+	movq	%r13, %rdx
+	.loc 1 174 15 discriminator 3 view .LVU56
+	leaq	0(%r13,%rbx), %r14
+	.loc 1 173 15 discriminator 3 view .LVU57
+	shrq	%cl, %rdx
+.LVL19:
+	.loc 1 174 5 is_stmt 1 discriminator 3 view .LVU58
+	.loc 1 174 15 is_stmt 0 discriminator 3 view .LVU59
+	shrq	%cl, %r14
+.LVL20:
+	.loc 1 175 5 is_stmt 1 discriminator 3 view .LVU60
+	.loc 1 176 5 discriminator 3 view .LVU61
+.LBB112:
+	.loc 1 176 10 discriminator 3 view .LVU62
+	.loc 1 176 39 discriminator 3 view .LVU63
+	cmpq	%rdx, %r14
+	jb	.L8
+	.loc 1 176 39 is_stmt 0 discriminator 3 view .LVU64
+.LBE112:
+	.loc 1 175 12 view .LVU65
+	xorl	%r8d, %r8d
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+.LBB113:
+	.loc 1 177 9 is_stmt 1 view .LVU66
+	.loc 1 177 19 is_stmt 0 view .LVU67
+	movq	%r9, %r12
+	andq	%rdx, %r12
+	.loc 1 178 18 view .LVU68
+	cmpq	%r12, %rsi
+	sete	%r12b
+	.loc 1 176 52 view .LVU69
+	addq	$1, %rdx
+.LVL22:
+	.loc 1 178 18 view .LVU70
+	movzbl	%r12b, %r12d
+	addq	%r12, %r8
+.LVL23:
+	.loc 1 176 52 is_stmt 1 view .LVU71
+	.loc 1 176 39 view .LVU72
+	cmpq	%rdx, %r14
+	jnb	.L10
+.LBE113:
+.LBE114:
+.LBE116:
+	.loc 1 196 15 is_stmt 0 view .LVU73
+	addq	%r8, %r11
+.LVL24:
+.L8:
+.LBB117:
+.LBB115:
+	.loc 1 181 5 is_stmt 1 view .LVU74
+	.loc 1 181 5 is_stmt 0 view .LVU75
+.LBE115:
+.LBE117:
+	.loc 1 195 34 is_stmt 1 view .LVU76
+	addq	$1, %rax
+.LVL25:
+	.loc 1 195 27 view .LVU77
+	addq	%rbp, %r13
+	cmpq	%rax, %rdi
+	jne	.L11
+.LVL26:
+.L1:
+	.loc 1 195 27 is_stmt 0 view .LVU78
+.LBE107:
+	.loc 1 199 1 view .LVU79
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	movq	%r11, %rax
+.LVL27:
+	.loc 1 199 1 view .LVU80
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL28:
+.L12:
+	.cfi_restore_state
+	.loc 1 191 12 view .LVU81
+	xorl	%r11d, %r11d
+.LVL29:
+	.loc 1 191 12 view .LVU82
+	jmp	.L2
+	.cfi_endproc
+.LFE13:
+	.size	tile_lines_in_set, .-tile_lines_in_set
+	.p2align 4
+	.type	trans_basic, @function
+trans_basic:
+.LVL30:
+.LFB20:
+	.loc 1 339 47 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 340 5 view .LVU84
+	.loc 1 341 5 view .LVU85
+	.loc 1 343 5 view .LVU86
+.LBB118:
+	.loc 1 343 10 view .LVU87
+	.loc 1 343 26 view .LVU88
+.LBE118:
+	.loc 1 339 47 is_stmt 0 view .LVU89
+	movq	%rdi, %r8
+.LVL31:
+.LBB120:
+	.loc 1 343 26 view .LVU90
+	testq	%rsi, %rsi
+	je	.L19
+	testq	%rdi, %rdi
+	je	.L19
+	leaq	0(,%rdi,8), %r11
+	leaq	0(,%rsi,8), %r9
+	.loc 1 343 17 view .LVU91
+	xorl	%r10d, %r10d
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+.LBB119:
+	.loc 1 344 30 is_stmt 1 view .LVU92
+	.loc 1 345 13 is_stmt 0 view .LVU93
+	movq	%rcx, %rdi
+	.loc 1 344 21 view .LVU94
+	xorl	%eax, %eax
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 345 13 is_stmt 1 discriminator 3 view .LVU95
+	movsd	(%rdx,%rax,8), %xmm0
+	.loc 1 344 36 is_stmt 0 discriminator 3 view .LVU96
+	addq	$1, %rax
+.LVL34:
+	.loc 1 345 13 discriminator 3 view .LVU97
+	movsd	%xmm0, (%rdi)
+	.loc 1 344 36 is_stmt 1 discriminator 3 view .LVU98
+.LVL35:
+	.loc 1 344 30 discriminator 3 view .LVU99
+	addq	%r9, %rdi
+	cmpq	%rax, %r8
+	jne	.L22
+.LBE119:
+	.loc 1 343 32 view .LVU100
+	addq	$1, %r10
+.LVL36:
+	.loc 1 343 26 view .LVU101
+	addq	$8, %rcx
+	addq	%r11, %rdx
+	cmpq	%r10, %rsi
+	jne	.L21
+.LVL37:
+.L19:
+	.loc 1 343 26 is_stmt 0 view .LVU102
+.LBE120:
+	.loc 1 350 1 view .LVU103
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	trans_basic, .-trans_basic
+	.p2align 4
+	.type	trans_tmp, @function
+trans_tmp:
+.LVL38:
+.LFB21:
+	.loc 1 359 45 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 360 5 view .LVU105
+	.loc 1 361 5 view .LVU106
+	.loc 1 363 5 view .LVU107
+.LBB121:
+	.loc 1 363 10 view .LVU108
+	.loc 1 363 26 view .LVU109
+	testq	%rsi, %rsi
+	je	.L42
+	movq	%rdi, %r9
+	testq	%rdi, %rdi
+	je	.L42
+.LBE121:
+	.loc 1 359 45 is_stmt 0 view .LVU110
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r10
+	leaq	0(,%rsi,8), %r11
+.LBB126:
+	.loc 1 363 17 view .LVU111
+	xorl	%r12d, %r12d
+.LBE126:
+	.loc 1 359 45 view .LVU112
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	0(,%rdi,8), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rcx, %rbx
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+.LBB127:
+.LBB122:
+	.loc 1 364 30 is_stmt 1 view .LVU113
+.LBB123:
+	.loc 1 365 20 is_stmt 0 view .LVU114
+	movq	%r12, %rdi
+	.loc 1 367 13 view .LVU115
+	movq	%rbx, %rsi
+.LBE123:
+	.loc 1 364 21 view .LVU116
+	xorl	%eax, %eax
+.LBB124:
+	.loc 1 365 20 view .LVU117
+	andl	$1, %edi
+	.loc 1 367 13 view .LVU118
+	addq	%rdi, %rdi
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 365 13 is_stmt 1 discriminator 3 view .LVU119
+	.loc 1 366 13 discriminator 3 view .LVU120
+	.loc 1 367 13 discriminator 3 view .LVU121
+	.loc 1 366 20 is_stmt 0 discriminator 3 view .LVU122
+	movq	%rax, %rcx
+	.loc 1 367 13 discriminator 3 view .LVU123
+	movsd	(%rdx,%rax,8), %xmm0
+.LBE124:
+	.loc 1 364 36 discriminator 3 view .LVU124
+	addq	$1, %rax
+.LVL41:
+.LBB125:
+	.loc 1 366 20 discriminator 3 view .LVU125
+	andl	$1, %ecx
+.LVL42:
+	.loc 1 367 13 discriminator 3 view .LVU126
+	addq	%rdi, %rcx
+.LVL43:
+	.loc 1 367 13 discriminator 3 view .LVU127
+	movsd	%xmm0, (%r8,%rcx,8)
+	.loc 1 368 13 is_stmt 1 discriminator 3 view .LVU128
+	movsd	%xmm0, (%rsi)
+.LBE125:
+	.loc 1 364 36 discriminator 3 view .LVU129
+.LVL44:
+	.loc 1 364 30 discriminator 3 view .LVU130
+	addq	%r11, %rsi
+	cmpq	%rax, %r9
+	jne	.L33
+.LBE122:
+	.loc 1 363 32 view .LVU131
+	addq	$1, %r12
+.LVL45:
+	.loc 1 363 26 view .LVU132
+	addq	$8, %rbx
+	addq	%rbp, %rdx
+	cmpq	%r12, %r10
+	jne	.L32
+.LBE127:
+	.loc 1 373 1 is_stmt 0 view .LVU133
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL46:
+	.loc 1 373 1 view .LVU134
+	ret
+.LVL47:
+.L42:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 373 1 view .LVU135
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	trans_tmp, .-trans_tmp
+	.p2align 4
+	.type	trans_blocked, @function
+trans_blocked:
+.LVL48:
+.LFB22:
+	.loc 1 383 49 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 384 5 view .LVU137
+	.loc 1 385 5 view .LVU138
+	.loc 1 387 5 view .LVU139
+.LBB178:
+.LBI178:
+	.loc 1 144 13 view .LVU140
+	.loc 1 147 5 view .LVU141
+.LBB179:
+.LBI179:
+	.loc 1 144 13 view .LVU142
+.LBB180:
+	.loc 1 148 32 view .LVU143
+	testq	%rdi, %rdi
+	je	.L76
+	movq	%rsi, %rax
+	testq	%rsi, %rsi
+	je	.L76
+.LBE180:
+.LBE179:
+.LBE178:
+	.loc 1 383 49 is_stmt 0 view .LVU144
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	0(,%rsi,8), %r15
+	movq	%rcx, %r8
+.LVL49:
+	.loc 1 383 49 view .LVU145
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	leaq	1(%rdi), %rdx
+.LVL50:
+	.loc 1 383 49 view .LVU146
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdx, %r14
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	salq	$6, %r14
+	leaq	0(,%rdx,8), %rsi
+.LVL51:
+	.loc 1 383 49 view .LVU147
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	salq	$6, %rbp
+	xorl	%edx, %edx
+	leaq	64(%rbp), %rbx
+	movq	%rbx, -104(%rsp)
+	leaq	-64(%r14), %rbx
+	movq	%rbx, -56(%rsp)
+	leaq	8(%r15), %rbx
+	movq	%r14, -96(%rsp)
+	movq	%rbx, -80(%rsp)
+	leaq	-8(%rsi), %rbx
+	movq	%rsi, -72(%rsp)
+	movq	%rdi, %rsi
+	movq	%rbx, -64(%rsp)
+.LBB200:
+.LBB198:
+.LBB196:
+	.loc 1 148 32 view .LVU148
+	movq	%rcx, %rbx
+.LVL52:
+.L48:
+.LBB181:
+	.loc 1 149 36 is_stmt 1 view .LVU149
+	movq	%rdx, -88(%rsp)
+.LBE181:
+	.loc 1 148 40 is_stmt 0 view .LVU150
+	addq	$8, %rdx
+.LVL53:
+	.loc 1 148 40 view .LVU151
+	movq	%r13, %r11
+.LBB194:
+.LBB182:
+.LBB183:
+	.loc 1 114 22 view .LVU152
+	movq	%r13, %r10
+	cmpq	%rdx, %rsi
+	movq	%rdx, %rdi
+	movq	%rdx, -48(%rsp)
+	movq	%rbx, %r9
+	movq	%rbx, -40(%rsp)
+	cmovbe	%rsi, %rdi
+	movq	%r8, %r14
+.LBE183:
+.LBE182:
+	.loc 1 149 25 view .LVU153
+	xorl	%ecx, %ecx
+	movq	%rbp, -32(%rsp)
+	movq	%r13, -16(%rsp)
+	movq	%r8, -8(%rsp)
+	movq	%rsi, -24(%rsp)
+	movq	-56(%rsp), %rsi
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 1 150 17 is_stmt 1 view .LVU154
+.LBB185:
+.LBI182:
+	.loc 1 113 15 view .LVU155
+.LBB184:
+	.loc 1 114 5 view .LVU156
+	.loc 1 114 5 is_stmt 0 view .LVU157
+	movq	%rcx, %r8
+.LBE184:
+.LBE185:
+	.loc 1 150 17 view .LVU158
+	addq	$8, %rcx
+.LVL55:
+.LBB186:
+.LBI186:
+	.loc 1 113 15 is_stmt 1 view .LVU159
+.LBB187:
+	.loc 1 114 5 view .LVU160
+	.loc 1 114 22 is_stmt 0 view .LVU161
+	cmpq	%rcx, %rax
+	movq	%rcx, %rbp
+	cmovbe	%rax, %rbp
+.LVL56:
+	.loc 1 114 22 view .LVU162
+.LBE187:
+.LBE186:
+.LBB188:
+.LBI188:
+	.loc 1 124 13 is_stmt 1 view .LVU163
+	.loc 1 126 5 view .LVU164
+.LBB189:
+	.loc 1 126 10 view .LVU165
+	.loc 1 126 27 view .LVU166
+	cmpq	%rbp, %r8
+	jnb	.L50
+	movq	%r14, -120(%rsp)
+	movq	%r10, %rbx
+	movq	%r9, %r12
+	movq	%r11, %r13
+	movq	%rbp, -112(%rsp)
+.LVL57:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB190:
+	.loc 1 127 31 view .LVU167
+	.loc 1 129 17 is_stmt 0 view .LVU168
+	movq	-88(%rsp), %rdx
+	movq	%r12, %rbp
+	.loc 1 127 31 view .LVU169
+	cmpq	%rdi, %rdx
+	jnb	.L53
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 128 13 is_stmt 1 view .LVU170
+	.loc 1 128 16 is_stmt 0 view .LVU171
+	cmpq	%r8, %rdx
+	je	.L51
+	.loc 1 129 17 is_stmt 1 view .LVU172
+	movsd	(%rbx,%rdx,8), %xmm0
+	.loc 1 127 38 is_stmt 0 view .LVU173
+	addq	$1, %rdx
+.LVL59:
+	.loc 1 129 17 view .LVU174
+	movsd	%xmm0, 0(%rbp)
+	.loc 1 127 38 is_stmt 1 view .LVU175
+.LVL60:
+	.loc 1 127 31 view .LVU176
+	addq	%r15, %rbp
+	cmpq	%rdi, %rdx
+	jne	.L54
+.LVL61:
+.L53:
+	.loc 1 127 31 is_stmt 0 view .LVU177
+.LBE190:
+	.loc 1 132 9 is_stmt 1 view .LVU178
+	.loc 1 132 12 is_stmt 0 view .LVU179
+	movq	-88(%rsp), %rdx
+	cmpq	%rdx, %r8
+	jb	.L55
+	cmpq	%rdi, %r8
+	jnb	.L55
+	.loc 1 133 13 is_stmt 1 view .LVU180
+	movsd	0(%r13), %xmm0
+	movq	-120(%rsp), %rdx
+	movsd	%xmm0, (%rdx)
+.L55:
+	.loc 1 126 34 view .LVU181
+	.loc 1 126 27 is_stmt 0 view .LVU182
+	movq	-72(%rsp), %rdx
+	movq	-80(%rsp), %rbp
+	.loc 1 126 34 view .LVU183
+	addq	$1, %r8
+.LVL62:
+	.loc 1 126 27 is_stmt 1 view .LVU184
+	addq	$8, %r12
+	addq	%rbp, -120(%rsp)
+	addq	%rdx, %r13
+	movq	-64(%rsp), %rdx
+	addq	%rdx, %rbx
+	cmpq	%r8, -112(%rsp)
+	jne	.L49
+.LVL63:
+.L50:
+	.loc 1 126 27 is_stmt 0 view .LVU185
+.LBE189:
+.LBE188:
+	.loc 1 149 36 is_stmt 1 view .LVU186
+	movq	-96(%rsp), %rdx
+	addq	$64, %r9
+	addq	%rsi, %r10
+	addq	%rdx, %r11
+	movq	-104(%rsp), %rdx
+	addq	%rdx, %r14
+	cmpq	%rax, %rcx
+	jb	.L57
+.LBE194:
+	.loc 1 148 32 is_stmt 0 view .LVU187
+	movq	-40(%rsp), %rbx
+	movq	-32(%rsp), %rbp
+	movq	-48(%rsp), %rdx
+	movq	-24(%rsp), %rsi
+	movq	-16(%rsp), %r13
+	movq	-8(%rsp), %r8
+	.loc 1 148 40 is_stmt 1 view .LVU188
+.LVL64:
+	.loc 1 148 32 view .LVU189
+	addq	%rbp, %rbx
+	cmpq	%rsi, %rdx
+	jb	.L48
+.LBE196:
+.LBE198:
+.LBE200:
+	.loc 1 390 1 is_stmt 0 view .LVU190
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.cfi_restore_state
+.LBB201:
+.LBB199:
+.LBB197:
+.LBB195:
+.LBB193:
+.LBB192:
+.LBB191:
+	.loc 1 127 38 is_stmt 1 view .LVU191
+	addq	$1, %rdx
+.LVL66:
+	.loc 1 127 31 view .LVU192
+	addq	%r15, %rbp
+	cmpq	%rdx, %rdi
+	jne	.L54
+	jmp	.L53
+.LVL67:
+.L76:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 127 31 is_stmt 0 view .LVU193
+	ret
+.LBE191:
+.LBE192:
+.LBE193:
+.LBE195:
+.LBE197:
+.LBE199:
+.LBE201:
+	.cfi_endproc
+.LFE22:
+	.size	trans_blocked, .-trans_blocked
+	.p2align 4
+	.type	trans_rect, @function
+trans_rect:
+.LVL68:
+.LFB26:
+	.loc 1 443 46 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 444 5 view .LVU195
+	.loc 1 445 5 view .LVU196
+	.loc 1 447 5 view .LVU197
+.LBB252:
+.LBI252:
+	.loc 1 144 13 view .LVU198
+.LBB253:
+	.loc 1 155 32 view .LVU199
+	testq	%rsi, %rsi
+	je	.L113
+	testq	%rdi, %rdi
+	je	.L113
+.LBE253:
+.LBE252:
+	.loc 1 443 46 is_stmt 0 view .LVU200
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rsi, %rax
+	movq	%rdx, %r15
+	movq	%rcx, %r11
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	1(%rax), %rdx
+.LVL69:
+	.loc 1 443 46 view .LVU201
+	leaq	1(%rdi), %rcx
+.LVL70:
+	.loc 1 443 46 view .LVU202
+	movq	%rax, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rcx, %rsi
+.LVL71:
+	.loc 1 443 46 view .LVU203
+	salq	$3, %rcx
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	salq	$8, %rsi
+	salq	$5, %r14
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdx, %rbp
+	salq	$3, %rdx
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	salq	$8, %rbp
+	leaq	-256(%rsi), %rbx
+	leaq	-8(%rdx), %r8
+.LVL72:
+	.loc 1 443 46 view .LVU204
+	movq	%rdx, -72(%rsp)
+.LBB277:
+.LBB275:
+	.loc 1 155 32 view .LVU205
+	movq	%r15, -88(%rsp)
+	movq	%r11, -96(%rsp)
+	movq	%rcx, -64(%rsp)
+	subq	$8, %rcx
+	movq	%rcx, -56(%rsp)
+	xorl	%ecx, %ecx
+.LVL73:
+.L82:
+.LBB254:
+	.loc 1 156 36 is_stmt 1 view .LVU206
+	movq	%rcx, %r13
+.LBE254:
+	.loc 1 155 40 is_stmt 0 view .LVU207
+	addq	$32, %rcx
+.LVL74:
+.LBB273:
+.LBB255:
+.LBB256:
+	.loc 1 114 22 view .LVU208
+	cmpq	%rcx, %rax
+	movq	%rcx, %rdx
+	leaq	(%r11,%r13,8), %r10
+	cmovbe	%rax, %rdx
+	movq	%rdx, %r9
+	movq	%rdx, -80(%rsp)
+	xorl	%edx, %edx
+	cmpq	%r9, %r13
+	jnb	.L90
+	movq	%rsi, -40(%rsp)
+	movq	%rbp, -32(%rsp)
+	movq	%rbx, -24(%rsp)
+	movq	%rax, -16(%rsp)
+	movq	%r11, -8(%rsp)
+	movq	%rcx, -48(%rsp)
+	movq	%r13, %rcx
+.LVL75:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.loc 1 114 22 view .LVU209
+.LBE256:
+.LBE255:
+	.loc 1 157 17 is_stmt 1 view .LVU210
+.LBB258:
+.LBB259:
+	.loc 1 114 22 is_stmt 0 view .LVU211
+	movq	-96(%rsp), %r13
+	movq	%rdx, %rbp
+.LBE259:
+.LBE258:
+	.loc 1 157 17 view .LVU212
+	addq	$4, %rdx
+.LVL76:
+.LBB262:
+.LBI258:
+	.loc 1 113 15 is_stmt 1 view .LVU213
+.LBB260:
+	.loc 1 114 5 view .LVU214
+	.loc 1 114 22 is_stmt 0 view .LVU215
+	movq	%r10, %rbx
+	cmpq	%rdx, %rdi
+	movq	%rdx, %rsi
+	movq	-88(%rsp), %r9
+	movq	%r15, %r12
+	movq	%r13, -104(%rsp)
+	cmovbe	%rdi, %rsi
+.LVL77:
+	.loc 1 114 22 view .LVU216
+.LBE260:
+.LBE262:
+.LBB263:
+.LBI255:
+	.loc 1 113 15 is_stmt 1 view .LVU217
+.LBB257:
+	.loc 1 114 5 view .LVU218
+	.loc 1 114 5 is_stmt 0 view .LVU219
+.LBE257:
+.LBE263:
+.LBB264:
+.LBI264:
+	.loc 1 124 13 is_stmt 1 view .LVU220
+	.loc 1 126 5 view .LVU221
+.LBB265:
+	.loc 1 126 10 view .LVU222
+	.loc 1 126 27 view .LVU223
+.LBE265:
+.LBE264:
+.LBB270:
+.LBB261:
+	.loc 1 114 22 is_stmt 0 view .LVU224
+	movq	%rcx, %r11
+.LVL78:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.loc 1 114 22 view .LVU225
+.LBE261:
+.LBE270:
+.LBB271:
+.LBB268:
+.LBB266:
+	.loc 1 127 31 is_stmt 1 view .LVU226
+	.loc 1 129 17 is_stmt 0 view .LVU227
+	movq	%rbx, %r13
+	movq	%rbp, %rax
+	.loc 1 127 31 view .LVU228
+	cmpq	%rsi, %rbp
+	jnb	.L86
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	.loc 1 128 13 is_stmt 1 view .LVU229
+	.loc 1 128 16 is_stmt 0 view .LVU230
+	cmpq	%r11, %rax
+	je	.L84
+	.loc 1 129 17 is_stmt 1 view .LVU231
+	movsd	(%r9,%rax,8), %xmm0
+	.loc 1 127 38 is_stmt 0 view .LVU232
+	addq	$1, %rax
+.LVL80:
+	.loc 1 129 17 view .LVU233
+	movsd	%xmm0, 0(%r13)
+	.loc 1 127 38 is_stmt 1 view .LVU234
+.LVL81:
+	.loc 1 127 31 view .LVU235
+	addq	%r8, %r13
+	cmpq	%rax, %rsi
+	jne	.L87
+.L86:
+	.loc 1 127 31 is_stmt 0 view .LVU236
+.LBE266:
+	.loc 1 132 9 is_stmt 1 view .LVU237
+	.loc 1 132 12 is_stmt 0 view .LVU238
+	cmpq	%rbp, %r11
+	jb	.L88
+	cmpq	%rsi, %r11
+	jnb	.L88
+	.loc 1 133 13 is_stmt 1 view .LVU239
+	movsd	(%r12), %xmm0
+	movq	-104(%rsp), %rax
+.LVL82:
+	.loc 1 133 13 is_stmt 0 view .LVU240
+	movsd	%xmm0, (%rax)
+.L88:
+	.loc 1 126 34 is_stmt 1 view .LVU241
+	.loc 1 126 27 is_stmt 0 view .LVU242
+	movq	-64(%rsp), %rax
+	movq	-72(%rsp), %r13
+	.loc 1 126 34 view .LVU243
+	addq	$1, %r11
+.LVL83:
+	.loc 1 126 27 is_stmt 1 view .LVU244
+	addq	$8, %rbx
+	addq	%r13, -104(%rsp)
+	addq	%rax, %r12
+	movq	-56(%rsp), %rax
+	addq	%rax, %r9
+	cmpq	%r11, -80(%rsp)
+	jne	.L83
+.LVL84:
+	.loc 1 126 27 is_stmt 0 view .LVU245
+.LBE268:
+.LBE271:
+	.loc 1 156 36 is_stmt 1 view .LVU246
+	addq	%r14, %r10
+	cmpq	%rdi, %rdx
+	jb	.L89
+	movq	-48(%rsp), %rcx
+.LVL85:
+	.loc 1 156 36 is_stmt 0 view .LVU247
+	movq	-40(%rsp), %rsi
+	movq	-32(%rsp), %rbp
+	movq	-24(%rsp), %rbx
+	movq	-16(%rsp), %rax
+	movq	-8(%rsp), %r11
+.LVL86:
+.L90:
+	.loc 1 156 36 view .LVU248
+.LBE273:
+	.loc 1 155 40 is_stmt 1 view .LVU249
+	.loc 1 155 32 view .LVU250
+	addq	%rbp, -96(%rsp)
+	addq	%rsi, %r15
+	addq	%rbx, -88(%rsp)
+	cmpq	%rax, %rcx
+	jb	.L82
+.LBE275:
+.LBE277:
+	.loc 1 450 1 is_stmt 0 view .LVU251
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.cfi_restore_state
+.LBB278:
+.LBB276:
+.LBB274:
+.LBB272:
+.LBB269:
+.LBB267:
+	.loc 1 127 38 is_stmt 1 view .LVU252
+	addq	$1, %rax
+.LVL88:
+	.loc 1 127 31 view .LVU253
+	addq	%r8, %r13
+	cmpq	%rax, %rsi
+	jne	.L87
+	jmp	.L86
+.LVL89:
+.L113:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 127 31 is_stmt 0 view .LVU254
+	ret
+.LBE267:
+.LBE269:
+.LBE272:
+.LBE274:
+.LBE276:
+.LBE278:
+	.cfi_endproc
+.LFE26:
+	.size	trans_rect, .-trans_rect
+	.p2align 4
+	.type	transpose_staged.constprop.0, @function
+transpose_staged.constprop.0:
+.LVL90:
+.LFB37:
+	.loc 1 295 13 is_stmt 1 view -0
+	.cfi_startproc
+.LBB359:
+	.loc 1 298 28 view .LVU256
+.LBE359:
+	.loc 1 295 13 is_stmt 0 view .LVU257
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$64, %rsp
+	.cfi_def_cfa_offset 120
+	.loc 1 295 13 view .LVU258
+	movq	%rdi, 40(%rsp)
+	movq	120(%rsp), %r13
+	movl	%esi, 48(%rsp)
+.LBB500:
+	.loc 1 298 28 view .LVU259
+	testq	%r8, %r8
+	je	.L116
+	testq	%rcx, %rcx
+	je	.L116
+	movq	%r8, %rax
+	movq	%rcx, %r12
+	.loc 1 298 17 view .LVU260
+	movq	%rcx, -40(%rsp)
+	.loc 1 298 28 view .LVU261
+	xorl	%r11d, %r11d
+	movq	%rax, %rbx
+	leaq	0(,%rcx,8), %r8
+.LVL91:
+	.loc 1 298 17 view .LVU262
+	xorl	%edx, %edx
+.LVL92:
+	.loc 1 298 17 view .LVU263
+	movq	%rax, %rsi
+	salq	$6, %rbx
+	salq	$6, %r12
+	movq	%r8, %rbp
+	.loc 1 298 28 view .LVU264
+	xorl	%edi, %edi
+	movq	%rbx, -32(%rsp)
+	leaq	0(,%rax,8), %r15
+	.loc 1 298 17 view .LVU265
+	movq	%r9, %r8
+	movq	%rdx, %rax
+.LVL93:
+	.loc 1 298 17 view .LVU266
+	movq	%r12, %rdx
+	movq	%r11, %r12
+	movq	%r13, %r11
+.LVL94:
+.L151:
+.LBB360:
+	.loc 1 299 9 is_stmt 1 view .LVU267
+	movq	%rax, %rcx
+.LBB361:
+.LBB362:
+	.loc 1 114 22 is_stmt 0 view .LVU268
+	movq	%rsi, %r10
+	movq	%rax, -64(%rsp)
+.LBE362:
+.LBE361:
+	.loc 1 299 21 view .LVU269
+	addq	$8, %rax
+.LVL95:
+.LBB365:
+.LBI361:
+	.loc 1 113 15 is_stmt 1 view .LVU270
+.LBB363:
+	.loc 1 114 5 view .LVU271
+	.loc 1 114 22 is_stmt 0 view .LVU272
+	cmpq	%rsi, %rax
+.LBE363:
+.LBE365:
+.LBB366:
+.LBB367:
+.LBB368:
+.LBB369:
+.LBB370:
+.LBB371:
+.LBB372:
+.LBB373:
+.LBB374:
+.LBB375:
+.LBB376:
+.LBB377:
+.LBB378:
+	.loc 1 174 40 view .LVU273
+	movq	%rdx, -8(%rsp)
+.LBE378:
+.LBE377:
+.LBE376:
+.LBE375:
+.LBE374:
+.LBE373:
+.LBE372:
+.LBE371:
+.LBE370:
+.LBE369:
+.LBE368:
+.LBE367:
+.LBE366:
+.LBB496:
+.LBB364:
+	.loc 1 114 22 view .LVU274
+	cmovbe	%rax, %r10
+.LVL96:
+	.loc 1 114 22 view .LVU275
+.LBE364:
+.LBE496:
+	.loc 1 300 9 is_stmt 1 view .LVU276
+.LBB497:
+	.loc 1 300 14 view .LVU277
+	.loc 1 300 32 view .LVU278
+.LBB494:
+.LBB485:
+.LBB482:
+.LBB452:
+.LBB449:
+.LBB443:
+.LBB435:
+.LBB422:
+.LBB413:
+.LBB391:
+.LBB386:
+.LBB381:
+	.loc 1 174 40 is_stmt 0 view .LVU279
+	movq	%rdi, (%rsp)
+	movq	$0, -48(%rsp)
+.LBE381:
+.LBE386:
+.LBE391:
+.LBE413:
+.LBE422:
+.LBE435:
+	.loc 1 240 73 view .LVU280
+	movq	%r10, %rbx
+.LBB436:
+.LBB423:
+.LBB414:
+.LBB392:
+.LBB387:
+.LBB382:
+	.loc 1 174 40 view .LVU281
+	movq	%rsi, 8(%rsp)
+	movq	%r10, %r14
+.LBE382:
+.LBE387:
+.LBE392:
+.LBE414:
+.LBE423:
+.LBE436:
+	.loc 1 240 73 view .LVU282
+	subq	%rcx, %rbx
+	leaq	(%r11,%rdi), %rcx
+.LVL97:
+.LBB437:
+.LBB424:
+.LBB415:
+.LBB393:
+.LBB388:
+.LBB383:
+	.loc 1 174 40 view .LVU283
+	movq	%r8, 16(%rsp)
+	movq	%rcx, -80(%rsp)
+	leaq	(%r8,%r12), %rcx
+	leaq	-8(,%rbx,8), %r13
+	movq	%rcx, -72(%rsp)
+	movq	%rax, -24(%rsp)
+	movq	128(%rsp), %rax
+	movq	%r12, -16(%rsp)
+	movq	%r11, %r12
+.LVL98:
+.L119:
+	.loc 1 174 40 view .LVU284
+.LBE383:
+.LBE388:
+.LBE393:
+.LBE415:
+.LBE424:
+.LBE437:
+.LBE443:
+.LBE449:
+.LBE452:
+.LBE482:
+.LBE485:
+	.loc 1 301 13 is_stmt 1 view .LVU285
+	movq	-48(%rsp), %rdx
+.LBB486:
+.LBB487:
+	.loc 1 114 22 is_stmt 0 view .LVU286
+	movq	-40(%rsp), %rdi
+	movq	%rdx, -112(%rsp)
+	movq	%rdx, %rsi
+.LBE487:
+.LBE486:
+	.loc 1 301 25 view .LVU287
+	addq	$8, %rdx
+.LBB490:
+.LBB488:
+	.loc 1 114 22 view .LVU288
+	cmpq	%rdi, %rdx
+.LBE488:
+.LBE490:
+	.loc 1 301 25 view .LVU289
+	movq	%rdx, -48(%rsp)
+.LVL99:
+.LBB491:
+.LBI486:
+	.loc 1 113 15 is_stmt 1 view .LVU290
+.LBB489:
+	.loc 1 114 5 view .LVU291
+	.loc 1 114 22 is_stmt 0 view .LVU292
+	cmovbe	%rdx, %rdi
+.LVL100:
+	.loc 1 114 22 view .LVU293
+.LBE489:
+.LBE491:
+	.loc 1 302 13 is_stmt 1 view .LVU294
+	.loc 1 305 17 view .LVU295
+.LBB492:
+.LBI368:
+	.loc 1 269 13 view .LVU296
+.LBB483:
+	.loc 1 273 5 view .LVU297
+.LBB453:
+.LBI370:
+	.loc 1 234 17 view .LVU298
+.LBB450:
+.LBB444:
+	.loc 1 240 60 view .LVU299
+	testq	%rbx, %rbx
+	je	.L152
+.LBE444:
+	.loc 1 238 14 is_stmt 0 view .LVU300
+	xorl	%r8d, %r8d
+.LBB445:
+.LBB438:
+.LBB425:
+.LBB416:
+.LBB394:
+	.loc 1 193 18 view .LVU301
+	movq	%rdi, %rdx
+	movq	%rax, -104(%rsp)
+.LBE394:
+.LBE416:
+.LBE425:
+.LBE438:
+	.loc 1 240 17 view .LVU302
+	movq	%r8, -56(%rsp)
+.LBB439:
+.LBB426:
+.LBB417:
+.LBB403:
+	.loc 1 193 18 view .LVU303
+	subq	%rsi, %rdx
+.LBE403:
+.LBE417:
+.LBE426:
+.LBE439:
+.LBE445:
+	.loc 1 239 12 view .LVU304
+	xorl	%esi, %esi
+.LVL101:
+.LBB446:
+	.loc 1 240 17 view .LVU305
+	movq	%r12, 120(%rsp)
+.LBB440:
+.LBB427:
+.LBB418:
+.LBB404:
+.LBB395:
+.LBB396:
+	.loc 1 174 40 view .LVU306
+	leaq	-8(,%rdx,8), %r9
+.LBE396:
+.LBE395:
+.LBE404:
+.LBE418:
+.LBE427:
+.LBE440:
+	.loc 1 240 17 view .LVU307
+	xorl	%edx, %edx
+	movq	%rax, 128(%rsp)
+	movq	%rbx, -88(%rsp)
+	movq	%rsi, %rbx
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L137:
+.LBB441:
+	.loc 1 242 9 is_stmt 1 view .LVU308
+.LBB428:
+.LBI428:
+	.loc 1 165 15 view .LVU309
+.LBB429:
+	.loc 1 166 5 view .LVU310
+	.loc 1 167 5 view .LVU311
+	.loc 1 167 26 is_stmt 0 view .LVU312
+	movq	-104(%rsp), %r10
+.LBE429:
+.LBE428:
+.LBB431:
+.LBB419:
+.LBB405:
+	.loc 1 192 27 view .LVU313
+	movq	-64(%rsp), %r12
+.LBE405:
+.LBE419:
+.LBE431:
+.LBB432:
+.LBB430:
+	.loc 1 167 26 view .LVU314
+	shrq	$6, %r10
+	.loc 1 167 45 view .LVU315
+	andl	$31, %r10d
+.LVL103:
+	.loc 1 167 45 view .LVU316
+.LBE430:
+.LBE432:
+	.loc 1 243 9 is_stmt 1 view .LVU317
+.LBB433:
+.LBI374:
+	.loc 1 188 15 view .LVU318
+.LBB420:
+.LBB406:
+	.loc 1 192 27 view .LVU319
+	cmpq	%r14, %r12
+	jnb	.L122
+.LBE406:
+	.loc 1 191 12 is_stmt 0 view .LVU320
+	movq	%rdi, -96(%rsp)
+.LBB407:
+	.loc 1 192 27 view .LVU321
+	movq	-72(%rsp), %r11
+.LBE407:
+	.loc 1 191 12 view .LVU322
+	xorl	%r8d, %r8d
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+.LBB408:
+	.loc 1 193 9 is_stmt 1 view .LVU323
+.LBB401:
+.LBI395:
+	.loc 1 171 15 view .LVU324
+.LBB399:
+	.loc 1 173 5 view .LVU325
+	.loc 1 173 15 is_stmt 0 view .LVU326
+	movq	%r11, %rax
+	.loc 1 174 15 view .LVU327
+	leaq	(%r11,%r9), %rcx
+	.loc 1 173 15 view .LVU328
+	shrq	$6, %rax
+.LVL105:
+	.loc 1 174 5 is_stmt 1 view .LVU329
+	.loc 1 174 15 is_stmt 0 view .LVU330
+	shrq	$6, %rcx
+.LVL106:
+	.loc 1 175 5 is_stmt 1 view .LVU331
+	.loc 1 176 5 view .LVU332
+.LBB397:
+	.loc 1 176 10 view .LVU333
+	.loc 1 176 39 view .LVU334
+	cmpq	%rax, %rcx
+	jb	.L123
+	.loc 1 176 39 is_stmt 0 view .LVU335
+.LBE397:
+	.loc 1 175 12 view .LVU336
+	xorl	%esi, %esi
+	jmp	.L125
+.LVL107:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+.LBB398:
+	.loc 1 176 52 view .LVU337
+	movq	%rdi, %rax
+.LVL108:
+.L125:
+	.loc 1 177 9 is_stmt 1 view .LVU338
+	.loc 1 177 19 is_stmt 0 view .LVU339
+	movq	%rax, %rdi
+	andl	$31, %edi
+	.loc 1 178 18 view .LVU340
+	cmpq	%rdi, %r10
+	sete	%dil
+	movzbl	%dil, %edi
+	addq	%rdi, %rsi
+.LVL109:
+	.loc 1 176 52 is_stmt 1 view .LVU341
+	leaq	1(%rax), %rdi
+.LVL110:
+	.loc 1 176 39 view .LVU342
+	cmpq	%rax, %rcx
+	jne	.L153
+.LBE398:
+.LBE399:
+.LBE401:
+	.loc 1 193 15 is_stmt 0 view .LVU343
+	addq	%rsi, %r8
+.LVL111:
+.L123:
+.LBB402:
+.LBB400:
+	.loc 1 181 5 is_stmt 1 view .LVU344
+	.loc 1 181 5 is_stmt 0 view .LVU345
+.LBE400:
+.LBE402:
+	.loc 1 192 34 is_stmt 1 view .LVU346
+	addq	$1, %r12
+.LVL112:
+	.loc 1 192 27 view .LVU347
+	addq	%rbp, %r11
+	cmpq	%r12, %r14
+	jne	.L126
+	movq	-96(%rsp), %rdi
+.LVL113:
+	.loc 1 192 27 is_stmt 0 view .LVU348
+.LBE408:
+.LBB409:
+	.loc 1 195 27 is_stmt 1 view .LVU349
+	cmpq	%rdi, -112(%rsp)
+	jnb	.L130
+.LVL114:
+.L128:
+	.loc 1 195 27 is_stmt 0 view .LVU350
+.LBE409:
+	.loc 1 191 12 view .LVU351
+	movq	-80(%rsp), %r11
+	movq	-112(%rsp), %r12
+.LVL115:
+	.loc 1 191 12 view .LVU352
+	movq	%r14, -96(%rsp)
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L134:
+.LBB410:
+	.loc 1 196 9 is_stmt 1 view .LVU353
+.LBB389:
+.LBI377:
+	.loc 1 171 15 view .LVU354
+.LBB384:
+	.loc 1 173 5 view .LVU355
+	.loc 1 173 15 is_stmt 0 view .LVU356
+	movq	%r11, %rax
+	.loc 1 174 15 view .LVU357
+	leaq	(%r11,%r13), %rcx
+	.loc 1 173 15 view .LVU358
+	shrq	$6, %rax
+.LVL117:
+	.loc 1 174 5 is_stmt 1 view .LVU359
+	.loc 1 174 15 is_stmt 0 view .LVU360
+	shrq	$6, %rcx
+.LVL118:
+	.loc 1 175 5 is_stmt 1 view .LVU361
+	.loc 1 176 5 view .LVU362
+.LBB379:
+	.loc 1 176 10 view .LVU363
+	.loc 1 176 39 view .LVU364
+	cmpq	%rax, %rcx
+	jb	.L131
+.LBE379:
+	.loc 1 175 12 is_stmt 0 view .LVU365
+	xorl	%esi, %esi
+	jmp	.L133
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L155:
+.LBB380:
+	.loc 1 176 52 view .LVU366
+	movq	%r14, %rax
+.LVL120:
+.L133:
+	.loc 1 177 9 is_stmt 1 view .LVU367
+	.loc 1 177 19 is_stmt 0 view .LVU368
+	movq	%rax, %r14
+	andl	$31, %r14d
+	.loc 1 178 18 view .LVU369
+	cmpq	%r14, %r10
+	sete	%r14b
+	movzbl	%r14b, %r14d
+	addq	%r14, %rsi
+.LVL121:
+	.loc 1 176 52 is_stmt 1 view .LVU370
+	leaq	1(%rax), %r14
+.LVL122:
+	.loc 1 176 39 view .LVU371
+	cmpq	%rax, %rcx
+	jne	.L155
+.LBE380:
+.LBE384:
+.LBE389:
+	.loc 1 196 15 is_stmt 0 view .LVU372
+	addq	%rsi, %r8
+.LVL123:
+.L131:
+.LBB390:
+.LBB385:
+	.loc 1 181 5 is_stmt 1 view .LVU373
+	.loc 1 181 5 is_stmt 0 view .LVU374
+.LBE385:
+.LBE390:
+	.loc 1 195 34 is_stmt 1 view .LVU375
+	addq	$1, %r12
+.LVL124:
+	.loc 1 195 27 view .LVU376
+	addq	%r15, %r11
+	cmpq	%rdi, %r12
+	jb	.L134
+	movq	-96(%rsp), %r14
+.LVL125:
+.L130:
+	.loc 1 195 27 is_stmt 0 view .LVU377
+.LBE410:
+	.loc 1 198 5 is_stmt 1 view .LVU378
+	.loc 1 198 5 is_stmt 0 view .LVU379
+.LBE420:
+.LBE433:
+	.loc 1 243 12 view .LVU380
+	testq	%r8, %r8
+	jne	.L135
+.L129:
+	.loc 1 244 13 is_stmt 1 view .LVU381
+.LVL126:
+	.loc 1 244 37 is_stmt 0 view .LVU382
+	leal	0(,%rbx,8), %ecx
+	movq	%rdx, %rax
+	.loc 1 244 49 view .LVU383
+	addq	$1, %rbx
+.LVL127:
+	.loc 1 244 37 view .LVU384
+	salq	%cl, %rax
+	.loc 1 244 19 view .LVU385
+	orq	%rax, -56(%rsp)
+.LVL128:
+.L135:
+	.loc 1 244 19 view .LVU386
+.LBE441:
+	.loc 1 241 14 is_stmt 1 view .LVU387
+	addq	$1, %rdx
+.LVL129:
+	.loc 1 240 60 view .LVU388
+	cmpq	$32, %rdx
+	je	.L136
+	.loc 1 240 60 is_stmt 0 view .LVU389
+	movq	-88(%rsp), %rax
+	addq	$64, -104(%rsp)
+	cmpq	%rax, %rbx
+	jb	.L137
+	movq	%rax, %rbx
+.LVL130:
+	.loc 1 240 60 view .LVU390
+	movq	-56(%rsp), %r8
+	movq	120(%rsp), %r12
+	movq	128(%rsp), %rax
+.LVL131:
+.L121:
+	.loc 1 240 60 view .LVU391
+.LBE446:
+	.loc 1 254 5 is_stmt 1 view .LVU392
+	.loc 1 254 5 is_stmt 0 view .LVU393
+.LBE450:
+.LBE453:
+	.loc 1 274 5 is_stmt 1 view .LVU394
+.LBB454:
+	.loc 1 274 10 view .LVU395
+	.loc 1 274 27 view .LVU396
+	cmpq	%r14, -64(%rsp)
+	jnb	.L139
+	movq	-112(%rsp), %rsi
+	cmpq	%rdi, %rsi
+	jnb	.L139
+	movq	%rsi, %rdx
+	movq	%rdi, %rcx
+	movq	%r13, 32(%rsp)
+	movq	-72(%rsp), %r9
+	negq	%rdx
+	subq	%rsi, %rcx
+	movq	%r14, 24(%rsp)
+	xorl	%r10d, %r10d
+	salq	$3, %rdx
+	movq	%rcx, %r11
+	movq	%r12, 120(%rsp)
+	movq	%rdx, -96(%rsp)
+	leaq	-1(%rcx), %rdx
+	andq	$-2, %r11
+	movq	%rdx, -104(%rsp)
+	movq	%rcx, %rdx
+	andl	$1, %ecx
+	shrq	%rdx
+	movq	%rcx, -88(%rsp)
+	salq	$4, %rdx
+	movq	%rdx, -56(%rsp)
+	movq	-56(%rsp), %r13
+	movq	%rsi, %rdx
+	leaq	(%rsi,%r11), %rsi
+	movq	%r15, -56(%rsp)
+	movq	%rdx, %r14
+	movq	%rsi, %r12
+.LVL132:
+	.p2align 4,,10
+	.p2align 3
+.L145:
+.LBB455:
+	.loc 1 275 9 view .LVU397
+.LBB456:
+.LBI456:
+	.loc 1 258 15 view .LVU398
+.LBB457:
+	.loc 1 259 5 view .LVU399
+	.loc 1 259 20 is_stmt 0 view .LVU400
+	leal	0(,%r10,8), %ecx
+	movq	%r8, %rsi
+.LBE457:
+.LBE456:
+.LBB460:
+	.loc 1 277 13 view .LVU401
+	movq	-96(%rsp), %rdx
+.LBE460:
+.LBB461:
+.LBB458:
+	.loc 1 259 20 view .LVU402
+	shrq	%cl, %rsi
+	cmpq	$2, -104(%rsp)
+	.loc 1 259 32 view .LVU403
+	movzbl	%sil, %esi
+.LBE458:
+.LBE461:
+.LBB462:
+	.loc 1 277 13 view .LVU404
+	leaq	(%r9,%rdx), %r15
+.LBE462:
+.LBB463:
+.LBB459:
+	.loc 1 259 40 view .LVU405
+	leaq	0(,%rsi,8), %rcx
+.LVL133:
+	.loc 1 259 40 view .LVU406
+.LBE459:
+.LBE463:
+	.loc 1 276 9 is_stmt 1 view .LVU407
+.LBB464:
+	.loc 1 276 14 view .LVU408
+	.loc 1 276 31 view .LVU409
+	jbe	.L140
+	salq	$6, %rsi
+	leaq	8(%r9), %rdx
+	addq	%rax, %rsi
+	cmpq	%rdx, %rsi
+	jne	.L178
+.L140:
+	subq	%r14, %rcx
+.LVL134:
+	.loc 1 277 13 is_stmt 0 view .LVU410
+	movq	%r14, %rdx
+	leaq	(%rax,%rcx,8), %rcx
+.LVL135:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.loc 1 277 13 is_stmt 1 view .LVU411
+	movsd	(%r15,%rdx,8), %xmm0
+	movsd	%xmm0, (%rcx,%rdx,8)
+	.loc 1 276 38 view .LVU412
+	addq	$1, %rdx
+.LVL136:
+	.loc 1 276 31 view .LVU413
+	cmpq	%rdx, %rdi
+	jne	.L148
+.LVL137:
+.L149:
+	.loc 1 276 31 is_stmt 0 view .LVU414
+.LBE464:
+.LBE455:
+	.loc 1 274 34 is_stmt 1 view .LVU415
+	.loc 1 274 27 view .LVU416
+	addq	$1, %r10
+.LVL138:
+	.loc 1 274 27 is_stmt 0 view .LVU417
+	addq	%rbp, %r9
+	cmpq	%r10, %rbx
+	jne	.L145
+.LVL139:
+.L179:
+	.loc 1 274 27 view .LVU418
+	movq	-112(%rsp), %rdx
+	movq	24(%rsp), %r14
+	xorl	%r9d, %r9d
+	movq	32(%rsp), %r13
+	movq	-56(%rsp), %r15
+	movq	120(%rsp), %r12
+.LVL140:
+	.loc 1 274 27 view .LVU419
+.LBE454:
+.LBB471:
+	.loc 1 280 27 is_stmt 1 view .LVU420
+	.loc 1 280 27 is_stmt 0 view .LVU421
+.LBE471:
+.LBB476:
+	.loc 1 274 27 view .LVU422
+	movq	-80(%rsp), %rsi
+	subq	%rdx, %rdi
+.LVL141:
+.L142:
+	.loc 1 274 27 view .LVU423
+.LBE476:
+.LBB477:
+.LBB472:
+	.loc 1 281 31 is_stmt 1 view .LVU424
+.LBE472:
+.LBE477:
+.LBB478:
+.LBB468:
+.LBB465:
+	.loc 1 277 13 is_stmt 0 view .LVU425
+	xorl	%edx, %edx
+.LVL142:
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.loc 1 277 13 view .LVU426
+.LBE465:
+.LBE468:
+.LBE478:
+.LBB479:
+.LBB475:
+	.loc 1 282 13 is_stmt 1 view .LVU427
+.LBB473:
+.LBI473:
+	.loc 1 258 15 view .LVU428
+.LBB474:
+	.loc 1 259 5 view .LVU429
+	.loc 1 259 20 is_stmt 0 view .LVU430
+	leal	0(,%rdx,8), %ecx
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	.loc 1 259 32 view .LVU431
+	movzbl	%r10b, %ecx
+.LBE474:
+.LBE473:
+	.loc 1 282 13 view .LVU432
+	leaq	(%r9,%rcx,8), %rcx
+	movsd	(%rax,%rcx,8), %xmm0
+	movsd	%xmm0, (%rsi,%rdx,8)
+	.loc 1 281 38 is_stmt 1 view .LVU433
+.LVL143:
+	.loc 1 281 31 view .LVU434
+	addq	$1, %rdx
+.LVL144:
+	.loc 1 281 31 is_stmt 0 view .LVU435
+	cmpq	%rbx, %rdx
+	jne	.L150
+.LBE475:
+	.loc 1 280 34 is_stmt 1 view .LVU436
+.LVL145:
+	.loc 1 280 27 view .LVU437
+	addq	$1, %r9
+.LVL146:
+	.loc 1 280 27 is_stmt 0 view .LVU438
+	addq	%r15, %rsi
+	cmpq	%r9, %rdi
+	jne	.L142
+.LVL147:
+.L139:
+	.loc 1 280 27 view .LVU439
+.LBE479:
+.LBE483:
+.LBE492:
+.LBE494:
+	.loc 1 300 32 is_stmt 1 view .LVU440
+	movq	-32(%rsp), %rsi
+	addq	$64, -72(%rsp)
+	addq	%rsi, -80(%rsp)
+	movq	-40(%rsp), %rsi
+	cmpq	%rsi, -48(%rsp)
+	jb	.L119
+.LBE497:
+.LBE360:
+	.loc 1 298 28 is_stmt 0 view .LVU441
+	movq	-8(%rsp), %rdx
+	movq	(%rsp), %rdi
+	movq	%r12, %r11
+	movq	-24(%rsp), %rax
+	movq	-16(%rsp), %r12
+.LVL148:
+	.loc 1 298 28 is_stmt 1 view .LVU442
+	movq	8(%rsp), %rsi
+	movq	16(%rsp), %r8
+	addq	$64, %rdi
+	addq	%rdx, %r12
+	cmpq	%rsi, %rax
+	jb	.L151
+.LVL149:
+.L116:
+	.loc 1 298 28 is_stmt 0 view .LVU443
+.LBE500:
+	.loc 1 309 1 view .LVU444
+	addq	$64, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL150:
+.L178:
+	.cfi_restore_state
+.LBB501:
+.LBB499:
+.LBB498:
+.LBB495:
+.LBB493:
+.LBB484:
+.LBB480:
+.LBB469:
+.LBB466:
+	.loc 1 277 13 view .LVU445
+	xorl	%edx, %edx
+.LVL151:
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	.loc 1 277 13 is_stmt 1 view .LVU446
+	movupd	(%r9,%rdx), %xmm1
+	movups	%xmm1, (%rsi,%rdx)
+	.loc 1 276 38 view .LVU447
+	.loc 1 276 31 view .LVU448
+	addq	$16, %rdx
+	cmpq	%r13, %rdx
+	jne	.L143
+	cmpq	$0, -88(%rsp)
+	je	.L149
+.LVL152:
+	.loc 1 277 13 view .LVU449
+	movsd	(%r15,%r12,8), %xmm0
+	addq	%r11, %rcx
+.LVL153:
+	.loc 1 277 13 is_stmt 0 view .LVU450
+.LBE466:
+.LBE469:
+	.loc 1 274 27 view .LVU451
+	addq	$1, %r10
+.LVL154:
+	.loc 1 274 27 view .LVU452
+	addq	%rbp, %r9
+.LBB470:
+.LBB467:
+	.loc 1 277 13 view .LVU453
+	movsd	%xmm0, (%rax,%rcx,8)
+	.loc 1 276 38 is_stmt 1 view .LVU454
+.LVL155:
+	.loc 1 276 31 view .LVU455
+.LBE467:
+.LBE470:
+	.loc 1 274 34 view .LVU456
+	.loc 1 274 27 view .LVU457
+	cmpq	%r10, %rbx
+	jne	.L145
+	jmp	.L179
+.LVL156:
+.L122:
+	.loc 1 274 27 is_stmt 0 view .LVU458
+.LBE480:
+.LBB481:
+.LBB451:
+.LBB447:
+.LBB442:
+.LBB434:
+.LBB421:
+.LBB411:
+	.loc 1 195 27 is_stmt 1 view .LVU459
+.LBE411:
+	.loc 1 191 12 is_stmt 0 view .LVU460
+	xorl	%r8d, %r8d
+.LBB412:
+	.loc 1 195 27 view .LVU461
+	cmpq	%rdi, -112(%rsp)
+	jb	.L128
+	jmp	.L129
+.LVL157:
+.L136:
+	.loc 1 195 27 view .LVU462
+.LBE412:
+.LBE421:
+.LBE434:
+.LBE442:
+.LBE447:
+	.loc 1 247 8 view .LVU463
+	movq	%rbx, %rdx
+.LVL158:
+	.loc 1 247 8 view .LVU464
+	movq	-88(%rsp), %rbx
+.LVL159:
+	.loc 1 247 8 view .LVU465
+	movq	-56(%rsp), %r8
+	movq	120(%rsp), %r12
+	movq	128(%rsp), %rax
+	.loc 1 247 5 is_stmt 1 view .LVU466
+	.loc 1 247 8 is_stmt 0 view .LVU467
+	cmpq	%rbx, %rdx
+	jnb	.L121
+	.loc 1 249 15 view .LVU468
+	xorl	%r8d, %r8d
+.LBB448:
+	.loc 1 250 21 view .LVU469
+	xorl	%edx, %edx
+.LVL160:
+.L138:
+	.loc 1 251 13 is_stmt 1 view .LVU470
+	.loc 1 251 34 is_stmt 0 view .LVU471
+	leal	0(,%rdx,8), %ecx
+	movq	%rdx, %rsi
+	.loc 1 250 42 view .LVU472
+	addq	$1, %rdx
+.LVL161:
+	.loc 1 251 34 view .LVU473
+	salq	%cl, %rsi
+.LVL162:
+	.loc 1 251 19 view .LVU474
+	orq	%rsi, %r8
+.LVL163:
+	.loc 1 250 42 is_stmt 1 view .LVU475
+	.loc 1 250 30 view .LVU476
+	cmpq	%rbx, %rdx
+	jne	.L138
+	jmp	.L121
+.LVL164:
+.L152:
+	.loc 1 250 30 is_stmt 0 view .LVU477
+.LBE448:
+	.loc 1 238 14 view .LVU478
+	xorl	%r8d, %r8d
+	jmp	.L121
+.LBE451:
+.LBE481:
+.LBE484:
+.LBE493:
+.LBE495:
+.LBE498:
+.LBE499:
+.LBE501:
+	.cfi_endproc
+.LFE37:
+	.size	transpose_staged.constprop.0, .-transpose_staged.constprop.0
+	.p2align 4
+	.type	trans_staged, @function
+trans_staged:
+.LVL165:
+.LFB24:
+	.loc 1 411 48 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 412 5 view .LVU480
+	.loc 1 413 5 view .LVU481
+	.loc 1 415 5 view .LVU482
+	.loc 1 411 48 is_stmt 0 view .LVU483
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 411 48 view .LVU484
+	movq	%rdx, %r9
+	.loc 1 415 5 view .LVU485
+	movl	$1, %edx
+.LVL166:
+	.loc 1 415 5 view .LVU486
+	pushq	%r8
+	.cfi_def_cfa_offset 24
+	movq	%rsi, %r8
+.LVL167:
+	.loc 1 415 5 view .LVU487
+	movl	8+test_cache(%rip), %esi
+.LVL168:
+	.loc 1 415 5 view .LVU488
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rcx
+.LVL169:
+	.loc 1 415 5 view .LVU489
+	movq	test_cache(%rip), %rdi
+.LVL170:
+	.loc 1 415 5 view .LVU490
+	call	transpose_staged.constprop.0
+.LVL171:
+	.loc 1 417 5 is_stmt 1 view .LVU491
+	.loc 1 418 1 is_stmt 0 view .LVU492
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	trans_staged, .-trans_staged
+	.p2align 4
+	.type	transpose_submit, @function
+transpose_submit:
+.LVL172:
+.LFB27:
+	.loc 1 460 52 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 460 52 is_stmt 0 view .LVU494
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r9
+	movq	%rdi, %rax
+	movq	%r8, %rdx
+.LVL173:
+	.loc 1 460 52 view .LVU495
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 192
+	.loc 1 460 52 view .LVU496
+	movq	%rsi, 8(%rsp)
+	movq	%rcx, 80(%rsp)
+.LVL174:
+	.loc 1 461 5 is_stmt 1 view .LVU497
+	.loc 1 461 8 is_stmt 0 view .LVU498
+	cmpq	$1024, %rdi
+	jne	.L183
+	cmpq	$1024, %rsi
+	je	.L270
+.L183:
+	.loc 1 464 12 is_stmt 1 view .LVU499
+	.loc 1 464 15 is_stmt 0 view .LVU500
+	movq	8(%rsp), %rbx
+	cmpq	%rbx, %rax
+	je	.L271
+.LVL175:
+.LBB626:
+.LBI626:
+	.loc 1 459 13 is_stmt 1 view .LVU501
+.LBB627:
+	.loc 1 466 12 view .LVU502
+	.loc 1 466 44 is_stmt 0 view .LVU503
+	cmpq	$7, 8(%rsp)
+	jbe	.L198
+	cmpq	$7, %rax
+	ja	.L272
+.L198:
+.LVL176:
+.LBB628:
+.LBB629:
+.LBB630:
+.LBB631:
+	.loc 1 148 32 is_stmt 1 view .LVU504
+	testq	%rax, %rax
+	je	.L182
+.LVL177:
+.L196:
+	.loc 1 148 32 is_stmt 0 view .LVU505
+	movq	8(%rsp), %rbx
+	testq	%rbx, %rbx
+	je	.L182
+	leaq	1(%rax), %rdx
+	leaq	0(,%rbx,8), %rsi
+.LVL178:
+	.loc 1 148 32 view .LVU506
+	movq	%rbx, %rdi
+	movq	%rdx, %rbx
+	salq	$6, %rdi
+	movq	%rsi, 16(%rsp)
+	leaq	8(%rsi), %r13
+	salq	$6, %rbx
+	leaq	64(%rdi), %rcx
+.LVL179:
+.LBB632:
+.LBB633:
+.LBB634:
+	.loc 1 126 27 view .LVU507
+	movq	80(%rsp), %rsi
+	movq	%rdi, %rbp
+	movq	%rbx, 56(%rsp)
+	subq	$64, %rbx
+	leaq	0(,%rdx,8), %r15
+	movq	%rbx, 72(%rsp)
+	leaq	-8(%r15), %r12
+	movq	%rcx, 64(%rsp)
+	xorl	%ecx, %ecx
+.LVL180:
+.L209:
+	.loc 1 126 27 view .LVU508
+.LBE634:
+.LBE633:
+	.loc 1 149 36 is_stmt 1 view .LVU509
+.LBB639:
+.LBB640:
+	.loc 1 114 22 is_stmt 0 view .LVU510
+	movq	80(%rsp), %rdx
+	movq	%rcx, %r8
+.LBE640:
+.LBE639:
+.LBE632:
+	.loc 1 148 40 view .LVU511
+	addq	$8, %rcx
+.LVL181:
+	.loc 1 148 40 view .LVU512
+	movq	%r9, %r11
+	movq	%rcx, 88(%rsp)
+.LBB651:
+.LBB643:
+.LBB641:
+	.loc 1 114 22 view .LVU513
+	cmpq	%rcx, %rax
+	movq	%rcx, %rbx
+	movq	%r9, %rdi
+	movq	%rdx, 24(%rsp)
+	cmovbe	%rax, %rbx
+.LBE641:
+.LBE643:
+	.loc 1 149 25 view .LVU514
+	xorl	%r10d, %r10d
+	movq	%rsi, 96(%rsp)
+	movq	%rax, 112(%rsp)
+	movq	%r9, 120(%rsp)
+	movq	%rbp, 104(%rsp)
+	movq	%rsi, %rbp
+.LVL182:
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	.loc 1 150 17 is_stmt 1 view .LVU515
+.LBB644:
+.LBI639:
+	.loc 1 113 15 view .LVU516
+.LBB642:
+	.loc 1 114 5 view .LVU517
+	.loc 1 114 5 is_stmt 0 view .LVU518
+.LBE642:
+.LBE644:
+.LBB645:
+.LBB646:
+	.loc 1 114 22 view .LVU519
+	movq	8(%rsp), %rcx
+	movq	%r10, %rax
+.LBE646:
+.LBE645:
+	.loc 1 150 17 view .LVU520
+	addq	$8, %r10
+.LVL183:
+.LBB648:
+.LBI645:
+	.loc 1 113 15 is_stmt 1 view .LVU521
+.LBB647:
+	.loc 1 114 5 view .LVU522
+	.loc 1 114 22 is_stmt 0 view .LVU523
+	cmpq	%r10, %rcx
+	movq	%rcx, %r14
+	cmova	%r10, %r14
+.LVL184:
+	.loc 1 114 22 view .LVU524
+.LBE647:
+.LBE648:
+.LBB649:
+.LBI633:
+	.loc 1 124 13 is_stmt 1 view .LVU525
+	.loc 1 126 5 view .LVU526
+.LBB637:
+	.loc 1 126 10 view .LVU527
+	.loc 1 126 27 view .LVU528
+	cmpq	%r14, %rax
+	jnb	.L201
+	movq	%r10, 32(%rsp)
+	movq	24(%rsp), %rcx
+.LVL185:
+	.loc 1 126 27 is_stmt 0 view .LVU529
+	movq	%r11, %r9
+	movq	%rbp, %rsi
+	movq	%rdi, 40(%rsp)
+	movq	%rdi, %rdx
+	movq	%rbp, 48(%rsp)
+.LVL186:
+	.p2align 4,,10
+	.p2align 3
+.L200:
+.LBB635:
+	.loc 1 127 31 is_stmt 1 view .LVU530
+	.loc 1 129 17 is_stmt 0 view .LVU531
+	movq	%rsi, %rbp
+	movq	%r8, %r10
+	leaq	1(%rax), %rdi
+	.loc 1 127 31 view .LVU532
+	cmpq	%rbx, %r8
+	jnb	.L204
+	.loc 1 127 31 view .LVU533
+	movq	%rdx, (%rsp)
+.LVL187:
+	.p2align 4,,10
+	.p2align 3
+.L205:
+	.loc 1 128 13 is_stmt 1 view .LVU534
+	.loc 1 128 16 is_stmt 0 view .LVU535
+	cmpq	%r10, %rax
+	je	.L202
+	.loc 1 129 17 is_stmt 1 view .LVU536
+	movsd	(%r9,%r10,8), %xmm0
+	.loc 1 127 31 is_stmt 0 view .LVU537
+	movq	16(%rsp), %rdx
+	.loc 1 127 38 view .LVU538
+	addq	$1, %r10
+.LVL188:
+	.loc 1 129 17 view .LVU539
+	movsd	%xmm0, 0(%rbp)
+	.loc 1 127 38 is_stmt 1 view .LVU540
+.LVL189:
+	.loc 1 127 31 view .LVU541
+	addq	%rdx, %rbp
+	cmpq	%r10, %rbx
+	jne	.L205
+.L269:
+	.loc 1 127 31 is_stmt 0 view .LVU542
+	movq	(%rsp), %rdx
+.LVL190:
+.L204:
+	.loc 1 127 31 view .LVU543
+.LBE635:
+	.loc 1 132 9 is_stmt 1 view .LVU544
+	.loc 1 132 12 is_stmt 0 view .LVU545
+	cmpq	%r8, %rax
+	jb	.L206
+	cmpq	%rbx, %rax
+	jnb	.L206
+	.loc 1 133 13 is_stmt 1 view .LVU546
+	movsd	(%rdx), %xmm0
+	movsd	%xmm0, (%rcx)
+.L206:
+	.loc 1 126 34 view .LVU547
+	movq	%rdi, %rax
+.LVL191:
+	.loc 1 126 27 view .LVU548
+	addq	%r15, %rdx
+	addq	%r13, %rcx
+	addq	$8, %rsi
+	addq	%r12, %r9
+	cmpq	%rdi, %r14
+	jne	.L200
+	.loc 1 126 27 is_stmt 0 view .LVU549
+	movq	32(%rsp), %r10
+	movq	40(%rsp), %rdi
+	movq	48(%rsp), %rbp
+.LVL192:
+.L201:
+	.loc 1 126 27 view .LVU550
+.LBE637:
+.LBE649:
+	.loc 1 149 36 is_stmt 1 view .LVU551
+	movq	56(%rsp), %rax
+	movq	64(%rsp), %rdx
+	addq	$64, %rbp
+	addq	%rdx, 24(%rsp)
+	addq	%rax, %rdi
+	movq	72(%rsp), %rax
+	addq	%rax, %r11
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r10
+	jb	.L208
+.LBE651:
+	.loc 1 148 32 is_stmt 0 view .LVU552
+	movq	96(%rsp), %rsi
+	movq	104(%rsp), %rbp
+	movq	88(%rsp), %rcx
+	movq	112(%rsp), %rax
+	movq	120(%rsp), %r9
+	.loc 1 148 40 is_stmt 1 view .LVU553
+.LVL193:
+	.loc 1 148 32 view .LVU554
+	addq	%rbp, %rsi
+	cmpq	%rax, %rcx
+	jb	.L209
+.LVL194:
+.L182:
+	.loc 1 148 32 is_stmt 0 view .LVU555
+.LBE631:
+.LBE630:
+.LBE629:
+.LBE628:
+.LBE627:
+.LBE626:
+	.loc 1 471 1 view .LVU556
+	addq	$136, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL195:
+.L271:
+	.cfi_restore_state
+	.loc 1 464 23 discriminator 1 view .LVU557
+	testb	$63, %al
+	jne	.L196
+	.loc 1 465 9 is_stmt 1 view .LVU558
+.LVL196:
+.LBB682:
+.LBI682:
+	.loc 1 410 13 view .LVU559
+.LBB683:
+	.loc 1 412 5 view .LVU560
+	.loc 1 413 5 view .LVU561
+	.loc 1 415 5 view .LVU562
+	pushq	%rdx
+	.cfi_def_cfa_offset 200
+	movq	test_cache(%rip), %rdi
+	movq	%rax, %r8
+	movq	%rax, %rcx
+.LVL197:
+	.loc 1 415 5 is_stmt 0 view .LVU563
+	pushq	88(%rsp)
+	.cfi_def_cfa_offset 208
+	movl	8+test_cache(%rip), %esi
+.LVL198:
+	.loc 1 415 5 view .LVU564
+	movl	$1, %edx
+.LVL199:
+	.loc 1 415 5 view .LVU565
+	call	transpose_staged.constprop.0
+.LVL200:
+	.loc 1 417 5 is_stmt 1 view .LVU566
+	.loc 1 418 1 is_stmt 0 view .LVU567
+	popq	%rax
+	.cfi_def_cfa_offset 200
+	popq	%rdx
+	.cfi_def_cfa_offset 192
+	jmp	.L182
+.LVL201:
+.L270:
+	.loc 1 418 1 view .LVU568
+	movq	%rcx, %r13
+	movq	%r9, %rax
+.LVL202:
+	.loc 1 418 1 view .LVU569
+	movq	%rcx, %rsi
+.LVL203:
+	.loc 1 418 1 view .LVU570
+.LBE683:
+.LBE682:
+	.loc 1 461 8 view .LVU571
+	xorl	%r12d, %r12d
+.LBB684:
+.LBB685:
+	.loc 1 155 21 view .LVU572
+	xorl	%ebp, %ebp
+.LVL204:
+.L184:
+.LBB686:
+	.loc 1 156 36 is_stmt 1 view .LVU573
+	movq	%rbp, %r14
+	.loc 1 157 17 is_stmt 0 view .LVU574
+	addq	$8, %rbp
+.LVL205:
+	.loc 1 157 17 view .LVU575
+	movq	%rsi, %rcx
+	movq	%rax, %rdx
+	xorl	%edi, %edi
+	cmpq	%rbp, %r14
+	jnb	.L194
+	movq	%rsi, 16(%rsp)
+	movq	%rax, %r8
+	movq	%r14, 8(%rsp)
+	movq	%r12, (%rsp)
+.LVL206:
+.L192:
+	.loc 1 157 17 is_stmt 1 view .LVU576
+	movq	(%rsp), %r10
+	movq	8(%rsp), %r11
+	movq	%rdi, %r15
+	movq	%rcx, %r14
+	addq	$4, %rdi
+.LVL207:
+.LBB687:
+.LBI687:
+	.loc 1 124 13 view .LVU577
+.LBB688:
+	.loc 1 126 27 view .LVU578
+.LBE688:
+.LBE687:
+	.loc 1 157 17 is_stmt 0 view .LVU579
+	movq	%rdx, %rbx
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L185:
+.LBB691:
+.LBB690:
+.LBB689:
+	.loc 1 127 31 is_stmt 1 view .LVU580
+	movq	%r14, %r12
+	movq	%rbx, %rsi
+	movq	%r15, %rax
+	cmpq	%rdi, %r15
+	jnb	.L188
+.LVL209:
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.loc 1 128 13 view .LVU581
+	.loc 1 128 16 is_stmt 0 view .LVU582
+	cmpq	%r11, %rax
+	je	.L186
+	.loc 1 129 17 is_stmt 1 view .LVU583
+	movsd	(%rsi), %xmm0
+	movsd	%xmm0, (%r12)
+	.loc 1 127 38 view .LVU584
+.L186:
+	.loc 1 127 38 view .LVU585
+	addq	$1, %rax
+.LVL210:
+	.loc 1 127 31 view .LVU586
+	addq	$8, %rsi
+	addq	$8192, %r12
+	cmpq	%rax, %rdi
+	jne	.L189
+.L188:
+	.loc 1 127 31 is_stmt 0 view .LVU587
+.LBE689:
+	.loc 1 132 9 is_stmt 1 view .LVU588
+	.loc 1 132 12 is_stmt 0 view .LVU589
+	cmpq	%r15, %r11
+	jb	.L190
+	cmpq	%rdi, %r11
+	jnb	.L190
+	.loc 1 133 13 is_stmt 1 view .LVU590
+	movsd	(%r9,%r10), %xmm0
+	movsd	%xmm0, 0(%r13,%r10)
+.L190:
+	.loc 1 126 34 view .LVU591
+	addq	$1, %r11
+.LVL211:
+	.loc 1 126 27 view .LVU592
+	addq	$8192, %rbx
+	addq	$8, %r14
+	addq	$8200, %r10
+	cmpq	%r11, %rbp
+	jne	.L185
+.LVL212:
+	.loc 1 126 27 is_stmt 0 view .LVU593
+.LBE690:
+.LBE691:
+	.loc 1 156 36 is_stmt 1 view .LVU594
+	addq	$32, %rdx
+	addq	$32768, %rcx
+	cmpq	$1024, %rdi
+	jne	.L192
+	movq	16(%rsp), %rsi
+	movq	(%rsp), %r12
+	movq	%r8, %rax
+.LVL213:
+.L194:
+	.loc 1 156 36 is_stmt 0 view .LVU595
+.LBE686:
+	.loc 1 155 40 is_stmt 1 view .LVU596
+	.loc 1 155 32 view .LVU597
+	addq	$65600, %r12
+	addq	$65536, %rax
+	addq	$64, %rsi
+	cmpq	$1024, %rbp
+	jne	.L184
+	jmp	.L182
+.LVL214:
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	.loc 1 155 32 is_stmt 0 view .LVU598
+.LBE685:
+.LBE684:
+.LBB692:
+.LBB681:
+.LBB656:
+.LBB655:
+.LBB654:
+.LBB653:
+.LBB652:
+.LBB650:
+.LBB638:
+.LBB636:
+	.loc 1 127 38 is_stmt 1 view .LVU599
+	.loc 1 127 31 is_stmt 0 view .LVU600
+	movq	16(%rsp), %rdx
+	.loc 1 127 38 view .LVU601
+	movq	%rdi, %r10
+.LVL215:
+	.loc 1 127 31 is_stmt 1 view .LVU602
+	addq	%rdx, %rbp
+	cmpq	%rdi, %rbx
+	jne	.L205
+.LVL216:
+	.loc 1 127 31 is_stmt 0 view .LVU603
+	jmp	.L269
+.LVL217:
+.L272:
+	.loc 1 127 31 view .LVU604
+	movq	%rbx, %rsi
+.LVL218:
+	.loc 1 127 31 view .LVU605
+	leaq	1(%rax), %rcx
+.LVL219:
+	.loc 1 127 31 view .LVU606
+	movq	%r9, %rbx
+.LVL220:
+	.loc 1 127 31 view .LVU607
+	movq	%r9, 24(%rsp)
+	leaq	1(%rsi), %rdx
+.LVL221:
+	.loc 1 127 31 view .LVU608
+	salq	$5, %rsi
+	movq	%rcx, %r8
+.LVL222:
+	.loc 1 127 31 view .LVU609
+.LBE636:
+.LBE638:
+.LBE650:
+.LBE652:
+.LBE653:
+.LBE654:
+.LBE655:
+.LBE656:
+	.loc 1 466 44 view .LVU610
+	movq	%rbx, 40(%rsp)
+	movq	%rsi, 56(%rsp)
+	movq	80(%rsp), %rsi
+	movq	%rdx, %r10
+	movq	%rax, %r12
+	salq	$8, %r8
+	leaq	0(,%rcx,8), %r15
+	leaq	0(,%rdx,8), %r14
+	salq	$8, %r10
+	movq	%rsi, 32(%rsp)
+	leaq	-8(%r15), %r13
+	leaq	-8(%r14), %r11
+	xorl	%esi, %esi
+	leaq	-256(%r8), %r9
+.LVL223:
+.L199:
+.LBB657:
+.LBB658:
+.LBB659:
+.LBB660:
+	.loc 1 156 36 is_stmt 1 view .LVU611
+.LBB661:
+.LBB662:
+	.loc 1 114 22 is_stmt 0 view .LVU612
+	movq	8(%rsp), %rax
+	movq	%rsi, %rcx
+	movq	%rsi, 48(%rsp)
+.LBE662:
+.LBE661:
+.LBE660:
+	.loc 1 155 40 view .LVU613
+	addq	$32, %rsi
+.LVL224:
+.LBB679:
+.LBB665:
+.LBB663:
+	.loc 1 114 22 view .LVU614
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+	xorl	%edx, %edx
+	movq	%rax, %rbp
+	movq	80(%rsp), %rax
+	leaq	(%rax,%rcx,8), %rax
+	cmpq	%rbp, %rcx
+	jnb	.L220
+	movq	%rsi, 64(%rsp)
+	movq	%r12, %rcx
+.LVL225:
+	.loc 1 114 22 view .LVU615
+	movq	%r8, 72(%rsp)
+	movq	%r10, 88(%rsp)
+	movq	%r9, 96(%rsp)
+.LVL226:
+.L218:
+	.loc 1 114 22 view .LVU616
+.LBE663:
+.LBE665:
+	.loc 1 157 17 is_stmt 1 view .LVU617
+	movq	%rdx, %r9
+	addq	$4, %rdx
+.LVL227:
+.LBB666:
+.LBI666:
+	.loc 1 113 15 view .LVU618
+.LBB667:
+	.loc 1 114 5 view .LVU619
+	movq	%rax, 16(%rsp)
+	.loc 1 114 22 is_stmt 0 view .LVU620
+	movq	%rax, %r8
+	cmpq	%rdx, %rcx
+	movq	%rdx, %rdi
+	movq	%rdx, (%rsp)
+	movq	40(%rsp), %r10
+	cmovbe	%rcx, %rdi
+.LVL228:
+	.loc 1 114 22 view .LVU621
+.LBE667:
+.LBE666:
+.LBB669:
+.LBI661:
+	.loc 1 113 15 is_stmt 1 view .LVU622
+.LBB664:
+	.loc 1 114 5 view .LVU623
+	.loc 1 114 5 is_stmt 0 view .LVU624
+.LBE664:
+.LBE669:
+.LBB670:
+.LBI670:
+	.loc 1 124 13 is_stmt 1 view .LVU625
+	.loc 1 126 5 view .LVU626
+.LBB671:
+	.loc 1 126 10 view .LVU627
+	.loc 1 126 27 view .LVU628
+.LBE671:
+.LBE670:
+.LBB676:
+.LBB668:
+	.loc 1 114 22 is_stmt 0 view .LVU629
+	movq	32(%rsp), %r12
+	movq	24(%rsp), %rbx
+	movq	48(%rsp), %rsi
+.LVL229:
+	.p2align 4,,10
+	.p2align 3
+.L210:
+	.loc 1 114 22 view .LVU630
+.LBE668:
+.LBE676:
+.LBB677:
+.LBB674:
+.LBB672:
+	.loc 1 127 31 is_stmt 1 view .LVU631
+	.loc 1 129 17 is_stmt 0 view .LVU632
+	movq	%r8, %rdx
+	movq	%r9, %rax
+	.loc 1 127 31 view .LVU633
+	cmpq	%rdi, %r9
+	jnb	.L213
+.LVL230:
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	.loc 1 128 13 is_stmt 1 view .LVU634
+	.loc 1 128 16 is_stmt 0 view .LVU635
+	cmpq	%rsi, %rax
+	je	.L211
+	.loc 1 129 17 is_stmt 1 view .LVU636
+	movsd	(%r10,%rax,8), %xmm0
+	.loc 1 127 38 is_stmt 0 view .LVU637
+	addq	$1, %rax
+.LVL231:
+	.loc 1 129 17 view .LVU638
+	movsd	%xmm0, (%rdx)
+	.loc 1 127 38 is_stmt 1 view .LVU639
+.LVL232:
+	.loc 1 127 31 view .LVU640
+	addq	%r11, %rdx
+	cmpq	%rax, %rdi
+	jne	.L214
+.L213:
+	.loc 1 127 31 is_stmt 0 view .LVU641
+.LBE672:
+	.loc 1 132 9 is_stmt 1 view .LVU642
+	.loc 1 132 12 is_stmt 0 view .LVU643
+	cmpq	%r9, %rsi
+	jb	.L215
+	cmpq	%rdi, %rsi
+	jnb	.L215
+	.loc 1 133 13 is_stmt 1 view .LVU644
+	movsd	(%rbx), %xmm0
+	movsd	%xmm0, (%r12)
+.L215:
+	.loc 1 126 34 view .LVU645
+	addq	$1, %rsi
+.LVL233:
+	.loc 1 126 27 view .LVU646
+	addq	%r15, %rbx
+	addq	%r14, %r12
+	addq	$8, %r8
+	addq	%r13, %r10
+	cmpq	%rsi, %rbp
+	jne	.L210
+.LBE674:
+.LBE677:
+	.loc 1 156 36 is_stmt 0 view .LVU647
+	movq	16(%rsp), %rax
+.LVL234:
+	.loc 1 156 36 view .LVU648
+	movq	56(%rsp), %rbx
+	movq	(%rsp), %rdx
+.LVL235:
+	.loc 1 156 36 is_stmt 1 view .LVU649
+	addq	%rbx, %rax
+	cmpq	%rcx, %rdx
+	jb	.L218
+	movq	64(%rsp), %rsi
+	movq	72(%rsp), %r8
+	movq	%rcx, %r12
+	movq	88(%rsp), %r10
+	movq	96(%rsp), %r9
+.LVL236:
+.L220:
+	.loc 1 156 36 is_stmt 0 view .LVU650
+.LBE679:
+	.loc 1 155 40 is_stmt 1 view .LVU651
+	.loc 1 155 32 view .LVU652
+	movq	8(%rsp), %rax
+	addq	%r8, 24(%rsp)
+	addq	%r10, 32(%rsp)
+	addq	%r9, 40(%rsp)
+	cmpq	%rax, %rsi
+	jb	.L199
+	jmp	.L182
+.LVL237:
+	.p2align 4,,10
+	.p2align 3
+.L211:
+.LBB680:
+.LBB678:
+.LBB675:
+.LBB673:
+	.loc 1 127 38 view .LVU653
+	addq	$1, %rax
+.LVL238:
+	.loc 1 127 31 view .LVU654
+	addq	%r11, %rdx
+	cmpq	%rax, %rdi
+	jne	.L214
+	jmp	.L213
+.LBE673:
+.LBE675:
+.LBE678:
+.LBE680:
+.LBE659:
+.LBE658:
+.LBE657:
+.LBE681:
+.LBE692:
+	.cfi_endproc
+.LFE27:
+	.size	transpose_submit, .-transpose_submit
+	.p2align 4
+	.type	trans_staged_l1, @function
+trans_staged_l1:
+.LVL239:
+.LFB25:
+	.loc 1 426 67 view -0
+	.cfi_startproc
+	.loc 1 426 67 is_stmt 0 view .LVU656
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$248, %rsp
+	.cfi_def_cfa_offset 304
+	.loc 1 426 67 view .LVU657
+	movq	%rdi, 56(%rsp)
+	movq	%rsi, 64(%rsp)
+	movq	%rdx, 88(%rsp)
+.LVL240:
+	.loc 1 427 5 is_stmt 1 view .LVU658
+	.loc 1 428 5 view .LVU659
+	.loc 1 430 5 view .LVU660
+.LBB775:
+.LBI775:
+	.loc 1 295 13 view .LVU661
+.LBB776:
+	.loc 1 298 28 view .LVU662
+.LBE776:
+.LBE775:
+	.loc 1 426 67 is_stmt 0 view .LVU663
+	movq	%rcx, 96(%rsp)
+	movq	%r8, 16(%rsp)
+.LVL241:
+.LBB964:
+.LBB962:
+	.loc 1 298 28 view .LVU664
+	testq	%rsi, %rsi
+	je	.L273
+	testq	%rdi, %rdi
+	je	.L273
+	movq	%rdx, %r10
+	leaq	1(%rsi), %rdx
+.LVL242:
+	.loc 1 298 28 view .LVU665
+	movq	%rcx, %r9
+	xorl	%ebp, %ebp
+	leaq	0(,%rdi,8), %rbx
+	salq	$6, %rdx
+	salq	$6, %rdi
+.LVL243:
+	.loc 1 298 28 view .LVU666
+	leaq	0(,%rsi,8), %r11
+	leaq	64(%rdi), %rcx
+.LVL244:
+	.loc 1 298 28 view .LVU667
+	movq	%rdi, %rax
+	leaq	-64(%rdx), %rdi
+	movq	%rbx, 48(%rsp)
+	movq	%r10, 120(%rsp)
+	addq	$8, %rbx
+	movq	%rcx, %r13
+	movq	%rdx, %r12
+	movq	%rdi, 160(%rsp)
+	movq	%r9, 128(%rsp)
+	movq	%r11, 24(%rsp)
+	movq	%rbx, 152(%rsp)
+	leaq	8(%r11), %rbx
+	movq	%rbx, 144(%rsp)
+	xorl	%ebx, %ebx
+.LVL245:
+.L321:
+.LBB777:
+	.loc 1 299 9 is_stmt 1 view .LVU668
+.LBB778:
+.LBB779:
+	.loc 1 114 22 is_stmt 0 view .LVU669
+	movq	64(%rsp), %rdi
+	movq	%rbx, %r15
+.LBE779:
+.LBE778:
+	.loc 1 299 21 view .LVU670
+	addq	$8, %rbx
+.LVL246:
+.LBB783:
+.LBI778:
+	.loc 1 113 15 is_stmt 1 view .LVU671
+.LBB780:
+	.loc 1 114 5 view .LVU672
+	.loc 1 114 5 is_stmt 0 view .LVU673
+	movq	96(%rsp), %rcx
+.LBE780:
+.LBE783:
+.LBB784:
+.LBB785:
+.LBB786:
+.LBB787:
+.LBB788:
+.LBB789:
+.LBB790:
+.LBB791:
+.LBB792:
+.LBB793:
+.LBB794:
+.LBB795:
+.LBB796:
+	.loc 1 174 40 view .LVU674
+	movq	$0, 112(%rsp)
+.LBE796:
+.LBE795:
+.LBE794:
+.LBE793:
+.LBE792:
+.LBE791:
+.LBE790:
+.LBE789:
+.LBE788:
+.LBE787:
+.LBE786:
+.LBE785:
+.LBE784:
+.LBB956:
+.LBB781:
+	.loc 1 114 22 view .LVU675
+	cmpq	%rbx, %rdi
+	leaq	(%rcx,%r15,8), %rcx
+.LBE781:
+.LBE956:
+.LBB957:
+.LBB953:
+.LBB920:
+.LBB914:
+.LBB881:
+.LBB876:
+.LBB869:
+.LBB859:
+.LBB847:
+.LBB837:
+.LBB813:
+.LBB806:
+.LBB799:
+	.loc 1 174 40 view .LVU676
+	movq	%rbx, 176(%rsp)
+.LBE799:
+.LBE806:
+.LBE813:
+.LBE837:
+.LBE847:
+.LBE859:
+.LBE869:
+.LBE876:
+.LBE881:
+.LBE914:
+.LBE920:
+.LBE953:
+.LBE957:
+.LBB958:
+.LBB782:
+	.loc 1 114 22 view .LVU677
+	cmova	%rbx, %rdi
+.LVL247:
+	.loc 1 114 22 view .LVU678
+.LBE782:
+.LBE958:
+	.loc 1 300 9 is_stmt 1 view .LVU679
+.LBB959:
+	.loc 1 300 14 view .LVU680
+	.loc 1 300 32 view .LVU681
+	movq	%rcx, 80(%rsp)
+.LBB954:
+.LBB921:
+.LBB915:
+.LBB882:
+.LBB877:
+.LBB870:
+.LBB860:
+.LBB848:
+.LBB838:
+.LBB814:
+.LBB807:
+.LBB800:
+	.loc 1 174 40 is_stmt 0 view .LVU682
+	xorl	%r14d, %r14d
+	movq	%rcx, 40(%rsp)
+.LBE800:
+.LBE807:
+.LBE814:
+.LBE838:
+.LBE848:
+.LBE860:
+	.loc 1 240 73 view .LVU683
+	movq	%rdi, %rsi
+.LBB861:
+.LBB849:
+.LBB839:
+.LBB815:
+.LBB808:
+.LBB801:
+	.loc 1 174 40 view .LVU684
+	movq	%rbp, 184(%rsp)
+.LBE801:
+.LBE808:
+.LBE815:
+.LBE839:
+.LBE849:
+.LBE861:
+	.loc 1 240 73 view .LVU685
+	subq	%r15, %rsi
+.LBB862:
+.LBB850:
+.LBB840:
+.LBB816:
+.LBB809:
+.LBB802:
+	.loc 1 174 40 view .LVU686
+	movq	%rax, 192(%rsp)
+	leaq	-8(,%rsi,8), %rdx
+.LBE802:
+.LBE809:
+.LBE816:
+.LBE840:
+.LBE850:
+.LBE862:
+	.loc 1 240 73 view .LVU687
+	movq	%rsi, 8(%rsp)
+	movq	88(%rsp), %rsi
+.LBB863:
+.LBB851:
+.LBB841:
+.LBB817:
+.LBB810:
+.LBB803:
+	.loc 1 174 40 view .LVU688
+	movq	%rdx, 136(%rsp)
+	leaq	(%rsi,%rbp), %rdx
+	movq	%r13, 200(%rsp)
+	movq	%rdi, %r13
+	movq	%rdx, 32(%rsp)
+.LVL248:
+.L276:
+	.loc 1 174 40 view .LVU689
+.LBE803:
+.LBE810:
+.LBE817:
+.LBE841:
+.LBE851:
+.LBE863:
+.LBE870:
+.LBE877:
+.LBE882:
+.LBE915:
+.LBE921:
+	.loc 1 301 13 is_stmt 1 view .LVU690
+.LBB922:
+.LBB923:
+	.loc 1 114 22 is_stmt 0 view .LVU691
+	movq	56(%rsp), %rax
+	movq	%r14, %rbx
+.LBE923:
+.LBE922:
+	.loc 1 301 25 view .LVU692
+	addq	$8, %r14
+.LVL249:
+.LBB925:
+.LBI922:
+	.loc 1 113 15 is_stmt 1 view .LVU693
+.LBB924:
+	.loc 1 114 5 view .LVU694
+	.loc 1 114 22 is_stmt 0 view .LVU695
+	cmpq	%r14, %rax
+	cmova	%r14, %rax
+.LVL250:
+	.loc 1 114 22 view .LVU696
+	movq	%rax, %rbp
+.LVL251:
+	.loc 1 114 22 view .LVU697
+.LBE924:
+.LBE925:
+	.loc 1 302 13 is_stmt 1 view .LVU698
+.LBB926:
+.LBI926:
+	.loc 1 205 13 view .LVU699
+	movq	haswell_l1(%rip), %rax
+.LVL252:
+	.loc 1 205 13 is_stmt 0 view .LVU700
+	movq	%rax, 228(%rsp)
+	movl	8+haswell_l1(%rip), %eax
+	movl	%eax, 236(%rsp)
+.LVL253:
+	.loc 1 208 5 is_stmt 1 view .LVU701
+.LBB927:
+	.loc 1 208 10 view .LVU702
+	.loc 1 208 27 view .LVU703
+	cmpq	%r13, %r15
+	jnb	.L278
+	movq	32(%rsp), %r10
+	movq	%r14, 72(%rsp)
+	movq	%rbx, %r14
+	movq	%r12, 104(%rsp)
+	movq	%rbp, %r12
+	movq	%r15, %rbp
+.LVL254:
+	.loc 1 208 27 is_stmt 0 view .LVU704
+	movq	%r10, %rbx
+.LVL255:
+	.loc 1 208 27 view .LVU705
+	jmp	.L280
+.LVL256:
+	.p2align 4,,10
+	.p2align 3
+.L366:
+	.loc 1 208 34 is_stmt 1 view .LVU706
+	.loc 1 208 27 is_stmt 0 view .LVU707
+	movq	48(%rsp), %rax
+	.loc 1 208 34 view .LVU708
+	addq	$1, %rbp
+.LVL257:
+	.loc 1 208 27 is_stmt 1 view .LVU709
+	addq	%rax, %rbx
+.LVL258:
+	.loc 1 208 27 is_stmt 0 view .LVU710
+	cmpq	%rbp, %r13
+	je	.L365
+.LVL259:
+.L280:
+.LBB928:
+	.loc 1 209 9 is_stmt 1 view .LVU711
+.LBB929:
+.LBI929:
+	.loc 1 165 15 view .LVU712
+.LBB930:
+	.loc 1 166 5 view .LVU713
+	.loc 1 167 5 view .LVU714
+	.loc 1 167 5 is_stmt 0 view .LVU715
+.LBE930:
+.LBE929:
+	.loc 1 210 9 is_stmt 1 view .LVU716
+.LBB932:
+.LBB931:
+	.loc 1 167 26 is_stmt 0 view .LVU717
+	movq	%rbx, %rax
+	shrq	$6, %rax
+	.loc 1 167 45 view .LVU718
+	andl	$63, %eax
+.LVL260:
+	.loc 1 167 45 view .LVU719
+.LBE931:
+.LBE932:
+	.loc 1 210 13 view .LVU720
+	pushq	%rax
+	.cfi_def_cfa_offset 312
+	pushq	%r12
+	.cfi_def_cfa_offset 320
+	pushq	%r14
+	.cfi_def_cfa_offset 328
+	pushq	%r13
+	.cfi_def_cfa_offset 336
+	pushq	%r15
+	.cfi_def_cfa_offset 344
+	movq	136(%rsp), %r9
+	movq	128(%rsp), %r8
+	movq	104(%rsp), %rcx
+	movq	96(%rsp), %rdx
+	movq	268(%rsp), %rdi
+	movl	276(%rsp), %esi
+	call	tile_lines_in_set
+.LVL261:
+	.loc 1 210 13 view .LVU721
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 304
+	.loc 1 210 12 view .LVU722
+	cmpq	$8, %rax
+	jbe	.L366
+.LVL262:
+.L359:
+	.loc 1 210 12 view .LVU723
+.LBE928:
+.LBE927:
+.LBE926:
+.LBB943:
+.LBB916:
+.LBB883:
+.LBB878:
+	.loc 1 238 14 view .LVU724
+	xorl	%eax, %eax
+.LBB871:
+	.loc 1 240 60 view .LVU725
+	cmpq	$0, 8(%rsp)
+	movq	%r12, %rbp
+	movq	%r14, %rbx
+	movq	104(%rsp), %r12
+.LVL263:
+	.loc 1 240 60 is_stmt 1 view .LVU726
+	movq	72(%rsp), %r14
+.LVL264:
+	.loc 1 240 60 is_stmt 0 view .LVU727
+	je	.L308
+.LBB864:
+.LBB852:
+.LBB842:
+.LBB818:
+	.loc 1 193 18 view .LVU728
+	movq	%rbp, %rax
+	movq	16(%rsp), %rdi
+.LBE818:
+.LBE842:
+.LBE852:
+.LBE864:
+	.loc 1 240 17 view .LVU729
+	movq	8(%rsp), %r11
+.LBE871:
+	.loc 1 239 12 view .LVU730
+	xorl	%edx, %edx
+.LBB872:
+.LBB865:
+.LBB853:
+.LBB843:
+.LBB827:
+	.loc 1 193 18 view .LVU731
+	subq	%rbx, %rax
+.LBE827:
+.LBE843:
+.LBE853:
+.LBE865:
+	.loc 1 240 17 view .LVU732
+	xorl	%esi, %esi
+	movq	%r12, %r8
+.LBB866:
+.LBB854:
+.LBB844:
+.LBB828:
+.LBB819:
+.LBB820:
+	.loc 1 174 40 view .LVU733
+	leaq	-8(,%rax,8), %rax
+	movq	%rax, 104(%rsp)
+.LBE820:
+.LBE819:
+.LBE828:
+.LBE844:
+.LBE854:
+.LBE866:
+.LBE872:
+	.loc 1 238 14 view .LVU734
+	xorl	%eax, %eax
+.LVL265:
+	.p2align 4,,10
+	.p2align 3
+.L307:
+.LBB873:
+.LBB867:
+	.loc 1 242 9 is_stmt 1 view .LVU735
+.LBB855:
+.LBI855:
+	.loc 1 165 15 view .LVU736
+.LBB856:
+	.loc 1 166 5 view .LVU737
+	.loc 1 167 5 view .LVU738
+	.loc 1 167 26 is_stmt 0 view .LVU739
+	movq	%rdi, %rcx
+	shrq	$6, %rcx
+	.loc 1 167 45 view .LVU740
+	andl	$63, %ecx
+.LVL266:
+	.loc 1 167 45 view .LVU741
+.LBE856:
+.LBE855:
+	.loc 1 243 9 is_stmt 1 view .LVU742
+.LBB857:
+.LBI792:
+	.loc 1 188 15 view .LVU743
+.LBB845:
+.LBB829:
+	.loc 1 192 27 view .LVU744
+	cmpq	%r13, %r15
+	jnb	.L292
+	movq	%r15, 72(%rsp)
+	movq	32(%rsp), %r12
+.LBE829:
+	.loc 1 191 12 is_stmt 0 view .LVU745
+	xorl	%r9d, %r9d
+	movq	%rax, 208(%rsp)
+	movq	%r14, 168(%rsp)
+	movq	%rbp, %r14
+.LVL267:
+	.p2align 4,,10
+	.p2align 3
+.L296:
+.LBB830:
+	.loc 1 193 9 is_stmt 1 view .LVU746
+.LBB825:
+.LBI819:
+	.loc 1 171 15 view .LVU747
+.LBB823:
+	.loc 1 173 5 view .LVU748
+	.loc 1 174 15 is_stmt 0 view .LVU749
+	movq	104(%rsp), %rax
+	.loc 1 173 15 view .LVU750
+	movq	%r12, %r10
+	shrq	$6, %r10
+.LVL268:
+	.loc 1 174 5 is_stmt 1 view .LVU751
+	.loc 1 174 15 is_stmt 0 view .LVU752
+	leaq	(%r12,%rax), %rbp
+	movq	%rbp, %rax
+	shrq	$6, %rax
+.LVL269:
+	.loc 1 175 5 is_stmt 1 view .LVU753
+	.loc 1 176 5 view .LVU754
+.LBB821:
+	.loc 1 176 10 view .LVU755
+	.loc 1 176 39 view .LVU756
+	cmpq	%r10, %rax
+	jb	.L293
+	movq	%r13, 216(%rsp)
+.LBE821:
+	.loc 1 175 12 is_stmt 0 view .LVU757
+	xorl	%ebp, %ebp
+	jmp	.L295
+.LVL270:
+	.p2align 4,,10
+	.p2align 3
+.L326:
+.LBB822:
+	.loc 1 176 52 view .LVU758
+	movq	%r13, %r10
+.LVL271:
+.L295:
+	.loc 1 177 9 is_stmt 1 view .LVU759
+	.loc 1 177 19 is_stmt 0 view .LVU760
+	movq	%r10, %r13
+	andl	$63, %r13d
+	.loc 1 178 18 view .LVU761
+	cmpq	%r13, %rcx
+	sete	%r13b
+	movzbl	%r13b, %r13d
+	addq	%r13, %rbp
+.LVL272:
+	.loc 1 176 52 is_stmt 1 view .LVU762
+	leaq	1(%r10), %r13
+.LVL273:
+	.loc 1 176 39 view .LVU763
+	cmpq	%r10, %rax
+	jne	.L326
+.LBE822:
+.LBE823:
+.LBE825:
+	.loc 1 193 15 is_stmt 0 view .LVU764
+	movq	216(%rsp), %r13
+.LVL274:
+	.loc 1 193 15 view .LVU765
+	addq	%rbp, %r9
+.LVL275:
+.L293:
+.LBB826:
+.LBB824:
+	.loc 1 181 5 is_stmt 1 view .LVU766
+	.loc 1 181 5 is_stmt 0 view .LVU767
+.LBE824:
+.LBE826:
+	.loc 1 192 34 is_stmt 1 view .LVU768
+	addq	$1, 72(%rsp)
+.LVL276:
+	.loc 1 192 27 is_stmt 0 view .LVU769
+	movq	48(%rsp), %r10
+	.loc 1 192 34 view .LVU770
+	movq	72(%rsp), %rax
+.LVL277:
+	.loc 1 192 27 is_stmt 1 view .LVU771
+	addq	%r10, %r12
+	cmpq	%rax, %r13
+	jne	.L296
+	movq	%r14, %rbp
+	movq	208(%rsp), %rax
+.LVL278:
+	.loc 1 192 27 is_stmt 0 view .LVU772
+.LBE830:
+.LBB831:
+	.loc 1 195 27 is_stmt 1 view .LVU773
+.LBE831:
+.LBB832:
+	movq	168(%rsp), %r14
+.LVL279:
+	.loc 1 195 27 is_stmt 0 view .LVU774
+.LBE832:
+.LBB833:
+	cmpq	%rbp, %rbx
+	jnb	.L300
+.LVL280:
+.L298:
+	.loc 1 195 27 view .LVU775
+.LBE833:
+	.loc 1 191 12 view .LVU776
+	movq	%rbx, 72(%rsp)
+	movq	40(%rsp), %r12
+	movq	%r13, 168(%rsp)
+	movq	%rax, 208(%rsp)
+.LVL281:
+	.p2align 4,,10
+	.p2align 3
+.L304:
+.LBB834:
+	.loc 1 196 9 is_stmt 1 view .LVU777
+.LBB811:
+.LBI795:
+	.loc 1 171 15 view .LVU778
+.LBB804:
+	.loc 1 173 5 view .LVU779
+	.loc 1 174 15 is_stmt 0 view .LVU780
+	movq	136(%rsp), %rax
+	.loc 1 173 15 view .LVU781
+	movq	%r12, %r10
+	shrq	$6, %r10
+.LVL282:
+	.loc 1 174 5 is_stmt 1 view .LVU782
+	.loc 1 174 15 is_stmt 0 view .LVU783
+	leaq	(%r12,%rax), %r13
+	movq	%r13, %rax
+	shrq	$6, %rax
+.LVL283:
+	.loc 1 175 5 is_stmt 1 view .LVU784
+	.loc 1 176 5 view .LVU785
+.LBB797:
+	.loc 1 176 10 view .LVU786
+	.loc 1 176 39 view .LVU787
+	cmpq	%r10, %rax
+	jb	.L301
+	movq	%r14, 216(%rsp)
+.LBE797:
+	.loc 1 175 12 is_stmt 0 view .LVU788
+	xorl	%r13d, %r13d
+	jmp	.L303
+.LVL284:
+	.p2align 4,,10
+	.p2align 3
+.L328:
+.LBB798:
+	.loc 1 176 52 view .LVU789
+	movq	%r14, %r10
+.LVL285:
+.L303:
+	.loc 1 177 9 is_stmt 1 view .LVU790
+	.loc 1 177 19 is_stmt 0 view .LVU791
+	movq	%r10, %r14
+	andl	$63, %r14d
+	.loc 1 178 18 view .LVU792
+	cmpq	%r14, %rcx
+	sete	%r14b
+	movzbl	%r14b, %r14d
+	addq	%r14, %r13
+.LVL286:
+	.loc 1 176 52 is_stmt 1 view .LVU793
+	leaq	1(%r10), %r14
+.LVL287:
+	.loc 1 176 39 view .LVU794
+	cmpq	%r10, %rax
+	jne	.L328
+.LBE798:
+.LBE804:
+.LBE811:
+	.loc 1 196 15 is_stmt 0 view .LVU795
+	movq	216(%rsp), %r14
+.LVL288:
+	.loc 1 196 15 view .LVU796
+	addq	%r13, %r9
+.LVL289:
+.L301:
+.LBB812:
+.LBB805:
+	.loc 1 181 5 is_stmt 1 view .LVU797
+	.loc 1 181 5 is_stmt 0 view .LVU798
+.LBE805:
+.LBE812:
+	.loc 1 195 34 is_stmt 1 view .LVU799
+	addq	$1, 72(%rsp)
+.LVL290:
+	.loc 1 195 27 is_stmt 0 view .LVU800
+	movq	24(%rsp), %r10
+	.loc 1 195 34 view .LVU801
+	movq	72(%rsp), %rax
+.LVL291:
+	.loc 1 195 27 is_stmt 1 view .LVU802
+	addq	%r10, %r12
+	cmpq	%rbp, %rax
+	jb	.L304
+	movq	168(%rsp), %r13
+	movq	208(%rsp), %rax
+.LVL292:
+.L300:
+	.loc 1 195 27 is_stmt 0 view .LVU803
+.LBE834:
+	.loc 1 198 5 is_stmt 1 view .LVU804
+	.loc 1 198 5 is_stmt 0 view .LVU805
+.LBE845:
+.LBE857:
+	.loc 1 243 12 view .LVU806
+	testq	%r9, %r9
+	jne	.L305
+.L299:
+	.loc 1 244 13 is_stmt 1 view .LVU807
+.LVL293:
+	.loc 1 244 37 is_stmt 0 view .LVU808
+	leal	0(,%rdx,8), %ecx
+.LVL294:
+	.loc 1 244 37 view .LVU809
+	movq	%rsi, %r9
+	.loc 1 244 49 view .LVU810
+	addq	$1, %rdx
+.LVL295:
+	.loc 1 244 37 view .LVU811
+	salq	%cl, %r9
+	.loc 1 244 19 view .LVU812
+	orq	%r9, %rax
+.LVL296:
+.L305:
+	.loc 1 244 19 view .LVU813
+.LBE867:
+	.loc 1 241 14 is_stmt 1 view .LVU814
+	addq	$1, %rsi
+.LVL297:
+	.loc 1 240 60 view .LVU815
+	cmpq	$32, %rsi
+	je	.L306
+	.loc 1 240 60 is_stmt 0 view .LVU816
+	addq	$64, %rdi
+.LVL298:
+	.loc 1 240 60 view .LVU817
+	cmpq	%r11, %rdx
+	jb	.L307
+	movq	%r8, %r12
+.LVL299:
+.L308:
+	.loc 1 240 60 view .LVU818
+.LBE873:
+	.loc 1 254 5 is_stmt 1 view .LVU819
+	.loc 1 254 5 is_stmt 0 view .LVU820
+.LBE878:
+.LBE883:
+	.loc 1 274 5 is_stmt 1 view .LVU821
+.LBB884:
+	.loc 1 274 10 view .LVU822
+	.loc 1 274 27 view .LVU823
+	cmpq	%r13, %r15
+	jnb	.L283
+	cmpq	%rbp, %rbx
+	jnb	.L283
+	movq	%rbp, %rdx
+	movq	32(%rsp), %rdi
+	xorl	%r8d, %r8d
+	subq	%rbx, %rdx
+	movq	%rdx, %rcx
+	leaq	-1(%rdx), %rsi
+	movq	%rdx, %r10
+	andl	$1, %edx
+	shrq	%rcx
+	movq	%rsi, 104(%rsp)
+	andq	$-2, %r10
+	salq	$4, %rcx
+	movq	%rdx, 168(%rsp)
+	leaq	(%r10,%rbx), %r11
+	movq	%rcx, 72(%rsp)
+.LVL300:
+.L315:
+.LBB885:
+	.loc 1 275 9 view .LVU824
+.LBB886:
+.LBI886:
+	.loc 1 258 15 view .LVU825
+.LBB887:
+	.loc 1 259 5 view .LVU826
+	.loc 1 259 20 is_stmt 0 view .LVU827
+	leal	0(,%r8,8), %ecx
+	movq	%rax, %rdx
+.LBE887:
+.LBE886:
+.LBB891:
+	.loc 1 277 13 view .LVU828
+	movq	%rdi, %r9
+.LBE891:
+.LBB892:
+.LBB888:
+	.loc 1 259 20 view .LVU829
+	shrq	%cl, %rdx
+.LBE888:
+.LBE892:
+.LBB893:
+	.loc 1 277 13 view .LVU830
+	movq	112(%rsp), %rcx
+.LBE893:
+.LBB894:
+.LBB889:
+	.loc 1 259 32 view .LVU831
+	movzbl	%dl, %edx
+.LBE889:
+.LBE894:
+.LBB895:
+	.loc 1 277 13 view .LVU832
+	subq	%rcx, %r9
+	cmpq	$2, 104(%rsp)
+.LBE895:
+.LBB896:
+.LBB890:
+	.loc 1 259 40 view .LVU833
+	leaq	0(,%rdx,8), %rsi
+.LVL301:
+	.loc 1 259 40 view .LVU834
+.LBE890:
+.LBE896:
+	.loc 1 276 9 is_stmt 1 view .LVU835
+.LBB897:
+	.loc 1 276 14 view .LVU836
+	.loc 1 276 31 view .LVU837
+	jbe	.L310
+	movq	16(%rsp), %rcx
+	salq	$6, %rdx
+	addq	%rdx, %rcx
+	leaq	8(%rdi), %rdx
+	cmpq	%rdx, %rcx
+	jne	.L367
+.L310:
+	movq	16(%rsp), %rdx
+	subq	%rbx, %rsi
+.LVL302:
+	.loc 1 276 31 is_stmt 0 view .LVU838
+	leaq	(%rdx,%rsi,8), %rcx
+	.loc 1 277 13 view .LVU839
+	movq	%rbx, %rdx
+.LVL303:
+	.p2align 4,,10
+	.p2align 3
+.L318:
+	.loc 1 277 13 is_stmt 1 view .LVU840
+	movsd	(%r9,%rdx,8), %xmm0
+	movsd	%xmm0, (%rcx,%rdx,8)
+	.loc 1 276 38 view .LVU841
+	addq	$1, %rdx
+.LVL304:
+	.loc 1 276 31 view .LVU842
+	cmpq	%rdx, %rbp
+	jne	.L318
+.LVL305:
+	.p2align 4,,10
+	.p2align 3
+.L319:
+	.loc 1 276 31 is_stmt 0 view .LVU843
+.LBE897:
+.LBE885:
+	.loc 1 274 34 is_stmt 1 view .LVU844
+	.loc 1 274 27 view .LVU845
+	movq	48(%rsp), %rdx
+	addq	$1, %r8
+.LVL306:
+	.loc 1 274 27 is_stmt 0 view .LVU846
+	addq	%rdx, %rdi
+	cmpq	%r8, 8(%rsp)
+	jne	.L315
+.LVL307:
+	.loc 1 274 27 view .LVU847
+.LBE884:
+.LBB902:
+	.loc 1 280 27 is_stmt 1 view .LVU848
+	.loc 1 280 27 is_stmt 0 view .LVU849
+.LBE902:
+.LBB907:
+	.loc 1 274 27 view .LVU850
+	movq	80(%rsp), %rdi
+	movq	16(%rsp), %r8
+.LVL308:
+	.loc 1 274 27 view .LVU851
+	subq	%rbx, %rbp
+.LVL309:
+	.loc 1 274 27 view .LVU852
+	xorl	%esi, %esi
+.LVL310:
+.L312:
+	.loc 1 274 27 view .LVU853
+.LBE907:
+.LBB908:
+.LBB903:
+	.loc 1 281 31 is_stmt 1 view .LVU854
+.LBE903:
+.LBE908:
+.LBB909:
+.LBB900:
+.LBB898:
+	.loc 1 277 13 is_stmt 0 view .LVU855
+	xorl	%edx, %edx
+.LVL311:
+	.p2align 4,,10
+	.p2align 3
+.L320:
+	.loc 1 277 13 view .LVU856
+.LBE898:
+.LBE900:
+.LBE909:
+.LBB910:
+.LBB906:
+	.loc 1 282 13 is_stmt 1 view .LVU857
+.LBB904:
+.LBI904:
+	.loc 1 258 15 view .LVU858
+.LBB905:
+	.loc 1 259 5 view .LVU859
+	.loc 1 259 20 is_stmt 0 view .LVU860
+	leal	0(,%rdx,8), %ecx
+	movq	%rax, %rbx
+	shrq	%cl, %rbx
+	.loc 1 259 32 view .LVU861
+	movzbl	%bl, %ecx
+.LBE905:
+.LBE904:
+	.loc 1 282 13 view .LVU862
+	leaq	(%rsi,%rcx,8), %rcx
+	movsd	(%r8,%rcx,8), %xmm0
+	movsd	%xmm0, (%rdi,%rdx,8)
+	.loc 1 281 38 is_stmt 1 view .LVU863
+.LVL312:
+	.loc 1 281 31 view .LVU864
+	addq	$1, %rdx
+.LVL313:
+	.loc 1 281 31 is_stmt 0 view .LVU865
+	cmpq	%rdx, 8(%rsp)
+	jne	.L320
+.LBE906:
+	.loc 1 280 34 is_stmt 1 view .LVU866
+	.loc 1 280 27 view .LVU867
+	movq	24(%rsp), %rbx
+	addq	$1, %rsi
+	.loc 1 280 27 is_stmt 0 view .LVU868
+	addq	%rbx, %rdi
+	cmpq	%rsi, %rbp
+	jne	.L312
+.LVL314:
+.L283:
+	.loc 1 280 27 view .LVU869
+.LBE910:
+.LBE916:
+.LBE943:
+.LBE954:
+	.loc 1 300 32 is_stmt 1 view .LVU870
+	movq	56(%rsp), %rax
+	movq	160(%rsp), %rsi
+	addq	$64, 32(%rsp)
+	addq	%rsi, 80(%rsp)
+	addq	%rsi, 40(%rsp)
+	addq	$64, 112(%rsp)
+	cmpq	%rax, %r14
+	jb	.L276
+.LBE959:
+.LBE777:
+	.loc 1 298 28 is_stmt 0 view .LVU871
+	movq	184(%rsp), %rbp
+	movq	192(%rsp), %rax
+	movq	176(%rsp), %rbx
+	movq	64(%rsp), %rdi
+	movq	200(%rsp), %r13
+.LVL315:
+	.loc 1 298 28 is_stmt 1 view .LVU872
+	addq	%r12, 128(%rsp)
+	addq	%rax, %rbp
+	addq	%r13, 120(%rsp)
+	cmpq	%rdi, %rbx
+	jb	.L321
+.LVL316:
+.L273:
+	.loc 1 298 28 is_stmt 0 view .LVU873
+.LBE962:
+.LBE964:
+	.loc 1 433 1 view .LVU874
+	addq	$248, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL317:
+.L292:
+	.cfi_restore_state
+.LBB965:
+.LBB963:
+.LBB961:
+.LBB960:
+.LBB955:
+.LBB944:
+.LBB917:
+.LBB911:
+.LBB879:
+.LBB874:
+.LBB868:
+.LBB858:
+.LBB846:
+.LBB835:
+	.loc 1 195 27 is_stmt 1 view .LVU875
+.LBE835:
+	.loc 1 191 12 is_stmt 0 view .LVU876
+	xorl	%r9d, %r9d
+.LBB836:
+	.loc 1 195 27 view .LVU877
+	cmpq	%rbp, %rbx
+	jb	.L298
+	jmp	.L299
+.LVL318:
+.L365:
+	.loc 1 195 27 view .LVU878
+.LBE836:
+.LBE846:
+.LBE858:
+.LBE868:
+.LBE874:
+.LBE879:
+.LBE911:
+.LBE917:
+.LBE944:
+.LBB945:
+.LBB933:
+	movq	%r12, %rbp
+.LVL319:
+	.loc 1 195 27 view .LVU879
+	movq	%r14, %rbx
+	movq	104(%rsp), %r12
+.LVL320:
+	.loc 1 195 27 view .LVU880
+.LBE933:
+.LBB934:
+	.loc 1 215 27 is_stmt 1 view .LVU881
+.LBE934:
+.LBB940:
+	movq	72(%rsp), %r14
+.LVL321:
+	.loc 1 215 27 is_stmt 0 view .LVU882
+.LBE940:
+.LBB941:
+	cmpq	%rbp, %rbx
+	jnb	.L284
+	.loc 1 215 27 view .LVU883
+	movq	40(%rsp), %r11
+	movq	%rbx, %r10
+	movq	%rbx, %r14
+	movq	%rbp, %r12
+	movq	%r10, %rbp
+.LVL322:
+	.loc 1 215 27 view .LVU884
+	movq	%r11, %rbx
+.LVL323:
+	.loc 1 215 27 view .LVU885
+	jmp	.L285
+.LVL324:
+.L369:
+	.loc 1 215 34 is_stmt 1 view .LVU886
+	.loc 1 215 27 is_stmt 0 view .LVU887
+	movq	24(%rsp), %rax
+	.loc 1 215 34 view .LVU888
+	addq	$1, %rbp
+.LVL325:
+	.loc 1 215 27 is_stmt 1 view .LVU889
+	addq	%rax, %rbx
+.LVL326:
+	.loc 1 215 27 is_stmt 0 view .LVU890
+	cmpq	%rbp, %r12
+	je	.L368
+.LVL327:
+.L285:
+.LBB935:
+	.loc 1 216 9 is_stmt 1 view .LVU891
+.LBB936:
+.LBI936:
+	.loc 1 165 15 view .LVU892
+.LBB937:
+	.loc 1 166 5 view .LVU893
+	.loc 1 167 5 view .LVU894
+	.loc 1 167 5 is_stmt 0 view .LVU895
+.LBE937:
+.LBE936:
+	.loc 1 217 9 is_stmt 1 view .LVU896
+.LBB939:
+.LBB938:
+	.loc 1 167 26 is_stmt 0 view .LVU897
+	movq	%rbx, %rax
+	shrq	$6, %rax
+	.loc 1 167 45 view .LVU898
+	andl	$63, %eax
+.LVL328:
+	.loc 1 167 45 view .LVU899
+.LBE938:
+.LBE939:
+	.loc 1 217 13 view .LVU900
+	pushq	%rax
+	.cfi_def_cfa_offset 312
+	pushq	%r12
+	.cfi_def_cfa_offset 320
+	pushq	%r14
+	.cfi_def_cfa_offset 328
+	pushq	%r13
+	.cfi_def_cfa_offset 336
+	pushq	%r15
+	.cfi_def_cfa_offset 344
+	movq	136(%rsp), %r9
+	movq	128(%rsp), %r8
+	movq	104(%rsp), %rcx
+	movq	96(%rsp), %rdx
+	movq	268(%rsp), %rdi
+	movl	276(%rsp), %esi
+	call	tile_lines_in_set
+.LVL329:
+	.loc 1 217 13 view .LVU901
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 304
+	.loc 1 217 12 view .LVU902
+	cmpq	$8, %rax
+	jbe	.L369
+	jmp	.L359
+.LVL330:
+.L306:
+	.loc 1 217 12 view .LVU903
+.LBE935:
+.LBE941:
+.LBE945:
+.LBB946:
+.LBB918:
+.LBB912:
+.LBB880:
+	.loc 1 247 8 view .LVU904
+	movq	8(%rsp), %rcx
+	movq	%r8, %r12
+	.loc 1 247 5 is_stmt 1 view .LVU905
+	.loc 1 247 8 is_stmt 0 view .LVU906
+	cmpq	%rcx, %rdx
+	jnb	.L308
+	.loc 1 249 15 view .LVU907
+	xorl	%eax, %eax
+.LVL331:
+.LBB875:
+	.loc 1 250 21 view .LVU908
+	xorl	%edx, %edx
+.LVL332:
+.L309:
+	.loc 1 251 13 is_stmt 1 view .LVU909
+	.loc 1 251 34 is_stmt 0 view .LVU910
+	leal	0(,%rdx,8), %ecx
+	movq	%rdx, %rdi
+	.loc 1 250 42 view .LVU911
+	addq	$1, %rdx
+.LVL333:
+	.loc 1 251 34 view .LVU912
+	salq	%cl, %rdi
+.LVL334:
+	.loc 1 251 19 view .LVU913
+	orq	%rdi, %rax
+.LVL335:
+	.loc 1 250 42 is_stmt 1 view .LVU914
+	.loc 1 250 30 view .LVU915
+	cmpq	%rdx, 8(%rsp)
+	jne	.L309
+	jmp	.L308
+.LVL336:
+.L368:
+	.loc 1 250 30 is_stmt 0 view .LVU916
+	movq	%r12, %rbp
+.LVL337:
+	.loc 1 250 30 view .LVU917
+	movq	%r14, %rbx
+	movq	104(%rsp), %r12
+.LVL338:
+	.loc 1 250 30 view .LVU918
+	movq	72(%rsp), %r14
+.LVL339:
+.L284:
+	.loc 1 250 30 view .LVU919
+.LBE875:
+.LBE880:
+.LBE912:
+.LBE918:
+.LBE946:
+.LBB947:
+.LBB948:
+	.loc 1 126 27 is_stmt 1 view .LVU920
+	cmpq	%r13, %r15
+	jnb	.L283
+	movq	80(%rsp), %r10
+	movq	32(%rsp), %r11
+	movq	%r15, %rsi
+	movq	128(%rsp), %r8
+	movq	120(%rsp), %rdi
+.LVL340:
+.L286:
+.LBB949:
+	.loc 1 127 31 view .LVU921
+	leaq	1(%rsi), %r9
+	cmpq	%rbp, %rbx
+	jnb	.L289
+	.loc 1 127 31 is_stmt 0 view .LVU922
+	movq	%rdi, 72(%rsp)
+	movq	%r10, %rcx
+	movq	%r11, %rdx
+	movq	%rbx, %rax
+	leaq	1(%rsi), %r9
+.LVL341:
+	.p2align 4,,10
+	.p2align 3
+.L290:
+	.loc 1 128 13 is_stmt 1 view .LVU923
+	.loc 1 128 16 is_stmt 0 view .LVU924
+	cmpq	%rax, %rsi
+	je	.L287
+	.loc 1 129 17 is_stmt 1 view .LVU925
+	movsd	(%rdx), %xmm0
+	.loc 1 127 31 is_stmt 0 view .LVU926
+	movq	24(%rsp), %rdi
+	.loc 1 127 38 view .LVU927
+	addq	$1, %rax
+.LVL342:
+	.loc 1 127 31 view .LVU928
+	addq	$8, %rdx
+	.loc 1 129 17 view .LVU929
+	movsd	%xmm0, (%rcx)
+	.loc 1 127 38 is_stmt 1 view .LVU930
+.LVL343:
+	.loc 1 127 31 view .LVU931
+	addq	%rdi, %rcx
+	cmpq	%rax, %rbp
+	jne	.L290
+.L364:
+	.loc 1 127 31 is_stmt 0 view .LVU932
+	movq	72(%rsp), %rdi
+.LVL344:
+.L289:
+	.loc 1 127 31 view .LVU933
+.LBE949:
+	.loc 1 132 9 is_stmt 1 view .LVU934
+	.loc 1 132 12 is_stmt 0 view .LVU935
+	cmpq	%rbx, %rsi
+	jb	.L291
+	cmpq	%rbp, %rsi
+	jnb	.L291
+	.loc 1 133 13 is_stmt 1 view .LVU936
+	movsd	(%rdi), %xmm0
+	movsd	%xmm0, (%r8)
+.L291:
+	.loc 1 126 34 view .LVU937
+	.loc 1 126 27 is_stmt 0 view .LVU938
+	movq	152(%rsp), %rax
+	.loc 1 126 34 view .LVU939
+	movq	%r9, %rsi
+.LVL345:
+	.loc 1 126 27 is_stmt 1 view .LVU940
+	addq	$8, %r10
+	addq	%rax, %rdi
+	movq	144(%rsp), %rax
+	addq	%rax, %r8
+	movq	48(%rsp), %rax
+	addq	%rax, %r11
+	cmpq	%r9, %r13
+	jne	.L286
+	.loc 1 126 27 is_stmt 0 view .LVU941
+	jmp	.L283
+.LVL346:
+.L287:
+.LBB950:
+	.loc 1 127 38 is_stmt 1 view .LVU942
+	.loc 1 127 31 is_stmt 0 view .LVU943
+	movq	24(%rsp), %rdi
+	.loc 1 127 38 view .LVU944
+	movq	%r9, %rax
+.LVL347:
+	.loc 1 127 31 is_stmt 1 view .LVU945
+	addq	$8, %rdx
+	addq	%rdi, %rcx
+	cmpq	%r9, %rbp
+	jne	.L290
+	.loc 1 127 31 is_stmt 0 view .LVU946
+	jmp	.L364
+.LVL348:
+.L367:
+	.loc 1 127 31 view .LVU947
+.LBE950:
+.LBE948:
+.LBE947:
+.LBB951:
+.LBB919:
+.LBB913:
+.LBB901:
+.LBB899:
+	.loc 1 277 13 view .LVU948
+	xorl	%edx, %edx
+.LVL349:
+.L313:
+	.loc 1 277 13 is_stmt 1 view .LVU949
+	movupd	(%rdi,%rdx), %xmm1
+	movups	%xmm1, (%rcx,%rdx)
+	.loc 1 276 38 view .LVU950
+	.loc 1 276 31 view .LVU951
+	addq	$16, %rdx
+	cmpq	%rdx, 72(%rsp)
+	jne	.L313
+	cmpq	$0, 168(%rsp)
+	je	.L319
+.LVL350:
+	.loc 1 277 13 view .LVU952
+	movsd	(%r9,%r11,8), %xmm0
+	movq	16(%rsp), %rcx
+	addq	%r10, %rsi
+.LVL351:
+	.loc 1 277 13 is_stmt 0 view .LVU953
+	movsd	%xmm0, (%rcx,%rsi,8)
+	.loc 1 276 38 is_stmt 1 view .LVU954
+.LVL352:
+	.loc 1 276 31 view .LVU955
+	jmp	.L319
+.LVL353:
+.L278:
+	.loc 1 276 31 is_stmt 0 view .LVU956
+.LBE899:
+.LBE901:
+.LBE913:
+.LBE919:
+.LBE951:
+.LBB952:
+.LBB942:
+	.loc 1 215 27 is_stmt 1 view .LVU957
+	movq	40(%rsp), %r11
+	movq	%rbx, %r10
+	cmpq	%rbp, %rbx
+	jnb	.L283
+	.loc 1 215 27 is_stmt 0 view .LVU958
+	movq	%r14, 72(%rsp)
+	movq	%rbx, %r14
+	movq	%r11, %rbx
+.LVL354:
+	.loc 1 215 27 view .LVU959
+	movq	%r12, 104(%rsp)
+	movq	%rbp, %r12
+	movq	%r10, %rbp
+.LVL355:
+	.loc 1 215 27 view .LVU960
+	jmp	.L285
+.LBE942:
+.LBE952:
+.LBE955:
+.LBE960:
+.LBE961:
+.LBE963:
+.LBE965:
+	.cfi_endproc
+.LFE25:
+	.size	trans_staged_l1, .-trans_staged_l1
+	.p2align 4
+	.type	transpose_recursive, @function
+transpose_recursive:
+.LVL356:
+.LFB19:
+	.loc 1 317 55 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 317 55 is_stmt 0 view .LVU962
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rcx, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%r8, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	movq	96(%rsp), %r12
+	movq	104(%rsp), %rbp
+	movq	%rdi, 8(%rsp)
+.LVL357:
+.L371:
+	.loc 1 318 5 is_stmt 1 view .LVU963
+	.loc 1 318 12 is_stmt 0 view .LVU964
+	movq	%r13, %rcx
+	.loc 1 318 43 view .LVU965
+	movq	%rbp, %rsi
+	.loc 1 318 12 view .LVU966
+	subq	%rbx, %rcx
+	.loc 1 318 43 view .LVU967
+	subq	%r12, %rsi
+	.loc 1 318 8 view .LVU968
+	cmpq	$8, %rcx
+	ja	.L372
+	.loc 1 318 37 view .LVU969
+	cmpq	$8, %rsi
+	jbe	.L391
+.L373:
+.LBB972:
+	.loc 1 325 9 is_stmt 1 view .LVU970
+	.loc 1 325 37 is_stmt 0 view .LVU971
+	shrq	%rsi
+	.loc 1 326 9 view .LVU972
+	movq	%r13, %r9
+	movq	%rbx, %r8
+	movq	%r15, %rcx
+	.loc 1 325 16 view .LVU973
+	leaq	(%rsi,%r12), %r10
+.LVL358:
+	.loc 1 326 9 is_stmt 1 view .LVU974
+	movq	%r14, %rsi
+	pushq	%r10
+	.cfi_def_cfa_offset 104
+	movq	%r10, 32(%rsp)
+	pushq	%r12
+	.cfi_def_cfa_offset 112
+	movq	24(%rsp), %rdi
+	movq	%rdx, 32(%rsp)
+	call	transpose_recursive
+.LVL359:
+	.loc 1 327 9 view .LVU975
+	.loc 1 326 9 is_stmt 0 view .LVU976
+	popq	%rax
+	.cfi_def_cfa_offset 104
+	popq	%rdx
+	.cfi_def_cfa_offset 96
+	.loc 1 327 9 view .LVU977
+	movq	24(%rsp), %r12
+	movq	16(%rsp), %rdx
+	jmp	.L371
+.LVL360:
+	.p2align 4,,10
+	.p2align 3
+.L372:
+	.loc 1 327 9 view .LVU978
+.LBE972:
+	.loc 1 320 12 is_stmt 1 view .LVU979
+	.loc 1 320 15 is_stmt 0 view .LVU980
+	cmpq	%rsi, %rcx
+	jb	.L373
+.LBB973:
+	.loc 1 321 9 is_stmt 1 view .LVU981
+	.loc 1 322 9 is_stmt 0 view .LVU982
+	pushq	%rbp
+	.cfi_def_cfa_offset 104
+	.loc 1 321 37 view .LVU983
+	shrq	%rcx
+	.loc 1 322 9 view .LVU984
+	movq	%rbx, %r8
+	movq	%r14, %rsi
+	pushq	%r12
+	.cfi_def_cfa_offset 112
+	movq	24(%rsp), %rdi
+	.loc 1 321 16 view .LVU985
+	leaq	(%rcx,%rbx), %r9
+.LVL361:
+	.loc 1 322 9 is_stmt 1 view .LVU986
+	movq	%r15, %rcx
+	movq	%rdx, 32(%rsp)
+	movq	%r9, 40(%rsp)
+	call	transpose_recursive
+.LVL362:
+	.loc 1 323 9 view .LVU987
+.LBE973:
+	popq	%rcx
+	.cfi_def_cfa_offset 104
+	popq	%rsi
+	.cfi_def_cfa_offset 96
+.LBB974:
+	movq	24(%rsp), %rbx
+.LBE974:
+	movq	16(%rsp), %rdx
+	jmp	.L371
+.LVL363:
+	.p2align 4,,10
+	.p2align 3
+.L391:
+.LBB975:
+.LBB976:
+	.loc 1 126 27 view .LVU988
+	cmpq	%r13, %rbx
+	jnb	.L370
+	movq	8(%rsp), %rax
+	movq	%rbx, %rdi
+	movq	%rbx, %rcx
+	movq	%rbx, %rsi
+	leaq	8(,%r14,8), %r8
+	leaq	8(,%rax,8), %r9
+	leaq	-8(%r8), %r11
+	imulq	%r9, %rdi
+	leaq	-8(%r9), %r10
+	imulq	%r10, %rcx
+	imulq	%r12, %r14
+.LVL364:
+	.loc 1 126 27 is_stmt 0 view .LVU989
+	imulq	%r8, %rsi
+	addq	%rdx, %rdi
+	addq	%rdx, %rcx
+	leaq	(%r14,%rbx), %rdx
+	addq	%r15, %rsi
+	leaq	(%r15,%rdx,8), %r15
+.LVL365:
+	.p2align 4,,10
+	.p2align 3
+.L375:
+.LBB977:
+	.loc 1 127 31 is_stmt 1 view .LVU990
+	.loc 1 129 17 is_stmt 0 view .LVU991
+	movq	%r15, %rdx
+	movq	%r12, %rax
+	leaq	1(%rbx), %r14
+	.loc 1 127 31 view .LVU992
+	cmpq	%rbp, %r12
+	jnb	.L378
+.LVL366:
+	.p2align 4,,10
+	.p2align 3
+.L379:
+	.loc 1 128 13 is_stmt 1 view .LVU993
+	.loc 1 128 16 is_stmt 0 view .LVU994
+	cmpq	%rax, %rbx
+	je	.L376
+	.loc 1 129 17 is_stmt 1 view .LVU995
+	movsd	(%rcx,%rax,8), %xmm0
+	.loc 1 127 38 is_stmt 0 view .LVU996
+	addq	$1, %rax
+.LVL367:
+	.loc 1 129 17 view .LVU997
+	movsd	%xmm0, (%rdx)
+	.loc 1 127 38 is_stmt 1 view .LVU998
+.LVL368:
+	.loc 1 127 31 view .LVU999
+	addq	%r11, %rdx
+	cmpq	%rax, %rbp
+	jne	.L379
+.L378:
+	.loc 1 127 31 is_stmt 0 view .LVU1000
+.LBE977:
+	.loc 1 132 9 is_stmt 1 view .LVU1001
+	.loc 1 132 12 is_stmt 0 view .LVU1002
+	cmpq	%r12, %rbx
+	jb	.L380
+	cmpq	%rbp, %rbx
+	jnb	.L380
+	.loc 1 133 13 is_stmt 1 view .LVU1003
+	movsd	(%rdi), %xmm0
+	movsd	%xmm0, (%rsi)
+.L380:
+	.loc 1 126 34 view .LVU1004
+	movq	%r14, %rbx
+.LVL369:
+	.loc 1 126 27 view .LVU1005
+	addq	%r9, %rdi
+	addq	%r8, %rsi
+	addq	%r10, %rcx
+	addq	$8, %r15
+	cmpq	%r14, %r13
+	jne	.L375
+.LVL370:
+.L370:
+	.loc 1 126 27 is_stmt 0 view .LVU1006
+.LBE976:
+.LBE975:
+	.loc 1 329 1 view .LVU1007
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL371:
+	.loc 1 329 1 view .LVU1008
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL372:
+	.loc 1 329 1 view .LVU1009
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL373:
+	.p2align 4,,10
+	.p2align 3
+.L376:
+	.cfi_restore_state
+.LBB980:
+.LBB979:
+.LBB978:
+	.loc 1 127 38 is_stmt 1 view .LVU1010
+	movq	%r14, %rax
+.LVL374:
+	.loc 1 127 31 view .LVU1011
+	addq	%r11, %rdx
+	cmpq	%r14, %rbp
+	jne	.L379
+	.loc 1 127 31 is_stmt 0 view .LVU1012
+	jmp	.L378
+.LBE978:
+.LBE979:
+.LBE980:
+	.cfi_endproc
+.LFE19:
+	.size	transpose_recursive, .-transpose_recursive
+	.p2align 4
+	.type	trans_oblivious, @function
+trans_oblivious:
+.LVL375:
+.LFB23:
+	.loc 1 397 51 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 398 5 view .LVU1014
+	.loc 1 399 5 view .LVU1015
+	.loc 1 401 5 view .LVU1016
+	.loc 1 397 51 is_stmt 0 view .LVU1017
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 401 5 view .LVU1018
+	movq	%rsi, %r9
+	xorl	%r8d, %r8d
+.LVL376:
+	.loc 1 401 5 view .LVU1019
+	pushq	%rdi
+	.cfi_def_cfa_offset 24
+	pushq	$0
+	.cfi_def_cfa_offset 32
+	call	transpose_recursive
+.LVL377:
+	.loc 1 403 5 is_stmt 1 view .LVU1020
+	.loc 1 404 1 is_stmt 0 view .LVU1021
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	trans_oblivious, .-trans_oblivious
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Transpose submission"
+.LC1:
+	.string	"Basic transpose"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"Transpose using the temporary array"
+	.align 8
+.LC3:
+	.string	"Blocked with diagonal handling"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"Cache-oblivious recursive"
+.LC5:
+	.string	"Every tile staged through tmp"
+.LC6:
+	.string	"Conflicting tiles staged (L1)"
+.LC7:
+	.string	"Rectangular tiles"
+	.text
+	.p2align 4
+	.globl	registerFunctions
+	.type	registerFunctions, @function
+registerFunctions:
+.LFB28:
+	.loc 1 480 30 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 482 5 view .LVU1023
+	.loc 1 480 30 is_stmt 0 view .LVU1024
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 482 5 view .LVU1025
+	leaq	.LC0(%rip), %rsi
+	leaq	transpose_submit(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL378:
+	.loc 1 485 5 is_stmt 1 view .LVU1026
+	leaq	.LC1(%rip), %rsi
+	leaq	trans_basic(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL379:
+	.loc 1 486 5 view .LVU1027
+	leaq	.LC2(%rip), %rsi
+	leaq	trans_tmp(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL380:
+	.loc 1 487 5 view .LVU1028
+	leaq	.LC3(%rip), %rsi
+	leaq	trans_blocked(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL381:
+	.loc 1 488 5 view .LVU1029
+	leaq	.LC4(%rip), %rsi
+	leaq	trans_oblivious(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL382:
+	.loc 1 489 5 view .LVU1030
+	leaq	.LC5(%rip), %rsi
+	leaq	trans_staged(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL383:
+	.loc 1 490 5 view .LVU1031
+	leaq	.LC6(%rip), %rsi
+	leaq	trans_staged_l1(%rip), %rdi
+	call	registerTransFunction@PLT
+.LVL384:
+	.loc 1 491 5 view .LVU1032
+	leaq	.LC7(%rip), %rsi
+	leaq	trans_rect(%rip), %rdi
+	.loc 1 492 1 is_stmt 0 view .LVU1033
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 491 5 view .LVU1034
+	jmp	registerTransFunction@PLT
+.LVL385:
+	.cfi_endproc
+.LFE28:
+	.size	registerFunctions, .-registerFunctions
+	.section	.rodata
+	.align 8
+	.type	haswell_l1, @object
+	.size	haswell_l1, 12
+haswell_l1:
+	.long	6
+	.long	8
+	.long	6
+	.align 8
+	.type	test_cache, @object
+	.size	test_cache, 12
+test_cache:
+	.long	5
+	.long	1
+	.long	6
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "cachelab.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3452
+	.value	0x4
+	.long	.Ldebug_abbrev0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0xc
+	.long	.LASF54
+	.long	.LASF55
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF0
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x3
+	.long	0x42
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF5
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF6
+	.uleb128 0x5
+	.long	.LASF8
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x42
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF7
+	.uleb128 0x3
+	.long	0x76
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x6a
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x42
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x17
+	.long	0x42
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x3
+	.long	0xad
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xad
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x7d
+	.uleb128 0x7
+	.byte	0xc
+	.byte	0x1
+	.byte	0x54
+	.byte	0x9
+	.long	0xf6
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x1
+	.byte	0x55
+	.byte	0xe
+	.long	0x3b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF15
+	.byte	0x1
+	.byte	0x56
+	.byte	0xe
+	.long	0x3b
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF16
+	.byte	0x1
+	.byte	0x57
+	.byte	0xe
+	.long	0x3b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x1
+	.byte	0x58
+	.byte	0x3
+	.long	0xc5
+	.uleb128 0x3
+	.long	0xf6
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x102
+	.uleb128 0x9
+	.byte	0x3
+	.quad	test_cache
+	.uleb128 0x9
+	.long	.LASF19
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x1b
+	.long	0x102
+	.uleb128 0x9
+	.byte	0x3
+	.quad	haswell_l1
+	.uleb128 0xa
+	.long	.LASF56
+	.byte	0x6
+	.byte	0x71
+	.byte	0x6
+	.long	0x14a
+	.uleb128 0xb
+	.long	0x14a
+	.uleb128 0xb
+	.long	0xbf
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x150
+	.uleb128 0xc
+	.long	0x16f
+	.uleb128 0xb
+	.long	0x9a
+	.uleb128 0xb
+	.long	0x9a
+	.uleb128 0xb
+	.long	0x16f
+	.uleb128 0xb
+	.long	0x184
+	.uleb128 0xb
+	.long	0xb9
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x175
+	.uleb128 0xd
+	.long	0xad
+	.long	0x184
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x18a
+	.uleb128 0xd
+	.long	0xad
+	.long	0x199
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF57
+	.byte	0x1
+	.value	0x1e0
+	.byte	0x6
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x315
+	.uleb128 0x10
+	.quad	.LVL378
+	.long	0x133
+	.long	0x1e4
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	transpose_submit
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL379
+	.long	0x133
+	.long	0x210
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_basic
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL380
+	.long	0x133
+	.long	0x23c
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_tmp
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL381
+	.long	0x133
+	.long	0x268
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_blocked
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL382
+	.long	0x133
+	.long	0x294
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_oblivious
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL383
+	.long	0x133
+	.long	0x2c0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_staged
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL384
+	.long	0x133
+	.long	0x2ec
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_staged_l1
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL385
+	.long	0x133
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	trans_rect
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF20
+	.byte	0x1
+	.value	0x1cb
+	.byte	0xd
+	.byte	0x1
+	.long	0x3c5
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x1cb
+	.byte	0x25
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x1cb
+	.byte	0x2f
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x1cb
+	.byte	0x39
+	.long	0x3d8
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x1cb
+	.byte	0x49
+	.long	0x3f1
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x1cc
+	.byte	0x25
+	.long	0xb9
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST259
+	.long	.LVUS259
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3d8
+	.uleb128 0x17
+	.long	0x42
+	.long	0x35c
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3c5
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3f1
+	.uleb128 0x17
+	.long	0x42
+	.long	0x369
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3de
+	.uleb128 0x13
+	.long	.LASF21
+	.byte	0x1
+	.value	0x1ba
+	.byte	0xd
+	.byte	0x1
+	.long	0x466
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x1ba
+	.byte	0x1f
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x1ba
+	.byte	0x29
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x1ba
+	.byte	0x33
+	.long	0x478
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x1ba
+	.byte	0x43
+	.long	0x491
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x1bb
+	.byte	0x1f
+	.long	0xb9
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x478
+	.uleb128 0x18
+	.long	0x42
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x466
+	.uleb128 0xd
+	.long	0xad
+	.long	0x491
+	.uleb128 0x17
+	.long	0x42
+	.long	0x43e
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x47e
+	.uleb128 0x19
+	.long	.LASF23
+	.byte	0x1
+	.value	0x1a9
+	.byte	0xd
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd79
+	.uleb128 0x1a
+	.string	"M"
+	.byte	0x1
+	.value	0x1a9
+	.byte	0x24
+	.long	0x9a
+	.long	.LLST279
+	.long	.LVUS279
+	.uleb128 0x1a
+	.string	"N"
+	.byte	0x1
+	.value	0x1a9
+	.byte	0x2e
+	.long	0x9a
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x1a
+	.string	"A"
+	.byte	0x1
+	.value	0x1a9
+	.byte	0x38
+	.long	0xd8c
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x1a
+	.string	"B"
+	.byte	0x1
+	.value	0x1aa
+	.byte	0x24
+	.long	0xda5
+	.long	.LLST282
+	.long	.LVUS282
+	.uleb128 0x1a
+	.string	"tmp"
+	.byte	0x1
+	.value	0x1aa
+	.byte	0x34
+	.long	0xb9
+	.long	.LLST283
+	.long	.LVUS283
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0x1b
+	.long	0x1454
+	.quad	.LBI775
+	.value	.LVU661
+	.long	.Ldebug_ranges0+0xf40
+	.byte	0x1
+	.value	0x1ae
+	.byte	0x5
+	.long	0xd5e
+	.uleb128 0x1c
+	.long	0x1462
+	.uleb128 0x1d
+	.long	0x146f
+	.byte	0
+	.uleb128 0x1e
+	.long	0x14a8
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x1f
+	.long	0x149d
+	.long	0x3336
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0x1f
+	.long	0x1492
+	.long	0x334b
+	.long	.LLST286
+	.long	.LVUS286
+	.uleb128 0x1e
+	.long	0x1487
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x1e
+	.long	0x147c
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x1d
+	.long	0x146f
+	.byte	0
+	.uleb128 0x1c
+	.long	0x1462
+	.uleb128 0x20
+	.long	0x14b5
+	.long	.Ldebug_ranges0+0xf40
+	.uleb128 0x21
+	.long	0x14b6
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x20
+	.long	0x14c2
+	.long	.Ldebug_ranges0+0xf80
+	.uleb128 0x21
+	.long	0x14c3
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0x1b
+	.long	0x1b0d
+	.quad	.LBI778
+	.value	.LVU671
+	.long	.Ldebug_ranges0+0xfb0
+	.byte	0x1
+	.value	0x12b
+	.byte	0x15
+	.long	0x60d
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST292
+	.long	.LVUS292
+	.byte	0
+	.uleb128 0x20
+	.long	0x14cf
+	.long	.Ldebug_ranges0+0x1000
+	.uleb128 0x21
+	.long	0x14d0
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x20
+	.long	0x14dc
+	.long	.Ldebug_ranges0+0x1050
+	.uleb128 0x21
+	.long	0x14dd
+	.long	.LLST294
+	.long	.LVUS294
+	.uleb128 0x22
+	.long	0x151f
+	.long	.Ldebug_ranges0+0x10a0
+	.byte	0x1
+	.value	0x131
+	.byte	0x11
+	.long	0xa9d
+	.uleb128 0x1c
+	.long	0x152d
+	.uleb128 0x1c
+	.long	0x1597
+	.uleb128 0x1c
+	.long	0x158b
+	.uleb128 0x1c
+	.long	0x157f
+	.uleb128 0x1c
+	.long	0x1573
+	.uleb128 0x1c
+	.long	0x1566
+	.uleb128 0x23
+	.long	0x155b
+	.long	0x3360
+	.uleb128 0x23
+	.long	0x1550
+	.long	0x3375
+	.uleb128 0x1c
+	.long	0x1545
+	.uleb128 0x1c
+	.long	0x153a
+	.uleb128 0x1c
+	.long	0x152d
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x10a0
+	.uleb128 0x21
+	.long	0x15a3
+	.long	.LLST295
+	.long	.LVUS295
+	.uleb128 0x22
+	.long	0x164d
+	.long	.Ldebug_ranges0+0x1120
+	.byte	0x1
+	.value	0x111
+	.byte	0x16
+	.long	0x9b0
+	.uleb128 0x1c
+	.long	0x165e
+	.uleb128 0x1c
+	.long	0x16bf
+	.uleb128 0x1c
+	.long	0x16b4
+	.uleb128 0x1c
+	.long	0x16a9
+	.uleb128 0x1c
+	.long	0x169e
+	.uleb128 0x1c
+	.long	0x1692
+	.uleb128 0x23
+	.long	0x1688
+	.long	0x338a
+	.uleb128 0x23
+	.long	0x167e
+	.long	0x339f
+	.uleb128 0x1c
+	.long	0x1674
+	.uleb128 0x1c
+	.long	0x166a
+	.uleb128 0x1c
+	.long	0x165e
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x1120
+	.uleb128 0x21
+	.long	0x16ca
+	.long	.LLST296
+	.long	.LVUS296
+	.uleb128 0x21
+	.long	0x16d6
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x25
+	.long	0x16e2
+	.long	.Ldebug_ranges0+0x1190
+	.long	0x98b
+	.uleb128 0x21
+	.long	0x16e7
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x20
+	.long	0x16f3
+	.long	.Ldebug_ranges0+0x1210
+	.uleb128 0x21
+	.long	0x16f4
+	.long	.LLST299
+	.long	.LVUS299
+	.uleb128 0x26
+	.long	0x180d
+	.quad	.LBI792
+	.value	.LVU743
+	.long	.Ldebug_ranges0+0x12d0
+	.byte	0x1
+	.byte	0xf3
+	.byte	0xd
+	.long	0x93f
+	.uleb128 0x1c
+	.long	0x181e
+	.uleb128 0x1e
+	.long	0x187e
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x1e
+	.long	0x1873
+	.long	.LLST301
+	.long	.LVUS301
+	.uleb128 0x1e
+	.long	0x1868
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x1e
+	.long	0x185d
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x1e
+	.long	0x1852
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0x1f
+	.long	0x1848
+	.long	0x33b4
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x1f
+	.long	0x183e
+	.long	0x33c9
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x1e
+	.long	0x1834
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x1e
+	.long	0x182a
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x1c
+	.long	0x181e
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x12d0
+	.uleb128 0x21
+	.long	0x188a
+	.long	.LLST309
+	.long	.LVUS309
+	.uleb128 0x25
+	.long	0x18a6
+	.long	.Ldebug_ranges0+0x1390
+	.long	0x897
+	.uleb128 0x21
+	.long	0x18ab
+	.long	.LLST310
+	.long	.LVUS310
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI795
+	.value	.LVU778
+	.long	.Ldebug_ranges0+0x1450
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST311
+	.long	.LVUS311
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST313
+	.long	.LVUS313
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x1450
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST315
+	.long	.LVUS315
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0x14e0
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST318
+	.long	.LVUS318
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x1896
+	.long	.Ldebug_ranges0+0x1510
+	.uleb128 0x21
+	.long	0x189b
+	.long	.LLST319
+	.long	.LVUS319
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI819
+	.value	.LVU747
+	.long	.Ldebug_ranges0+0x1580
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST321
+	.long	.LVUS321
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST322
+	.long	.LVUS322
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST323
+	.long	.LVUS323
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x1580
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST324
+	.long	.LVUS324
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST325
+	.long	.LVUS325
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0x15c0
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST327
+	.long	.LVUS327
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x1979
+	.quad	.LBI855
+	.value	.LVU736
+	.quad	.LBB855
+	.quad	.LBE855-.LBB855
+	.byte	0x1
+	.byte	0xf2
+	.byte	0x16
+	.uleb128 0x1e
+	.long	0x1996
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x1e
+	.long	0x198a
+	.long	.LLST329
+	.long	.LVUS329
+	.uleb128 0x21
+	.long	0x19a0
+	.long	.LLST330
+	.long	.LVUS330
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x1702
+	.quad	.LBB875
+	.quad	.LBE875-.LBB875
+	.uleb128 0x21
+	.long	0x1703
+	.long	.LLST331
+	.long	.LVUS331
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x15b0
+	.long	.Ldebug_ranges0+0x15f0
+	.long	0xa2f
+	.uleb128 0x21
+	.long	0x15b5
+	.long	.LLST332
+	.long	.LVUS332
+	.uleb128 0x20
+	.long	0x15c0
+	.long	.Ldebug_ranges0+0x1640
+	.uleb128 0x21
+	.long	0x15c1
+	.long	.LLST333
+	.long	.LVUS333
+	.uleb128 0x1b
+	.long	0x1622
+	.quad	.LBI886
+	.value	.LVU825
+	.long	.Ldebug_ranges0+0x1680
+	.byte	0x1
+	.value	0x113
+	.byte	0x16
+	.long	0xa16
+	.uleb128 0x1e
+	.long	0x1641
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x1e
+	.long	0x1634
+	.long	.LLST335
+	.long	.LVUS335
+	.byte	0
+	.uleb128 0x20
+	.long	0x15ce
+	.long	.Ldebug_ranges0+0x16d0
+	.uleb128 0x21
+	.long	0x15cf
+	.long	.LLST336
+	.long	.LVUS336
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x15dd
+	.long	.Ldebug_ranges0+0x1740
+	.uleb128 0x21
+	.long	0x15de
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x20
+	.long	0x15e9
+	.long	.Ldebug_ranges0+0x1780
+	.uleb128 0x21
+	.long	0x15ea
+	.long	.LLST338
+	.long	.LVUS338
+	.uleb128 0x2a
+	.long	0x1622
+	.quad	.LBI904
+	.value	.LVU858
+	.quad	.LBB904
+	.quad	.LBE904-.LBB904
+	.byte	0x1
+	.value	0x11a
+	.byte	0xd
+	.uleb128 0x1e
+	.long	0x1641
+	.long	.LLST339
+	.long	.LVUS339
+	.uleb128 0x1e
+	.long	0x1634
+	.long	.LLST340
+	.long	.LVUS340
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0x1b0d
+	.quad	.LBI922
+	.value	.LVU693
+	.long	.Ldebug_ranges0+0x17b0
+	.byte	0x1
+	.value	0x12d
+	.byte	0x19
+	.long	0xad3
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST341
+	.long	.LVUS341
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST342
+	.long	.LVUS342
+	.byte	0
+	.uleb128 0x1b
+	.long	0x1739
+	.quad	.LBI926
+	.value	.LVU699
+	.long	.Ldebug_ranges0+0x17e0
+	.byte	0x1
+	.value	0x12e
+	.byte	0x1c
+	.long	0xcd5
+	.uleb128 0x1e
+	.long	0x174a
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x1e
+	.long	0x179f
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x1e
+	.long	0x1794
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x1e
+	.long	0x1789
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0x1e
+	.long	0x177e
+	.long	.LLST347
+	.long	.LVUS347
+	.uleb128 0x1f
+	.long	0x1774
+	.long	0x33e2
+	.long	.LLST349
+	.long	.LVUS349
+	.uleb128 0x1f
+	.long	0x176a
+	.long	0x33fb
+	.long	.LLST351
+	.long	.LVUS351
+	.uleb128 0x1e
+	.long	0x1760
+	.long	.LLST352
+	.long	.LVUS352
+	.uleb128 0x1e
+	.long	0x1756
+	.long	.LLST353
+	.long	.LVUS353
+	.uleb128 0x1c
+	.long	0x174a
+	.uleb128 0x25
+	.long	0x17aa
+	.long	.Ldebug_ranges0+0x1820
+	.long	0xc24
+	.uleb128 0x21
+	.long	0x17af
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0x29
+	.long	0x17b9
+	.quad	.LBB928
+	.quad	.LBE928-.LBB928
+	.uleb128 0x21
+	.long	0x17ba
+	.long	.LLST355
+	.long	.LVUS355
+	.uleb128 0x26
+	.long	0x1979
+	.quad	.LBI929
+	.value	.LVU712
+	.long	.Ldebug_ranges0+0x1860
+	.byte	0x1
+	.byte	0xd1
+	.byte	0x16
+	.long	0xbf4
+	.uleb128 0x1e
+	.long	0x1996
+	.long	.LLST356
+	.long	.LVUS356
+	.uleb128 0x1e
+	.long	0x198a
+	.long	.LLST357
+	.long	.LVUS357
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x1860
+	.uleb128 0x21
+	.long	0x19a0
+	.long	.LLST358
+	.long	.LVUS358
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL261
+	.long	0x180d
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x17c8
+	.long	.Ldebug_ranges0+0x1890
+	.uleb128 0x21
+	.long	0x17c9
+	.long	.LLST359
+	.long	.LVUS359
+	.uleb128 0x29
+	.long	0x17d3
+	.quad	.LBB935
+	.quad	.LBE935-.LBB935
+	.uleb128 0x21
+	.long	0x17d4
+	.long	.LLST360
+	.long	.LVUS360
+	.uleb128 0x26
+	.long	0x1979
+	.quad	.LBI936
+	.value	.LVU892
+	.long	.Ldebug_ranges0+0x18d0
+	.byte	0x1
+	.byte	0xd8
+	.byte	0x16
+	.long	0xca4
+	.uleb128 0x1e
+	.long	0x1996
+	.long	.LLST361
+	.long	.LVUS361
+	.uleb128 0x1e
+	.long	0x198a
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x18d0
+	.uleb128 0x21
+	.long	0x19a0
+	.long	.LLST363
+	.long	.LVUS363
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL329
+	.long	0x180d
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x1a69
+	.quad	.LBB947
+	.quad	.LBE947-.LBB947
+	.byte	0x1
+	.value	0x12f
+	.byte	0x11
+	.uleb128 0x1c
+	.long	0x1abf
+	.uleb128 0x1c
+	.long	0x1ab4
+	.uleb128 0x1c
+	.long	0x1aa9
+	.uleb128 0x1c
+	.long	0x1a9e
+	.uleb128 0x23
+	.long	0x1a94
+	.long	0x3410
+	.uleb128 0x23
+	.long	0x1a8a
+	.long	0x3425
+	.uleb128 0x1c
+	.long	0x1a80
+	.uleb128 0x1c
+	.long	0x1a76
+	.uleb128 0x29
+	.long	0x1aca
+	.quad	.LBB948
+	.quad	.LBE948-.LBB948
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST364
+	.long	.LVUS364
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0x1900
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST365
+	.long	.LVUS365
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST350
+	.long	.LVUS350
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0xd8c
+	.uleb128 0x17
+	.long	0x42
+	.long	0x517
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xd79
+	.uleb128 0xd
+	.long	0xad
+	.long	0xda5
+	.uleb128 0x17
+	.long	0x42
+	.long	0x524
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xd92
+	.uleb128 0x13
+	.long	.LASF22
+	.byte	0x1
+	.value	0x19a
+	.byte	0xd
+	.byte	0x1
+	.long	0xe0d
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x19a
+	.byte	0x21
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x19a
+	.byte	0x2b
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x19a
+	.byte	0x35
+	.long	0xe20
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x19a
+	.byte	0x45
+	.long	0xe39
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x19b
+	.byte	0x21
+	.long	0xb9
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST203
+	.long	.LVUS203
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0xe20
+	.uleb128 0x17
+	.long	0x42
+	.long	0xdf2
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xe0d
+	.uleb128 0xd
+	.long	0xad
+	.long	0xe39
+	.uleb128 0x17
+	.long	0x42
+	.long	0xdff
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xe26
+	.uleb128 0x19
+	.long	.LASF24
+	.byte	0x1
+	.value	0x18c
+	.byte	0xd
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf10
+	.uleb128 0x1a
+	.string	"M"
+	.byte	0x1
+	.value	0x18c
+	.byte	0x24
+	.long	0x9a
+	.long	.LLST383
+	.long	.LVUS383
+	.uleb128 0x1a
+	.string	"N"
+	.byte	0x1
+	.value	0x18c
+	.byte	0x2e
+	.long	0x9a
+	.long	.LLST384
+	.long	.LVUS384
+	.uleb128 0x1a
+	.string	"A"
+	.byte	0x1
+	.value	0x18c
+	.byte	0x38
+	.long	0xf23
+	.long	.LLST385
+	.long	.LVUS385
+	.uleb128 0x1a
+	.string	"B"
+	.byte	0x1
+	.value	0x18c
+	.byte	0x48
+	.long	0xf3c
+	.long	.LLST386
+	.long	.LVUS386
+	.uleb128 0x1a
+	.string	"tmp"
+	.byte	0x1
+	.value	0x18d
+	.byte	0x24
+	.long	0xb9
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST382
+	.long	.LVUS382
+	.uleb128 0x2b
+	.quad	.LVL377
+	.long	0x123c
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0xf23
+	.uleb128 0x17
+	.long	0x42
+	.long	0xebf
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xf10
+	.uleb128 0xd
+	.long	0xad
+	.long	0xf3c
+	.uleb128 0x17
+	.long	0x42
+	.long	0xecc
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xf29
+	.uleb128 0x13
+	.long	.LASF25
+	.byte	0x1
+	.value	0x17e
+	.byte	0xd
+	.byte	0x1
+	.long	0xfd8
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x17e
+	.byte	0x22
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x17e
+	.byte	0x2c
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x17e
+	.byte	0x36
+	.long	0xfeb
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x17e
+	.byte	0x46
+	.long	0x1004
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x17f
+	.byte	0x22
+	.long	0xb9
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0xfeb
+	.uleb128 0x17
+	.long	0x42
+	.long	0xf89
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xfd8
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1004
+	.uleb128 0x17
+	.long	0x42
+	.long	0xf96
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xff1
+	.uleb128 0x19
+	.long	.LASF26
+	.byte	0x1
+	.value	0x166
+	.byte	0xd
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x110f
+	.uleb128 0x1a
+	.string	"M"
+	.byte	0x1
+	.value	0x166
+	.byte	0x1e
+	.long	0x9a
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1a
+	.string	"N"
+	.byte	0x1
+	.value	0x166
+	.byte	0x28
+	.long	0x9a
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x1a
+	.string	"A"
+	.byte	0x1
+	.value	0x166
+	.byte	0x32
+	.long	0x1122
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1a
+	.string	"B"
+	.byte	0x1
+	.value	0x166
+	.byte	0x42
+	.long	0x113b
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x2d
+	.string	"tmp"
+	.byte	0x1
+	.value	0x167
+	.byte	0x1e
+	.long	0xb9
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2e
+	.long	.Ldebug_ranges0+0x1a0
+	.long	0x10f4
+	.uleb128 0x2f
+	.string	"i"
+	.byte	0x1
+	.value	0x16b
+	.byte	0x11
+	.long	0x9a
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x30
+	.quad	.LBB122
+	.quad	.LBE122-.LBB122
+	.uleb128 0x2f
+	.string	"j"
+	.byte	0x1
+	.value	0x16c
+	.byte	0x15
+	.long	0x9a
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x1e0
+	.uleb128 0x2f
+	.string	"di"
+	.byte	0x1
+	.value	0x16d
+	.byte	0x14
+	.long	0x9a
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x2f
+	.string	"dj"
+	.byte	0x1
+	.value	0x16e
+	.byte	0x14
+	.long	0x9a
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1122
+	.uleb128 0x17
+	.long	0x42
+	.long	0x10f4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x110f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x113b
+	.uleb128 0x17
+	.long	0x42
+	.long	0x1101
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1128
+	.uleb128 0x19
+	.long	.LASF27
+	.byte	0x1
+	.value	0x152
+	.byte	0xd
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x120b
+	.uleb128 0x1a
+	.string	"M"
+	.byte	0x1
+	.value	0x152
+	.byte	0x20
+	.long	0x9a
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2d
+	.string	"N"
+	.byte	0x1
+	.value	0x152
+	.byte	0x2a
+	.long	0x9a
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1a
+	.string	"A"
+	.byte	0x1
+	.value	0x152
+	.byte	0x34
+	.long	0x121e
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1a
+	.string	"B"
+	.byte	0x1
+	.value	0x152
+	.byte	0x44
+	.long	0x1236
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1a
+	.string	"tmp"
+	.byte	0x1
+	.value	0x153
+	.byte	0x20
+	.long	0xb9
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2e
+	.long	.Ldebug_ranges0+0x170
+	.long	0x11fd
+	.uleb128 0x2f
+	.string	"i"
+	.byte	0x1
+	.value	0x157
+	.byte	0x11
+	.long	0x9a
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x30
+	.quad	.LBB119
+	.quad	.LBE119-.LBB119
+	.uleb128 0x2f
+	.string	"j"
+	.byte	0x1
+	.value	0x158
+	.byte	0x15
+	.long	0x9a
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST34
+	.long	.LVUS34
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x121e
+	.uleb128 0x17
+	.long	0x42
+	.long	0x11fd
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x120b
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1236
+	.uleb128 0x18
+	.long	0x42
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1224
+	.uleb128 0x19
+	.long	.LASF28
+	.byte	0x1
+	.value	0x13b
+	.byte	0xd
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x141f
+	.uleb128 0x1a
+	.string	"M"
+	.byte	0x1
+	.value	0x13b
+	.byte	0x28
+	.long	0x9a
+	.long	.LLST369
+	.long	.LVUS369
+	.uleb128 0x1a
+	.string	"N"
+	.byte	0x1
+	.value	0x13b
+	.byte	0x32
+	.long	0x9a
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x1a
+	.string	"A"
+	.byte	0x1
+	.value	0x13b
+	.byte	0x3c
+	.long	0x1435
+	.long	.LLST371
+	.long	.LVUS371
+	.uleb128 0x1a
+	.string	"B"
+	.byte	0x1
+	.value	0x13c
+	.byte	0x28
+	.long	0x144e
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0x1a
+	.string	"i0"
+	.byte	0x1
+	.value	0x13c
+	.byte	0x38
+	.long	0x9a
+	.long	.LLST373
+	.long	.LVUS373
+	.uleb128 0x1a
+	.string	"i1"
+	.byte	0x1
+	.value	0x13c
+	.byte	0x43
+	.long	0x9a
+	.long	.LLST374
+	.long	.LVUS374
+	.uleb128 0x2d
+	.string	"j0"
+	.byte	0x1
+	.value	0x13d
+	.byte	0x28
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x2d
+	.string	"j1"
+	.byte	0x1
+	.value	0x13d
+	.byte	0x33
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 8
+	.uleb128 0x2e
+	.long	.Ldebug_ranges0+0x1930
+	.long	0x1344
+	.uleb128 0x2f
+	.string	"mid"
+	.byte	0x1
+	.value	0x141
+	.byte	0x10
+	.long	0x9a
+	.long	.LLST376
+	.long	.LVUS376
+	.uleb128 0x2b
+	.quad	.LVL362
+	.long	0x123c
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.quad	.LBB972
+	.quad	.LBE972-.LBB972
+	.long	0x13a5
+	.uleb128 0x2f
+	.string	"mid"
+	.byte	0x1
+	.value	0x145
+	.byte	0x10
+	.long	0x9a
+	.long	.LLST375
+	.long	.LVUS375
+	.uleb128 0x2b
+	.quad	.LVL359
+	.long	0x123c
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x32
+	.long	0x1a69
+	.long	.Ldebug_ranges0+0x1960
+	.byte	0x1
+	.value	0x13f
+	.byte	0x9
+	.uleb128 0x1c
+	.long	0x1abf
+	.uleb128 0x1c
+	.long	0x1ab4
+	.uleb128 0x1c
+	.long	0x1aa9
+	.uleb128 0x1c
+	.long	0x1a9e
+	.uleb128 0x23
+	.long	0x1a94
+	.long	0x343a
+	.uleb128 0x23
+	.long	0x1a8a
+	.long	0x344f
+	.uleb128 0x1c
+	.long	0x1a80
+	.uleb128 0x1c
+	.long	0x1a76
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0x1960
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST377
+	.long	.LVUS377
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0x1990
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST378
+	.long	.LVUS378
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1435
+	.uleb128 0x18
+	.long	0x42
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x141f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x144e
+	.uleb128 0x17
+	.long	0x42
+	.long	0x13a5
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x143b
+	.uleb128 0x13
+	.long	.LASF29
+	.byte	0x1
+	.value	0x127
+	.byte	0xd
+	.byte	0x1
+	.long	0x14ee
+	.uleb128 0x33
+	.long	.LASF30
+	.byte	0x1
+	.value	0x127
+	.byte	0x2b
+	.long	0xf6
+	.uleb128 0x33
+	.long	.LASF31
+	.byte	0x1
+	.value	0x127
+	.byte	0x36
+	.long	0x14ee
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x127
+	.byte	0x45
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x128
+	.byte	0x25
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x128
+	.byte	0x2f
+	.long	0x1504
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x128
+	.byte	0x3f
+	.long	0x1519
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x129
+	.byte	0x25
+	.long	0xb9
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"i0"
+	.byte	0x1
+	.value	0x12a
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"i1"
+	.byte	0x1
+	.value	0x12b
+	.byte	0x10
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"j0"
+	.byte	0x1
+	.value	0x12c
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"j1"
+	.byte	0x1
+	.value	0x12d
+	.byte	0x14
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF32
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1504
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x14f5
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1519
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x150a
+	.uleb128 0x13
+	.long	.LASF33
+	.byte	0x1
+	.value	0x10d
+	.byte	0xd
+	.byte	0x1
+	.long	0x15f8
+	.uleb128 0x33
+	.long	.LASF30
+	.byte	0x1
+	.value	0x10d
+	.byte	0x30
+	.long	0xf6
+	.uleb128 0x14
+	.string	"M"
+	.byte	0x1
+	.value	0x10d
+	.byte	0x3d
+	.long	0x9a
+	.uleb128 0x14
+	.string	"N"
+	.byte	0x1
+	.value	0x10d
+	.byte	0x47
+	.long	0x9a
+	.uleb128 0x14
+	.string	"A"
+	.byte	0x1
+	.value	0x10e
+	.byte	0x2a
+	.long	0x1607
+	.uleb128 0x14
+	.string	"B"
+	.byte	0x1
+	.value	0x10e
+	.byte	0x3a
+	.long	0x161c
+	.uleb128 0x14
+	.string	"tmp"
+	.byte	0x1
+	.value	0x10f
+	.byte	0x2a
+	.long	0xb9
+	.uleb128 0x14
+	.string	"i0"
+	.byte	0x1
+	.value	0x10f
+	.byte	0x40
+	.long	0x9a
+	.uleb128 0x14
+	.string	"i1"
+	.byte	0x1
+	.value	0x10f
+	.byte	0x4b
+	.long	0x9a
+	.uleb128 0x14
+	.string	"j0"
+	.byte	0x1
+	.value	0x110
+	.byte	0x2a
+	.long	0x9a
+	.uleb128 0x14
+	.string	"j1"
+	.byte	0x1
+	.value	0x110
+	.byte	0x35
+	.long	0x9a
+	.uleb128 0x36
+	.long	.LASF34
+	.byte	0x1
+	.value	0x111
+	.byte	0xe
+	.long	0x82
+	.uleb128 0x37
+	.long	0x15dd
+	.uleb128 0x35
+	.string	"i"
+	.byte	0x1
+	.value	0x112
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"row"
+	.byte	0x1
+	.value	0x113
+	.byte	0x10
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"j"
+	.byte	0x1
+	.value	0x114
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"j"
+	.byte	0x1
+	.value	0x118
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"i"
+	.byte	0x1
+	.value	0x119
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1607
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x15f8
+	.uleb128 0xd
+	.long	0xad
+	.long	0x161c
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x160d
+	.uleb128 0x38
+	.long	.LASF35
+	.byte	0x1
+	.value	0x102
+	.byte	0xf
+	.long	0x9a
+	.byte	0x1
+	.long	0x164d
+	.uleb128 0x33
+	.long	.LASF34
+	.byte	0x1
+	.value	0x102
+	.byte	0x22
+	.long	0x82
+	.uleb128 0x14
+	.string	"r"
+	.byte	0x1
+	.value	0x102
+	.byte	0x30
+	.long	0x9a
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF36
+	.byte	0x1
+	.byte	0xea
+	.byte	0x11
+	.long	0x82
+	.byte	0x1
+	.long	0x170f
+	.uleb128 0x3a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xea
+	.byte	0x2a
+	.long	0xf6
+	.uleb128 0x3b
+	.string	"M"
+	.byte	0x1
+	.byte	0xea
+	.byte	0x37
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"N"
+	.byte	0x1
+	.byte	0xea
+	.byte	0x41
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"A"
+	.byte	0x1
+	.byte	0xeb
+	.byte	0x24
+	.long	0x171e
+	.uleb128 0x3b
+	.string	"B"
+	.byte	0x1
+	.byte	0xeb
+	.byte	0x34
+	.long	0x1733
+	.uleb128 0x3b
+	.string	"tmp"
+	.byte	0x1
+	.byte	0xec
+	.byte	0x24
+	.long	0xb9
+	.uleb128 0x3b
+	.string	"i0"
+	.byte	0x1
+	.byte	0xec
+	.byte	0x3a
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"i1"
+	.byte	0x1
+	.byte	0xec
+	.byte	0x45
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j0"
+	.byte	0x1
+	.byte	0xed
+	.byte	0x24
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j1"
+	.byte	0x1
+	.byte	0xed
+	.byte	0x2f
+	.long	0x9a
+	.uleb128 0x3c
+	.long	.LASF34
+	.byte	0x1
+	.byte	0xee
+	.byte	0xe
+	.long	0x82
+	.uleb128 0x3c
+	.long	.LASF37
+	.byte	0x1
+	.byte	0xef
+	.byte	0xc
+	.long	0x9a
+	.uleb128 0x37
+	.long	0x1702
+	.uleb128 0x3c
+	.long	.LASF38
+	.byte	0x1
+	.byte	0xf0
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"set"
+	.byte	0x1
+	.byte	0xf2
+	.byte	0x10
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"r"
+	.byte	0x1
+	.byte	0xfa
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x171e
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x170f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1733
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1724
+	.uleb128 0x39
+	.long	.LASF39
+	.byte	0x1
+	.byte	0xcd
+	.byte	0xd
+	.long	0x14ee
+	.byte	0x1
+	.long	0x17e3
+	.uleb128 0x3a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xcd
+	.byte	0x24
+	.long	0xf6
+	.uleb128 0x3b
+	.string	"M"
+	.byte	0x1
+	.byte	0xcd
+	.byte	0x31
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"N"
+	.byte	0x1
+	.byte	0xcd
+	.byte	0x3b
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"A"
+	.byte	0x1
+	.byte	0xcd
+	.byte	0x45
+	.long	0x17f2
+	.uleb128 0x3b
+	.string	"B"
+	.byte	0x1
+	.byte	0xce
+	.byte	0x1e
+	.long	0x1807
+	.uleb128 0x3b
+	.string	"i0"
+	.byte	0x1
+	.byte	0xce
+	.byte	0x2e
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"i1"
+	.byte	0x1
+	.byte	0xce
+	.byte	0x39
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j0"
+	.byte	0x1
+	.byte	0xce
+	.byte	0x44
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j1"
+	.byte	0x1
+	.byte	0xcf
+	.byte	0x1e
+	.long	0x9a
+	.uleb128 0x37
+	.long	0x17c8
+	.uleb128 0x3d
+	.string	"i"
+	.byte	0x1
+	.byte	0xd0
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"set"
+	.byte	0x1
+	.byte	0xd1
+	.byte	0x10
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"j"
+	.byte	0x1
+	.byte	0xd7
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"set"
+	.byte	0x1
+	.byte	0xd8
+	.byte	0x10
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x17f2
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x17e3
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1807
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x17f8
+	.uleb128 0x39
+	.long	.LASF40
+	.byte	0x1
+	.byte	0xbc
+	.byte	0xf
+	.long	0x9a
+	.byte	0x1
+	.long	0x18d1
+	.uleb128 0x3a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xbc
+	.byte	0x2e
+	.long	0xf6
+	.uleb128 0x3b
+	.string	"M"
+	.byte	0x1
+	.byte	0xbc
+	.byte	0x3b
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"N"
+	.byte	0x1
+	.byte	0xbc
+	.byte	0x45
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"A"
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x28
+	.long	0x18e4
+	.uleb128 0x3b
+	.string	"B"
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x38
+	.long	0x18fd
+	.uleb128 0x3b
+	.string	"i0"
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x48
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"i1"
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x28
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j0"
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x33
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j1"
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x3e
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"set"
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x49
+	.long	0x9a
+	.uleb128 0x3c
+	.long	.LASF41
+	.byte	0x1
+	.byte	0xbf
+	.byte	0xc
+	.long	0x9a
+	.uleb128 0x37
+	.long	0x18a6
+	.uleb128 0x3d
+	.string	"i"
+	.byte	0x1
+	.byte	0xc0
+	.byte	0x11
+	.long	0x9a
+	.byte	0
+	.uleb128 0x37
+	.long	0x18b6
+	.uleb128 0x3d
+	.string	"j"
+	.byte	0x1
+	.byte	0xc3
+	.byte	0x11
+	.long	0x9a
+	.byte	0
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.long	0x42
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x18e4
+	.uleb128 0x17
+	.long	0x42
+	.long	0x18b6
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x18d1
+	.uleb128 0xd
+	.long	0xad
+	.long	0x18fd
+	.uleb128 0x17
+	.long	0x42
+	.long	0x18c3
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x18ea
+	.uleb128 0x39
+	.long	.LASF42
+	.byte	0x1
+	.byte	0xab
+	.byte	0xf
+	.long	0x9a
+	.byte	0x1
+	.long	0x1973
+	.uleb128 0x3a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xab
+	.byte	0x29
+	.long	0xf6
+	.uleb128 0x3b
+	.string	"p"
+	.byte	0x1
+	.byte	0xab
+	.byte	0x3d
+	.long	0x1973
+	.uleb128 0x3b
+	.string	"n"
+	.byte	0x1
+	.byte	0xab
+	.byte	0x47
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"set"
+	.byte	0x1
+	.byte	0xac
+	.byte	0x23
+	.long	0x9a
+	.uleb128 0x3c
+	.long	.LASF43
+	.byte	0x1
+	.byte	0xad
+	.byte	0xf
+	.long	0x8e
+	.uleb128 0x3c
+	.long	.LASF44
+	.byte	0x1
+	.byte	0xae
+	.byte	0xf
+	.long	0x8e
+	.uleb128 0x3c
+	.long	.LASF41
+	.byte	0x1
+	.byte	0xaf
+	.byte	0xc
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3c
+	.long	.LASF45
+	.byte	0x1
+	.byte	0xb0
+	.byte	0x14
+	.long	0x8e
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0xb4
+	.uleb128 0x39
+	.long	.LASF46
+	.byte	0x1
+	.byte	0xa5
+	.byte	0xf
+	.long	0x9a
+	.byte	0x1
+	.long	0x19ad
+	.uleb128 0x3a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xa5
+	.byte	0x26
+	.long	0xf6
+	.uleb128 0x3b
+	.string	"p"
+	.byte	0x1
+	.byte	0xa5
+	.byte	0x3a
+	.long	0x1973
+	.uleb128 0x3c
+	.long	.LASF47
+	.byte	0x1
+	.byte	0xa6
+	.byte	0xc
+	.long	0x9a
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x90
+	.byte	0xd
+	.byte	0x1
+	.long	0x1a3f
+	.uleb128 0x3b
+	.string	"M"
+	.byte	0x1
+	.byte	0x90
+	.byte	0x24
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"N"
+	.byte	0x1
+	.byte	0x90
+	.byte	0x2e
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"A"
+	.byte	0x1
+	.byte	0x90
+	.byte	0x38
+	.long	0x1a4e
+	.uleb128 0x3b
+	.string	"B"
+	.byte	0x1
+	.byte	0x91
+	.byte	0x24
+	.long	0x1a63
+	.uleb128 0x3a
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x91
+	.byte	0x34
+	.long	0x9a
+	.uleb128 0x3a
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x91
+	.byte	0x41
+	.long	0x9a
+	.uleb128 0x3a
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x92
+	.byte	0x22
+	.long	0x14ee
+	.uleb128 0x37
+	.long	0x1a24
+	.uleb128 0x3d
+	.string	"j0"
+	.byte	0x1
+	.byte	0x94
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"i0"
+	.byte	0x1
+	.byte	0x95
+	.byte	0x19
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"i0"
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"j0"
+	.byte	0x1
+	.byte	0x9c
+	.byte	0x19
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1a4e
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1a3f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1a63
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1a54
+	.uleb128 0x3e
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x7c
+	.byte	0xd
+	.byte	0x1
+	.long	0x1ae3
+	.uleb128 0x3b
+	.string	"M"
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x23
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"N"
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x2d
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"A"
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x37
+	.long	0x1af2
+	.uleb128 0x3b
+	.string	"B"
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x47
+	.long	0x1b07
+	.uleb128 0x3b
+	.string	"i0"
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x23
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"i1"
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x2e
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j0"
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x39
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"j1"
+	.byte	0x1
+	.byte	0x7d
+	.byte	0x44
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"i"
+	.byte	0x1
+	.byte	0x7e
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x34
+	.uleb128 0x3d
+	.string	"j"
+	.byte	0x1
+	.byte	0x7f
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1af2
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1ae3
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1b07
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1af8
+	.uleb128 0x39
+	.long	.LASF52
+	.byte	0x1
+	.byte	0x71
+	.byte	0xf
+	.long	0x9a
+	.byte	0x1
+	.long	0x1b33
+	.uleb128 0x3b
+	.string	"a"
+	.byte	0x1
+	.byte	0x71
+	.byte	0x1f
+	.long	0x9a
+	.uleb128 0x3b
+	.string	"b"
+	.byte	0x1
+	.byte	0x71
+	.byte	0x29
+	.long	0x9a
+	.byte	0
+	.uleb128 0x3f
+	.long	0x180d
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d42
+	.uleb128 0x1e
+	.long	0x181e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1e
+	.long	0x182a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1e
+	.long	0x1834
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1f
+	.long	0x183e
+	.long	0x18e4
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1f
+	.long	0x1848
+	.long	0x18fd
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1e
+	.long	0x1852
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1e
+	.long	0x185d
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1e
+	.long	0x1868
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1e
+	.long	0x1873
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1e
+	.long	0x187e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x21
+	.long	0x188a
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x25
+	.long	0x1896
+	.long	.Ldebug_ranges0+0
+	.long	0x1c8f
+	.uleb128 0x21
+	.long	0x189b
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI93
+	.value	.LVU21
+	.long	.Ldebug_ranges0+0x40
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x40
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0x90
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x18a6
+	.quad	.LBB107
+	.quad	.LBE107-.LBB107
+	.uleb128 0x21
+	.long	0x18ab
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI108
+	.value	.LVU53
+	.long	.Ldebug_ranges0+0xe0
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0xe0
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0x120
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	0xf42
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fe7
+	.uleb128 0x1e
+	.long	0xf50
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1e
+	.long	0xf5b
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1f
+	.long	0xf66
+	.long	0xfeb
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1f
+	.long	0xf71
+	.long	0x1004
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1e
+	.long	0xf7c
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x40
+	.long	0x19ad
+	.quad	.LBI178
+	.value	.LVU140
+	.long	.Ldebug_ranges0+0x220
+	.byte	0x1
+	.value	0x183
+	.byte	0x5
+	.uleb128 0x1d
+	.long	0x19e2
+	.byte	0x8
+	.uleb128 0x1d
+	.long	0x19ee
+	.byte	0x8
+	.uleb128 0x1d
+	.long	0x19fa
+	.byte	0x1
+	.uleb128 0x1d
+	.long	0x19fa
+	.byte	0x1
+	.uleb128 0x1d
+	.long	0x19ee
+	.byte	0x8
+	.uleb128 0x1d
+	.long	0x19e2
+	.byte	0x8
+	.uleb128 0x1f
+	.long	0x19d8
+	.long	0x1ffa
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x1f
+	.long	0x19ce
+	.long	0x2013
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x1e
+	.long	0x19c4
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1e
+	.long	0x19ba
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x27
+	.long	0x19ad
+	.quad	.LBI179
+	.value	.LVU142
+	.long	.Ldebug_ranges0+0x220
+	.byte	0x1
+	.byte	0x90
+	.byte	0xd
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1d
+	.long	0x19fa
+	.byte	0x1
+	.uleb128 0x1d
+	.long	0x19ee
+	.byte	0x8
+	.uleb128 0x1d
+	.long	0x19e2
+	.byte	0x8
+	.uleb128 0x1f
+	.long	0x19d8
+	.long	0x2028
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1f
+	.long	0x19ce
+	.long	0x203d
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x1e
+	.long	0x19c4
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x1e
+	.long	0x19ba
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x20
+	.long	0x1a06
+	.long	.Ldebug_ranges0+0x220
+	.uleb128 0x21
+	.long	0x1a0b
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x20
+	.long	0x1a16
+	.long	.Ldebug_ranges0+0x260
+	.uleb128 0x21
+	.long	0x1a17
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI182
+	.value	.LVU155
+	.long	.Ldebug_ranges0+0x2a0
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.long	0x1eec
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x41
+	.long	0x1b0d
+	.quad	.LBI186
+	.value	.LVU159
+	.quad	.LBB186
+	.quad	.LBE186-.LBB186
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.long	0x1f2d
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x27
+	.long	0x1a69
+	.quad	.LBI188
+	.value	.LVU163
+	.long	.Ldebug_ranges0+0x2d0
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.uleb128 0x1e
+	.long	0x1abf
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1e
+	.long	0x1ab4
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x1e
+	.long	0x1aa9
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x1e
+	.long	0x1a9e
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1f
+	.long	0x1a94
+	.long	0x2056
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1f
+	.long	0x1a8a
+	.long	0x206f
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0x2d0
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0x300
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x1ffa
+	.uleb128 0x17
+	.long	0x42
+	.long	0xfa3
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x1fe7
+	.uleb128 0xd
+	.long	0xad
+	.long	0x2013
+	.uleb128 0x17
+	.long	0x42
+	.long	0xfb0
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2000
+	.uleb128 0xd
+	.long	0xad
+	.long	0x2028
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2019
+	.uleb128 0xd
+	.long	0xad
+	.long	0x203d
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x202e
+	.uleb128 0xd
+	.long	0xad
+	.long	0x2056
+	.uleb128 0x17
+	.long	0x42
+	.long	0xfbd
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2043
+	.uleb128 0xd
+	.long	0xad
+	.long	0x206f
+	.uleb128 0x17
+	.long	0x42
+	.long	0xfca
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x205c
+	.uleb128 0x3f
+	.long	0x3f7
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2299
+	.uleb128 0x42
+	.long	0x405
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1e
+	.long	0x410
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x1f
+	.long	0x41b
+	.long	0x478
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1f
+	.long	0x426
+	.long	0x491
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x1e
+	.long	0x431
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x40
+	.long	0x19ad
+	.quad	.LBI252
+	.value	.LVU198
+	.long	.Ldebug_ranges0+0x330
+	.byte	0x1
+	.value	0x1bf
+	.byte	0x5
+	.uleb128 0x1d
+	.long	0x19e2
+	.byte	0x20
+	.uleb128 0x1d
+	.long	0x19ee
+	.byte	0x4
+	.uleb128 0x1d
+	.long	0x19fa
+	.byte	0
+	.uleb128 0x1d
+	.long	0x19fa
+	.byte	0
+	.uleb128 0x1d
+	.long	0x19ee
+	.byte	0x4
+	.uleb128 0x1d
+	.long	0x19e2
+	.byte	0x20
+	.uleb128 0x1f
+	.long	0x19d8
+	.long	0x22a8
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x1f
+	.long	0x19ce
+	.long	0x22bd
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x1e
+	.long	0x19c4
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1e
+	.long	0x19ba
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x20
+	.long	0x1a24
+	.long	.Ldebug_ranges0+0x330
+	.uleb128 0x21
+	.long	0x1a25
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x20
+	.long	0x1a30
+	.long	.Ldebug_ranges0+0x370
+	.uleb128 0x21
+	.long	0x1a31
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI255
+	.value	.LVU217
+	.long	.Ldebug_ranges0+0x3b0
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.long	0x21ab
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI258
+	.value	.LVU213
+	.long	.Ldebug_ranges0+0x3e0
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.long	0x21e0
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST107
+	.long	.LVUS107
+	.byte	0
+	.uleb128 0x27
+	.long	0x1a69
+	.quad	.LBI264
+	.value	.LVU220
+	.long	.Ldebug_ranges0+0x420
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.uleb128 0x1e
+	.long	0x1abf
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x1e
+	.long	0x1ab4
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x1e
+	.long	0x1aa9
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1e
+	.long	0x1a9e
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x1f
+	.long	0x1a94
+	.long	0x22d6
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x1f
+	.long	0x1a8a
+	.long	0x22ef
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0x420
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0x460
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x22a8
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2299
+	.uleb128 0xd
+	.long	0xad
+	.long	0x22bd
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x22ae
+	.uleb128 0xd
+	.long	0xad
+	.long	0x22d6
+	.uleb128 0x17
+	.long	0x42
+	.long	0x44b
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x22c3
+	.uleb128 0xd
+	.long	0xad
+	.long	0x22ef
+	.uleb128 0x17
+	.long	0x42
+	.long	0x458
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x22dc
+	.uleb128 0x3f
+	.long	0x1454
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x295f
+	.uleb128 0x42
+	.long	0x1462
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1e
+	.long	0x146f
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x1e
+	.long	0x147c
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1e
+	.long	0x1487
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x1f
+	.long	0x1492
+	.long	0x296e
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1f
+	.long	0x149d
+	.long	0x2983
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x1e
+	.long	0x14a8
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1d
+	.long	0x146f
+	.byte	0x1
+	.uleb128 0x1c
+	.long	0x1462
+	.uleb128 0x25
+	.long	0x14b5
+	.long	.Ldebug_ranges0+0x490
+	.long	0x2944
+	.uleb128 0x21
+	.long	0x14b6
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x20
+	.long	0x14c2
+	.long	.Ldebug_ranges0+0x4d0
+	.uleb128 0x21
+	.long	0x14c3
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x1b
+	.long	0x1b0d
+	.quad	.LBI361
+	.value	.LVU270
+	.long	.Ldebug_ranges0+0x500
+	.byte	0x1
+	.value	0x12b
+	.byte	0x15
+	.long	0x23e0
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x20
+	.long	0x14cf
+	.long	.Ldebug_ranges0+0x540
+	.uleb128 0x21
+	.long	0x14d0
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x20
+	.long	0x14dc
+	.long	.Ldebug_ranges0+0x580
+	.uleb128 0x21
+	.long	0x14dd
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1b
+	.long	0x151f
+	.quad	.LBI368
+	.value	.LVU296
+	.long	.Ldebug_ranges0+0x5c0
+	.byte	0x1
+	.value	0x131
+	.byte	0x11
+	.long	0x290e
+	.uleb128 0x1c
+	.long	0x152d
+	.uleb128 0x1e
+	.long	0x1597
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1e
+	.long	0x158b
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x1e
+	.long	0x157f
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x1e
+	.long	0x1573
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x1e
+	.long	0x1566
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1f
+	.long	0x155b
+	.long	0x299c
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x1f
+	.long	0x1550
+	.long	0x29b5
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x1e
+	.long	0x1545
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x1e
+	.long	0x153a
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x1c
+	.long	0x152d
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x5c0
+	.uleb128 0x21
+	.long	0x15a3
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x1b
+	.long	0x164d
+	.quad	.LBI370
+	.value	.LVU298
+	.long	.Ldebug_ranges0+0x610
+	.byte	0x1
+	.value	0x111
+	.byte	0x16
+	.long	0x2821
+	.uleb128 0x1c
+	.long	0x165e
+	.uleb128 0x1e
+	.long	0x16bf
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1e
+	.long	0x16b4
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x1e
+	.long	0x16a9
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x1e
+	.long	0x169e
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x1e
+	.long	0x1692
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x1f
+	.long	0x1688
+	.long	0x29ca
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x1f
+	.long	0x167e
+	.long	0x29df
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x1e
+	.long	0x1674
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x1e
+	.long	0x166a
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x1c
+	.long	0x165e
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x610
+	.uleb128 0x21
+	.long	0x16ca
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x21
+	.long	0x16d6
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x25
+	.long	0x16e2
+	.long	.Ldebug_ranges0+0x660
+	.long	0x27fc
+	.uleb128 0x21
+	.long	0x16e7
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x20
+	.long	0x16f3
+	.long	.Ldebug_ranges0+0x6d0
+	.uleb128 0x21
+	.long	0x16f4
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x26
+	.long	0x180d
+	.quad	.LBI374
+	.value	.LVU318
+	.long	.Ldebug_ranges0+0x770
+	.byte	0x1
+	.byte	0xf3
+	.byte	0xd
+	.long	0x27b6
+	.uleb128 0x1c
+	.long	0x181e
+	.uleb128 0x1e
+	.long	0x187e
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x1e
+	.long	0x1873
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x1e
+	.long	0x1868
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x1e
+	.long	0x185d
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x1e
+	.long	0x1852
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x1f
+	.long	0x1848
+	.long	0x29f4
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x1f
+	.long	0x183e
+	.long	0x2a09
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x1e
+	.long	0x1834
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x1e
+	.long	0x182a
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x1c
+	.long	0x181e
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x770
+	.uleb128 0x21
+	.long	0x188a
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x25
+	.long	0x18a6
+	.long	.Ldebug_ranges0+0x820
+	.long	0x270e
+	.uleb128 0x21
+	.long	0x18ab
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI377
+	.value	.LVU354
+	.long	.Ldebug_ranges0+0x8b0
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x8b0
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0x920
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x1896
+	.long	.Ldebug_ranges0+0x950
+	.uleb128 0x21
+	.long	0x189b
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x27
+	.long	0x1903
+	.quad	.LBI395
+	.value	.LVU324
+	.long	.Ldebug_ranges0+0x9d0
+	.byte	0x1
+	.byte	0xc1
+	.byte	0x12
+	.uleb128 0x1e
+	.long	0x1934
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x1e
+	.long	0x192a
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x1e
+	.long	0x1920
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x1e
+	.long	0x1914
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0x9d0
+	.uleb128 0x21
+	.long	0x1940
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x21
+	.long	0x194c
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x21
+	.long	0x1958
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x20
+	.long	0x1964
+	.long	.Ldebug_ranges0+0xa10
+	.uleb128 0x21
+	.long	0x1965
+	.long	.LLST184
+	.long	.LVUS184
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	0x1979
+	.quad	.LBI428
+	.value	.LVU309
+	.long	.Ldebug_ranges0+0xa40
+	.byte	0x1
+	.byte	0xf2
+	.byte	0x16
+	.uleb128 0x1e
+	.long	0x1996
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x1e
+	.long	0x198a
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x24
+	.long	.Ldebug_ranges0+0xa40
+	.uleb128 0x21
+	.long	0x19a0
+	.long	.LLST187
+	.long	.LVUS187
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x1702
+	.quad	.LBB448
+	.quad	.LBE448-.LBB448
+	.uleb128 0x21
+	.long	0x1703
+	.long	.LLST188
+	.long	.LVUS188
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0x15b0
+	.long	.Ldebug_ranges0+0xa70
+	.long	0x28a0
+	.uleb128 0x21
+	.long	0x15b5
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x20
+	.long	0x15c0
+	.long	.Ldebug_ranges0+0xac0
+	.uleb128 0x21
+	.long	0x15c1
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x1b
+	.long	0x1622
+	.quad	.LBI456
+	.value	.LVU398
+	.long	.Ldebug_ranges0+0xb10
+	.byte	0x1
+	.value	0x113
+	.byte	0x16
+	.long	0x2887
+	.uleb128 0x1e
+	.long	0x1641
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x1e
+	.long	0x1634
+	.long	.LLST192
+	.long	.LVUS192
+	.byte	0
+	.uleb128 0x20
+	.long	0x15ce
+	.long	.Ldebug_ranges0+0xb50
+	.uleb128 0x21
+	.long	0x15cf
+	.long	.LLST193
+	.long	.LVUS193
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x15dd
+	.long	.Ldebug_ranges0+0xbc0
+	.uleb128 0x21
+	.long	0x15de
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x20
+	.long	0x15e9
+	.long	.Ldebug_ranges0+0xc00
+	.uleb128 0x21
+	.long	0x15ea
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x2a
+	.long	0x1622
+	.quad	.LBI473
+	.value	.LVU428
+	.quad	.LBB473
+	.quad	.LBE473-.LBB473
+	.byte	0x1
+	.value	0x11a
+	.byte	0xd
+	.uleb128 0x1e
+	.long	0x1641
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x1e
+	.long	0x1634
+	.long	.LLST197
+	.long	.LVUS197
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0x1b0d
+	.quad	.LBI486
+	.value	.LVU290
+	.long	.Ldebug_ranges0+0xc30
+	.byte	0x1
+	.value	0x12d
+	.byte	0x19
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST199
+	.long	.LVUS199
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x16
+	.long	0x49
+	.long	.LLST139
+	.long	.LVUS139
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x296e
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x295f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x2983
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2974
+	.uleb128 0xd
+	.long	0xad
+	.long	0x299c
+	.uleb128 0x17
+	.long	0x42
+	.long	0x2944
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x2989
+	.uleb128 0xd
+	.long	0xad
+	.long	0x29b5
+	.uleb128 0x17
+	.long	0x42
+	.long	0x2951
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x29a2
+	.uleb128 0xd
+	.long	0xad
+	.long	0x29ca
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x29bb
+	.uleb128 0xd
+	.long	0xad
+	.long	0x29df
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x29d0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x29f4
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x29e5
+	.uleb128 0xd
+	.long	0xad
+	.long	0x2a09
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x29fa
+	.uleb128 0x3f
+	.long	0xdab
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a9c
+	.uleb128 0x1e
+	.long	0xdb9
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x1e
+	.long	0xdc4
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x1f
+	.long	0xdcf
+	.long	0xe20
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x1f
+	.long	0xdda
+	.long	0xe39
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x1e
+	.long	0xde5
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x2b
+	.quad	.LVL171
+	.long	0x22f5
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	0x315
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3141
+	.uleb128 0x1e
+	.long	0x323
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x1e
+	.long	0x32e
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x1f
+	.long	0x339
+	.long	0x3d8
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x1f
+	.long	0x344
+	.long	0x3f1
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x1e
+	.long	0x34f
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x1b
+	.long	0x315
+	.quad	.LBI626
+	.value	.LVU501
+	.long	.Ldebug_ranges0+0xc70
+	.byte	0x1
+	.value	0x1cb
+	.byte	0xd
+	.long	0x2f3f
+	.uleb128 0x1e
+	.long	0x34f
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x1f
+	.long	0x344
+	.long	0x3150
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x23
+	.long	0x339
+	.long	0x3165
+	.uleb128 0x1e
+	.long	0x32e
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x1e
+	.long	0x323
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x22
+	.long	0xf42
+	.long	.Ldebug_ranges0+0xca0
+	.byte	0x1
+	.value	0x1d3
+	.byte	0x9
+	.long	0x2d5e
+	.uleb128 0x1c
+	.long	0xf7c
+	.uleb128 0x23
+	.long	0xf71
+	.long	0x317a
+	.uleb128 0x23
+	.long	0xf66
+	.long	0x318f
+	.uleb128 0x1c
+	.long	0xf5b
+	.uleb128 0x1c
+	.long	0xf50
+	.uleb128 0x32
+	.long	0x19ad
+	.long	.Ldebug_ranges0+0xca0
+	.byte	0x1
+	.value	0x183
+	.byte	0x5
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x23
+	.long	0x19d8
+	.long	0x31a4
+	.uleb128 0x23
+	.long	0x19ce
+	.long	0x31b9
+	.uleb128 0x1c
+	.long	0x19c4
+	.uleb128 0x1c
+	.long	0x19ba
+	.uleb128 0x43
+	.long	0x19ad
+	.long	.Ldebug_ranges0+0xca0
+	.byte	0x1
+	.byte	0x90
+	.byte	0xd
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x23
+	.long	0x19d8
+	.long	0x31ce
+	.uleb128 0x23
+	.long	0x19ce
+	.long	0x31e3
+	.uleb128 0x1c
+	.long	0x19c4
+	.uleb128 0x1c
+	.long	0x19ba
+	.uleb128 0x20
+	.long	0x1a06
+	.long	.Ldebug_ranges0+0xca0
+	.uleb128 0x21
+	.long	0x1a0b
+	.long	.LLST222
+	.long	.LVUS222
+	.uleb128 0x20
+	.long	0x1a16
+	.long	.Ldebug_ranges0+0xcd0
+	.uleb128 0x21
+	.long	0x1a17
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x26
+	.long	0x1a69
+	.quad	.LBI633
+	.value	.LVU525
+	.long	.Ldebug_ranges0+0xd10
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.long	0x2cf3
+	.uleb128 0x1e
+	.long	0x1abf
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x1e
+	.long	0x1ab4
+	.long	.LLST225
+	.long	.LVUS225
+	.uleb128 0x1e
+	.long	0x1aa9
+	.long	.LLST226
+	.long	.LVUS226
+	.uleb128 0x1e
+	.long	0x1a9e
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x1f
+	.long	0x1a94
+	.long	0x31fc
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x23
+	.long	0x1a8a
+	.long	0x3215
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST232
+	.long	.LVUS232
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0xd10
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0xd50
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST234
+	.long	.LVUS234
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI639
+	.value	.LVU516
+	.long	.Ldebug_ranges0+0xd80
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.long	0x2d28
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST236
+	.long	.LVUS236
+	.byte	0
+	.uleb128 0x27
+	.long	0x1b0d
+	.quad	.LBI645
+	.value	.LVU521
+	.long	.Ldebug_ranges0+0xdc0
+	.byte	0x1
+	.byte	0x96
+	.byte	0x11
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST238
+	.long	.LVUS238
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x3f7
+	.quad	.LBB657
+	.quad	.LBE657-.LBB657
+	.byte	0x1
+	.value	0x1d5
+	.byte	0x9
+	.uleb128 0x1c
+	.long	0x431
+	.uleb128 0x23
+	.long	0x426
+	.long	0x322a
+	.uleb128 0x23
+	.long	0x41b
+	.long	0x323f
+	.uleb128 0x1c
+	.long	0x410
+	.uleb128 0x1c
+	.long	0x405
+	.uleb128 0x2c
+	.long	0x19ad
+	.quad	.LBB658
+	.quad	.LBE658-.LBB658
+	.byte	0x1
+	.value	0x1bf
+	.byte	0x5
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x23
+	.long	0x19d8
+	.long	0x3254
+	.uleb128 0x23
+	.long	0x19ce
+	.long	0x3269
+	.uleb128 0x1c
+	.long	0x19c4
+	.uleb128 0x1c
+	.long	0x19ba
+	.uleb128 0x29
+	.long	0x1a24
+	.quad	.LBB659
+	.quad	.LBE659-.LBB659
+	.uleb128 0x21
+	.long	0x1a25
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0x20
+	.long	0x1a30
+	.long	.Ldebug_ranges0+0xdf0
+	.uleb128 0x21
+	.long	0x1a31
+	.long	.LLST240
+	.long	.LVUS240
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI661
+	.value	.LVU622
+	.long	.Ldebug_ranges0+0xe30
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.long	0x2e58
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0x26
+	.long	0x1b0d
+	.quad	.LBI666
+	.value	.LVU618
+	.long	.Ldebug_ranges0+0xe70
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.long	0x2e8d
+	.uleb128 0x1e
+	.long	0x1b28
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x1e
+	.long	0x1b1e
+	.long	.LLST244
+	.long	.LVUS244
+	.byte	0
+	.uleb128 0x27
+	.long	0x1a69
+	.quad	.LBI670
+	.value	.LVU625
+	.long	.Ldebug_ranges0+0xea0
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.uleb128 0x1e
+	.long	0x1abf
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x1e
+	.long	0x1ab4
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x1e
+	.long	0x1aa9
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x1e
+	.long	0x1a9e
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x1f
+	.long	0x1a94
+	.long	0x3282
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x23
+	.long	0x1a8a
+	.long	0x329b
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST252
+	.long	.LVUS252
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0xea0
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x20
+	.long	0x1ad5
+	.long	.Ldebug_ranges0+0xee0
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST255
+	.long	.LVUS255
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	0xdab
+	.quad	.LBI682
+	.value	.LVU559
+	.quad	.LBB682
+	.quad	.LBE682-.LBB682
+	.byte	0x1
+	.value	0x1d1
+	.byte	0x9
+	.long	0x2fc9
+	.uleb128 0x1e
+	.long	0xde5
+	.long	.LLST256
+	.long	.LVUS256
+	.uleb128 0x1f
+	.long	0xdda
+	.long	0x32b4
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x23
+	.long	0xdcf
+	.long	0x32cd
+	.uleb128 0x1e
+	.long	0xdc4
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x1e
+	.long	0xdb9
+	.long	.LLST261
+	.long	.LVUS261
+	.uleb128 0x2b
+	.quad	.LVL200
+	.long	0x22f5
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x19ad
+	.quad	.LBB684
+	.quad	.LBE684-.LBB684
+	.byte	0x1
+	.value	0x1cf
+	.byte	0x9
+	.uleb128 0x1c
+	.long	0x19ba
+	.uleb128 0x1c
+	.long	0x19c4
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19fa
+	.uleb128 0x1c
+	.long	0x19ee
+	.uleb128 0x1c
+	.long	0x19e2
+	.uleb128 0x23
+	.long	0x19d8
+	.long	0x32e2
+	.uleb128 0x23
+	.long	0x19ce
+	.long	0x32f7
+	.uleb128 0x1c
+	.long	0x19c4
+	.uleb128 0x1c
+	.long	0x19ba
+	.uleb128 0x29
+	.long	0x1a24
+	.quad	.LBB685
+	.quad	.LBE685-.LBB685
+	.uleb128 0x21
+	.long	0x1a25
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x29
+	.long	0x1a30
+	.quad	.LBB686
+	.quad	.LBE686-.LBB686
+	.uleb128 0x21
+	.long	0x1a31
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x27
+	.long	0x1a69
+	.quad	.LBI687
+	.value	.LVU577
+	.long	.Ldebug_ranges0+0xf10
+	.byte	0x1
+	.byte	0x9d
+	.byte	0x11
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0x1e
+	.long	0x1abf
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x1e
+	.long	0x1ab4
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0x1e
+	.long	0x1aa9
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x1e
+	.long	0x1a9e
+	.long	.LLST269
+	.long	.LVUS269
+	.uleb128 0x1f
+	.long	0x1a94
+	.long	0x330c
+	.long	.LLST270
+	.long	.LVUS270
+	.uleb128 0x23
+	.long	0x1a8a
+	.long	0x3321
+	.uleb128 0x1e
+	.long	0x1a80
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x1e
+	.long	0x1a76
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x20
+	.long	0x1aca
+	.long	.Ldebug_ranges0+0xf10
+	.uleb128 0x21
+	.long	0x1acb
+	.long	.LLST273
+	.long	.LVUS273
+	.uleb128 0x29
+	.long	0x1ad5
+	.quad	.LBB689
+	.quad	.LBE689-.LBB689
+	.uleb128 0x21
+	.long	0x1ad6
+	.long	.LLST274
+	.long	.LVUS274
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3150
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3141
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3165
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3156
+	.uleb128 0xd
+	.long	0xad
+	.long	0x317a
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x316b
+	.uleb128 0xd
+	.long	0xad
+	.long	0x318f
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3180
+	.uleb128 0xd
+	.long	0xad
+	.long	0x31a4
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3195
+	.uleb128 0xd
+	.long	0xad
+	.long	0x31b9
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x31aa
+	.uleb128 0xd
+	.long	0xad
+	.long	0x31ce
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x31bf
+	.uleb128 0xd
+	.long	0xad
+	.long	0x31e3
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x31d4
+	.uleb128 0xd
+	.long	0xad
+	.long	0x31fc
+	.uleb128 0x17
+	.long	0x42
+	.long	0x376
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x31e9
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3215
+	.uleb128 0x17
+	.long	0x42
+	.long	0x383
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3202
+	.uleb128 0xd
+	.long	0xad
+	.long	0x322a
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x321b
+	.uleb128 0xd
+	.long	0xad
+	.long	0x323f
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3230
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3254
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3245
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3269
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x325a
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3282
+	.uleb128 0x17
+	.long	0x42
+	.long	0x390
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x326f
+	.uleb128 0xd
+	.long	0xad
+	.long	0x329b
+	.uleb128 0x17
+	.long	0x42
+	.long	0x39d
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3288
+	.uleb128 0xd
+	.long	0xad
+	.long	0x32b4
+	.uleb128 0x17
+	.long	0x42
+	.long	0x3aa
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x32a1
+	.uleb128 0xd
+	.long	0xad
+	.long	0x32cd
+	.uleb128 0x17
+	.long	0x42
+	.long	0x3b7
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x32ba
+	.uleb128 0xd
+	.long	0xad
+	.long	0x32e2
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x32d3
+	.uleb128 0xd
+	.long	0xad
+	.long	0x32f7
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x32e8
+	.uleb128 0xd
+	.long	0xad
+	.long	0x330c
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x32fd
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3321
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3312
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3336
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3327
+	.uleb128 0xd
+	.long	0xad
+	.long	0x334b
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x333c
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3360
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3351
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3375
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3366
+	.uleb128 0xd
+	.long	0xad
+	.long	0x338a
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x337b
+	.uleb128 0xd
+	.long	0xad
+	.long	0x339f
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3390
+	.uleb128 0xd
+	.long	0xad
+	.long	0x33b4
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x33a5
+	.uleb128 0xd
+	.long	0xad
+	.long	0x33c9
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x33ba
+	.uleb128 0xd
+	.long	0xad
+	.long	0x33e2
+	.uleb128 0x17
+	.long	0x42
+	.long	0xd5e
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x33cf
+	.uleb128 0xd
+	.long	0xad
+	.long	0x33fb
+	.uleb128 0x17
+	.long	0x42
+	.long	0xd6b
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x33e8
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3410
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3401
+	.uleb128 0xd
+	.long	0xad
+	.long	0x3425
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3416
+	.uleb128 0xd
+	.long	0xad
+	.long	0x343a
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x342b
+	.uleb128 0xd
+	.long	0xad
+	.long	0x344f
+	.uleb128 0xe
+	.long	0x42
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.long	0x3440
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1b
+	.uleb128 0xe
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x2117
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4109
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x410a
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x2111
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4109
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x2115
+	.uleb128 0x19
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x2117
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x4109
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x2117
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loc,"",@progbits
+.Ldebug_loc0:
+.LVUS210:
+	.uleb128 .LVU497
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST210:
+	.quad	.LVL174-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL177-.Ltext0
+	.quad	.LVL180-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL202-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL202-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL223-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL223-.Ltext0
+	.quad	.LVL226-.Ltext0
+	.value	0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL226-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL236-.Ltext0
+	.quad	.LVL237-.Ltext0
+	.value	0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS212:
+	.uleb128 .LVU497
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST212:
+	.quad	.LVL174-.Ltext0
+	.quad	.LVL178-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL178-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL194-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL198-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL198-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL203-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL203-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL214-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL218-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL218-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS228:
+	.uleb128 .LVU526
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU555
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST228:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL185-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL185-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS230:
+	.uleb128 .LVU526
+	.uleb128 .LVU555
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST230:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS249:
+	.uleb128 .LVU626
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST249:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS251:
+	.uleb128 .LVU626
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST251:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS257:
+	.uleb128 .LVU560
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+.LLST257:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS259:
+	.uleb128 .LVU560
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+.LLST259:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS93:
+	.uleb128 .LVU195
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST93:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL71-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL71-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS112:
+	.uleb128 .LVU221
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST112:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL86-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS114:
+	.uleb128 .LVU221
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST114:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL86-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS279:
+	.uleb128 0
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 0
+.LLST279:
+	.quad	.LVL239-.Ltext0
+	.quad	.LVL243-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL243-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	0
+	.quad	0
+.LVUS280:
+	.uleb128 0
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST280:
+	.quad	.LVL239-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	0
+	.quad	0
+.LVUS281:
+	.uleb128 0
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST281:
+	.quad	.LVL239-.Ltext0
+	.quad	.LVL242-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL242-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	0
+	.quad	0
+.LVUS282:
+	.uleb128 0
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST282:
+	.quad	.LVL239-.Ltext0
+	.quad	.LVL244-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL244-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	0
+	.quad	0
+.LVUS283:
+	.uleb128 0
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST283:
+	.quad	.LVL239-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -288
+	.quad	0
+	.quad	0
+.LVUS276:
+	.uleb128 .LVU658
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 0
+.LLST276:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL243-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL243-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS278:
+	.uleb128 .LVU658
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST278:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS284:
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+.LLST284:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL241-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -288
+	.quad	0
+	.quad	0
+.LVUS285:
+	.uleb128 .LVU661
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST285:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL244-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL244-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	0
+	.quad	0
+.LVUS286:
+	.uleb128 .LVU661
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST286:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL242-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL242-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	0
+	.quad	0
+.LVUS287:
+	.uleb128 .LVU661
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 0
+.LLST287:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL245-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	0
+	.quad	0
+.LVUS288:
+	.uleb128 .LVU661
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 0
+.LLST288:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL243-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL243-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	0
+	.quad	0
+.LVUS289:
+	.uleb128 .LVU662
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU872
+	.uleb128 .LVU872
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST289:
+	.quad	.LVL240-.Ltext0
+	.quad	.LVL245-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL245-.Ltext0
+	.quad	.LVL246-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL246-.Ltext0
+	.quad	.LVL315-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL315-.Ltext0
+	.quad	.LVL316-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL317-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS290:
+	.uleb128 .LVU678
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST290:
+	.quad	.LVL247-.Ltext0
+	.quad	.LVL248-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL248-.Ltext0
+	.quad	.LVL316-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS291:
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+.LLST291:
+	.quad	.LVL246-.Ltext0
+	.quad	.LVL246-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS292:
+	.uleb128 .LVU671
+	.uleb128 .LVU673
+.LLST292:
+	.quad	.LVL246-.Ltext0
+	.quad	.LVL246-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS293:
+	.uleb128 .LVU681
+	.uleb128 .LVU689
+	.uleb128 .LVU689
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU727
+	.uleb128 .LVU727
+	.uleb128 .LVU853
+	.uleb128 .LVU869
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU882
+	.uleb128 .LVU882
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 0
+.LLST293:
+	.quad	.LVL247-.Ltext0
+	.quad	.LVL248-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL248-.Ltext0
+	.quad	.LVL249-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL249-.Ltext0
+	.quad	.LVL255-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL255-.Ltext0
+	.quad	.LVL264-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL264-.Ltext0
+	.quad	.LVL310-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL314-.Ltext0
+	.quad	.LVL316-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL321-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL321-.Ltext0
+	.quad	.LVL323-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL323-.Ltext0
+	.quad	.LVL324-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL324-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL339-.Ltext0
+	.quad	.LVL354-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL354-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS294:
+	.uleb128 .LVU697
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU726
+	.uleb128 .LVU726
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU852
+	.uleb128 .LVU852
+	.uleb128 .LVU853
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU880
+	.uleb128 .LVU880
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 0
+.LLST294:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL252-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL252-.Ltext0
+	.quad	.LVL254-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL254-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL263-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL279-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL279-.Ltext0
+	.quad	.LVL309-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL309-.Ltext0
+	.quad	.LVL310-.Ltext0
+	.value	0x29
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x73
+	.sleb128 8
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x73
+	.sleb128 8
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL320-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL320-.Ltext0
+	.quad	.LVL322-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL322-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL338-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL338-.Ltext0
+	.quad	.LVL355-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL355-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS295:
+	.uleb128 .LVU820
+	.uleb128 .LVU869
+	.uleb128 .LVU947
+	.uleb128 .LVU956
+.LLST295:
+	.quad	.LVL299-.Ltext0
+	.quad	.LVL314-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL348-.Ltext0
+	.quad	.LVL353-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS296:
+	.uleb128 .LVU726
+	.uleb128 .LVU735
+	.uleb128 .LVU735
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU775
+	.uleb128 .LVU813
+	.uleb128 .LVU820
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU908
+	.uleb128 .LVU909
+	.uleb128 .LVU916
+.LLST296:
+	.quad	.LVL263-.Ltext0
+	.quad	.LVL265-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL280-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -96
+	.quad	.LVL296-.Ltext0
+	.quad	.LVL299-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL331-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL332-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS297:
+	.uleb128 .LVU726
+	.uleb128 .LVU735
+	.uleb128 .LVU735
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 .LVU811
+	.uleb128 .LVU811
+	.uleb128 .LVU818
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU909
+.LLST297:
+	.quad	.LVL263-.Ltext0
+	.quad	.LVL265-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL293-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL293-.Ltext0
+	.quad	.LVL295-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.quad	.LVL295-.Ltext0
+	.quad	.LVL299-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL332-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS298:
+	.uleb128 .LVU726
+	.uleb128 .LVU735
+	.uleb128 .LVU735
+	.uleb128 .LVU818
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+.LLST298:
+	.quad	.LVL263-.Ltext0
+	.quad	.LVL265-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL299-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS299:
+	.uleb128 .LVU741
+	.uleb128 .LVU809
+	.uleb128 .LVU809
+	.uleb128 .LVU817
+	.uleb128 .LVU817
+	.uleb128 .LVU818
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU909
+.LLST299:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL294-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL294-.Ltext0
+	.quad	.LVL298-.Ltext0
+	.value	0x8
+	.byte	0x75
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL298-.Ltext0
+	.quad	.LVL299-.Ltext0
+	.value	0x8
+	.byte	0x75
+	.sleb128 -64
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL332-.Ltext0
+	.value	0x8
+	.byte	0x75
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS300:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST300:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS301:
+	.uleb128 .LVU743
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU774
+	.uleb128 .LVU774
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST301:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL279-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL279-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	0
+	.quad	0
+.LVUS302:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST302:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS303:
+	.uleb128 .LVU743
+	.uleb128 .LVU746
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST303:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS304:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST304:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS305:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST305:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	0
+	.quad	0
+.LVUS306:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST306:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	0
+	.quad	0
+.LVUS307:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST307:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	0
+	.quad	0
+.LVUS308:
+	.uleb128 .LVU743
+	.uleb128 .LVU805
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST308:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	0
+	.quad	0
+.LVUS309:
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU766
+	.uleb128 .LVU777
+	.uleb128 .LVU797
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST309:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS310:
+	.uleb128 .LVU772
+	.uleb128 .LVU777
+	.uleb128 .LVU777
+	.uleb128 .LVU800
+	.uleb128 .LVU802
+	.uleb128 .LVU803
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST310:
+	.quad	.LVL278-.Ltext0
+	.quad	.LVL281-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL290-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL291-.Ltext0
+	.quad	.LVL292-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS311:
+	.uleb128 .LVU778
+	.uleb128 .LVU798
+.LLST311:
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS312:
+	.uleb128 .LVU778
+	.uleb128 .LVU798
+.LLST312:
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS313:
+	.uleb128 .LVU778
+	.uleb128 .LVU798
+.LLST313:
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS314:
+	.uleb128 .LVU778
+	.uleb128 .LVU798
+.LLST314:
+	.quad	.LVL281-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0xa
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS315:
+	.uleb128 .LVU782
+	.uleb128 .LVU789
+	.uleb128 .LVU789
+	.uleb128 .LVU798
+.LLST315:
+	.quad	.LVL282-.Ltext0
+	.quad	.LVL284-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL284-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS316:
+	.uleb128 .LVU784
+	.uleb128 .LVU798
+.LLST316:
+	.quad	.LVL283-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS317:
+	.uleb128 .LVU785
+	.uleb128 .LVU789
+	.uleb128 .LVU789
+	.uleb128 .LVU797
+.LLST317:
+	.quad	.LVL283-.Ltext0
+	.quad	.LVL284-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL284-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS318:
+	.uleb128 .LVU787
+	.uleb128 .LVU789
+	.uleb128 .LVU789
+	.uleb128 .LVU790
+	.uleb128 .LVU790
+	.uleb128 .LVU794
+	.uleb128 .LVU794
+	.uleb128 .LVU796
+	.uleb128 .LVU796
+	.uleb128 .LVU797
+.LLST318:
+	.quad	.LVL283-.Ltext0
+	.quad	.LVL284-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL284-.Ltext0
+	.quad	.LVL285-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL285-.Ltext0
+	.quad	.LVL287-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL287-.Ltext0
+	.quad	.LVL288-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL288-.Ltext0
+	.quad	.LVL289-.Ltext0
+	.value	0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS319:
+	.uleb128 .LVU744
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU769
+	.uleb128 .LVU771
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU775
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+.LLST319:
+	.quad	.LVL266-.Ltext0
+	.quad	.LVL267-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL276-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL277-.Ltext0
+	.quad	.LVL278-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL278-.Ltext0
+	.quad	.LVL280-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS320:
+	.uleb128 .LVU747
+	.uleb128 .LVU767
+.LLST320:
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS321:
+	.uleb128 .LVU747
+	.uleb128 .LVU767
+.LLST321:
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS322:
+	.uleb128 .LVU747
+	.uleb128 .LVU767
+.LLST322:
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS323:
+	.uleb128 .LVU747
+	.uleb128 .LVU767
+.LLST323:
+	.quad	.LVL267-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0xa
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS324:
+	.uleb128 .LVU751
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU767
+.LLST324:
+	.quad	.LVL268-.Ltext0
+	.quad	.LVL270-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL270-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS325:
+	.uleb128 .LVU753
+	.uleb128 .LVU767
+.LLST325:
+	.quad	.LVL269-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS326:
+	.uleb128 .LVU754
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU766
+.LLST326:
+	.quad	.LVL269-.Ltext0
+	.quad	.LVL270-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL270-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	0
+	.quad	0
+.LVUS327:
+	.uleb128 .LVU756
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU763
+	.uleb128 .LVU763
+	.uleb128 .LVU765
+	.uleb128 .LVU765
+	.uleb128 .LVU766
+.LLST327:
+	.quad	.LVL269-.Ltext0
+	.quad	.LVL270-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL270-.Ltext0
+	.quad	.LVL271-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL271-.Ltext0
+	.quad	.LVL273-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL273-.Ltext0
+	.quad	.LVL274-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL274-.Ltext0
+	.quad	.LVL275-.Ltext0
+	.value	0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS328:
+	.uleb128 .LVU736
+	.uleb128 .LVU741
+.LLST328:
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL266-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS329:
+	.uleb128 .LVU736
+	.uleb128 .LVU741
+.LLST329:
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL266-.Ltext0
+	.value	0xa
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS330:
+	.uleb128 .LVU738
+	.uleb128 .LVU818
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+.LLST330:
+	.quad	.LVL265-.Ltext0
+	.quad	.LVL299-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LVL318-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL330-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS331:
+	.uleb128 .LVU909
+	.uleb128 .LVU912
+	.uleb128 .LVU912
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU916
+.LLST331:
+	.quad	.LVL332-.Ltext0
+	.quad	.LVL333-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL333-.Ltext0
+	.quad	.LVL334-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL334-.Ltext0
+	.quad	.LVL335-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL335-.Ltext0
+	.quad	.LVL336-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS332:
+	.uleb128 .LVU823
+	.uleb128 .LVU824
+	.uleb128 .LVU824
+	.uleb128 .LVU845
+	.uleb128 .LVU845
+	.uleb128 .LVU846
+	.uleb128 .LVU846
+	.uleb128 .LVU851
+	.uleb128 .LVU947
+	.uleb128 .LVU956
+.LLST332:
+	.quad	.LVL299-.Ltext0
+	.quad	.LVL300-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL300-.Ltext0
+	.quad	.LVL305-.Ltext0
+	.value	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL305-.Ltext0
+	.quad	.LVL306-.Ltext0
+	.value	0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.quad	.LVL306-.Ltext0
+	.quad	.LVL308-.Ltext0
+	.value	0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL348-.Ltext0
+	.quad	.LVL353-.Ltext0
+	.value	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS333:
+	.uleb128 .LVU834
+	.uleb128 .LVU838
+	.uleb128 .LVU838
+	.uleb128 .LVU846
+	.uleb128 .LVU947
+	.uleb128 .LVU953
+	.uleb128 .LVU953
+	.uleb128 .LVU956
+.LLST333:
+	.quad	.LVL301-.Ltext0
+	.quad	.LVL302-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL302-.Ltext0
+	.quad	.LVL306-.Ltext0
+	.value	0x10
+	.byte	0x70
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x9f
+	.quad	.LVL348-.Ltext0
+	.quad	.LVL351-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL351-.Ltext0
+	.quad	.LVL353-.Ltext0
+	.value	0x10
+	.byte	0x70
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS334:
+	.uleb128 .LVU825
+	.uleb128 .LVU834
+.LLST334:
+	.quad	.LVL300-.Ltext0
+	.quad	.LVL301-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS335:
+	.uleb128 .LVU825
+	.uleb128 .LVU834
+.LLST335:
+	.quad	.LVL300-.Ltext0
+	.quad	.LVL301-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS336:
+	.uleb128 .LVU837
+	.uleb128 .LVU840
+	.uleb128 .LVU840
+	.uleb128 .LVU843
+	.uleb128 .LVU947
+	.uleb128 .LVU949
+	.uleb128 .LVU952
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 .LVU956
+.LLST336:
+	.quad	.LVL301-.Ltext0
+	.quad	.LVL303-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL303-.Ltext0
+	.quad	.LVL305-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL348-.Ltext0
+	.quad	.LVL349-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL350-.Ltext0
+	.quad	.LVL352-.Ltext0
+	.value	0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL352-.Ltext0
+	.quad	.LVL353-.Ltext0
+	.value	0x3
+	.byte	0x7b
+	.sleb128 1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS337:
+	.uleb128 .LVU847
+	.uleb128 .LVU853
+.LLST337:
+	.quad	.LVL307-.Ltext0
+	.quad	.LVL310-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS338:
+	.uleb128 .LVU853
+	.uleb128 .LVU856
+	.uleb128 .LVU856
+	.uleb128 .LVU864
+	.uleb128 .LVU864
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU869
+.LLST338:
+	.quad	.LVL310-.Ltext0
+	.quad	.LVL311-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL311-.Ltext0
+	.quad	.LVL312-.Ltext0
+	.value	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL312-.Ltext0
+	.quad	.LVL313-.Ltext0
+	.value	0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.quad	.LVL313-.Ltext0
+	.quad	.LVL314-.Ltext0
+	.value	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS339:
+	.uleb128 .LVU858
+	.uleb128 .LVU860
+.LLST339:
+	.quad	.LVL311-.Ltext0
+	.quad	.LVL311-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS340:
+	.uleb128 .LVU858
+	.uleb128 .LVU860
+.LLST340:
+	.quad	.LVL311-.Ltext0
+	.quad	.LVL311-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS341:
+	.uleb128 .LVU693
+	.uleb128 .LVU696
+	.uleb128 .LVU696
+	.uleb128 .LVU697
+.LLST341:
+	.quad	.LVL249-.Ltext0
+	.quad	.LVL250-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL250-.Ltext0
+	.quad	.LVL251-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	0
+	.quad	0
+.LVUS342:
+	.uleb128 .LVU693
+	.uleb128 .LVU697
+.LLST342:
+	.quad	.LVL249-.Ltext0
+	.quad	.LVL251-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS343:
+	.uleb128 .LVU701
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST343:
+	.quad	.LVL253-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x8
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x8
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x8
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x8
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS344:
+	.uleb128 .LVU699
+	.uleb128 .LVU700
+	.uleb128 .LVU700
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU880
+	.uleb128 .LVU880
+	.uleb128 .LVU884
+	.uleb128 .LVU884
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU918
+	.uleb128 .LVU918
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 0
+.LLST344:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL252-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL252-.Ltext0
+	.quad	.LVL254-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL254-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL320-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL320-.Ltext0
+	.quad	.LVL322-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL322-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL338-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL338-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL353-.Ltext0
+	.quad	.LVL355-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL355-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS345:
+	.uleb128 .LVU699
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU882
+	.uleb128 .LVU882
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU886
+	.uleb128 .LVU886
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 0
+.LLST345:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL255-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL255-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL321-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL321-.Ltext0
+	.quad	.LVL323-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL323-.Ltext0
+	.quad	.LVL324-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL324-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL353-.Ltext0
+	.quad	.LVL354-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL354-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS346:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST346:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS347:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST347:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS349:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST349:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -208
+	.quad	0
+	.quad	0
+.LVUS351:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST351:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	0
+	.quad	0
+.LVUS352:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST352:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -240
+	.quad	0
+	.quad	0
+.LVUS353:
+	.uleb128 .LVU699
+	.uleb128 .LVU726
+	.uleb128 .LVU878
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST353:
+	.quad	.LVL251-.Ltext0
+	.quad	.LVL263-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -248
+	.quad	0
+	.quad	0
+.LVUS354:
+	.uleb128 .LVU703
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU723
+	.uleb128 .LVU878
+	.uleb128 .LVU879
+	.uleb128 .LVU956
+	.uleb128 0
+.LLST354:
+	.quad	.LVL253-.Ltext0
+	.quad	.LVL256-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL256-.Ltext0
+	.quad	.LVL262-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL319-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL353-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS355:
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+	.uleb128 .LVU715
+	.uleb128 .LVU719
+	.uleb128 .LVU719
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU723
+.LLST355:
+	.quad	.LVL256-.Ltext0
+	.quad	.LVL258-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL259-.Ltext0
+	.quad	.LVL260-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL260-.Ltext0
+	.quad	.LVL261-1-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL261-1-.Ltext0
+	.quad	.LVL262-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS356:
+	.uleb128 .LVU712
+	.uleb128 .LVU715
+.LLST356:
+	.quad	.LVL259-.Ltext0
+	.quad	.LVL259-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS357:
+	.uleb128 .LVU712
+	.uleb128 .LVU715
+.LLST357:
+	.quad	.LVL259-.Ltext0
+	.quad	.LVL259-.Ltext0
+	.value	0xa
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS358:
+	.uleb128 .LVU706
+	.uleb128 .LVU711
+	.uleb128 .LVU714
+	.uleb128 .LVU723
+	.uleb128 .LVU878
+	.uleb128 .LVU886
+.LLST358:
+	.quad	.LVL256-.Ltext0
+	.quad	.LVL259-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL259-.Ltext0
+	.quad	.LVL262-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL318-.Ltext0
+	.quad	.LVL324-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS359:
+	.uleb128 .LVU880
+	.uleb128 .LVU882
+	.uleb128 .LVU882
+	.uleb128 .LVU885
+	.uleb128 .LVU885
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU917
+	.uleb128 .LVU956
+	.uleb128 .LVU959
+	.uleb128 .LVU959
+	.uleb128 0
+.LLST359:
+	.quad	.LVL320-.Ltext0
+	.quad	.LVL321-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL321-.Ltext0
+	.quad	.LVL323-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL323-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL337-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL353-.Ltext0
+	.quad	.LVL354-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL354-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS360:
+	.uleb128 .LVU886
+	.uleb128 .LVU890
+	.uleb128 .LVU895
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 .LVU901
+	.uleb128 .LVU901
+	.uleb128 .LVU903
+.LLST360:
+	.quad	.LVL324-.Ltext0
+	.quad	.LVL326-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL327-.Ltext0
+	.quad	.LVL328-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL328-.Ltext0
+	.quad	.LVL329-1-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL329-1-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS361:
+	.uleb128 .LVU892
+	.uleb128 .LVU895
+.LLST361:
+	.quad	.LVL327-.Ltext0
+	.quad	.LVL327-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS362:
+	.uleb128 .LVU892
+	.uleb128 .LVU895
+.LLST362:
+	.quad	.LVL327-.Ltext0
+	.quad	.LVL327-.Ltext0
+	.value	0xa
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS363:
+	.uleb128 .LVU886
+	.uleb128 .LVU891
+	.uleb128 .LVU894
+	.uleb128 .LVU903
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+.LLST363:
+	.quad	.LVL324-.Ltext0
+	.quad	.LVL327-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL327-.Ltext0
+	.quad	.LVL330-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	.LVL336-.Ltext0
+	.quad	.LVL339-.Ltext0
+	.value	0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS364:
+	.uleb128 .LVU919
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 .LVU947
+.LLST364:
+	.quad	.LVL339-.Ltext0
+	.quad	.LVL340-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL340-.Ltext0
+	.quad	.LVL348-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS365:
+	.uleb128 .LVU921
+	.uleb128 .LVU923
+	.uleb128 .LVU923
+	.uleb128 .LVU928
+	.uleb128 .LVU928
+	.uleb128 .LVU931
+	.uleb128 .LVU931
+	.uleb128 .LVU933
+	.uleb128 .LVU942
+	.uleb128 .LVU947
+.LLST365:
+	.quad	.LVL340-.Ltext0
+	.quad	.LVL341-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL341-.Ltext0
+	.quad	.LVL342-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL342-.Ltext0
+	.quad	.LVL343-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL343-.Ltext0
+	.quad	.LVL344-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL346-.Ltext0
+	.quad	.LVL348-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS348:
+	.uleb128 .LVU701
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST348:
+	.quad	.LVL253-.Ltext0
+	.quad	.LVL316-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -240
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS350:
+	.uleb128 .LVU701
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 0
+.LLST350:
+	.quad	.LVL253-.Ltext0
+	.quad	.LVL316-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL317-.Ltext0
+	.quad	.LFE25-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS201:
+	.uleb128 .LVU480
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST201:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL170-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL170-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS203:
+	.uleb128 .LVU480
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST203:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL168-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL168-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS383:
+	.uleb128 0
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST383:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS384:
+	.uleb128 0
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST384:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS385:
+	.uleb128 0
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST385:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS386:
+	.uleb128 0
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST386:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS387:
+	.uleb128 0
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 0
+.LLST387:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL376-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL376-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS380:
+	.uleb128 .LVU1014
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST380:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS382:
+	.uleb128 .LVU1014
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 0
+.LLST382:
+	.quad	.LVL375-.Ltext0
+	.quad	.LVL377-1-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL377-1-.Ltext0
+	.quad	.LFE23-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS55:
+	.uleb128 .LVU137
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST55:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS57:
+	.uleb128 .LVU137
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST57:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL51-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL51-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS63:
+	.uleb128 .LVU141
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST63:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL51-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL51-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS65:
+	.uleb128 .LVU141
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST65:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS83:
+	.uleb128 .LVU164
+	.uleb128 .LVU193
+.LLST83:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS85:
+	.uleb128 .LVU164
+	.uleb128 .LVU193
+.LLST85:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST46:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST47:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST48:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST49:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS50:
+	.uleb128 .LVU109
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST50:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL46-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS51:
+	.uleb128 .LVU113
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+.LLST51:
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL40-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL40-.Ltext0
+	.quad	.LVL41-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL41-.Ltext0
+	.quad	.LVL42-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL42-.Ltext0
+	.quad	.LVL44-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL44-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS52:
+	.uleb128 .LVU120
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+.LLST52:
+	.quad	.LVL40-.Ltext0
+	.quad	.LVL45-.Ltext0
+	.value	0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL45-.Ltext0
+	.quad	.LVL46-.Ltext0
+	.value	0x5
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS53:
+	.uleb128 .LVU121
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU135
+.LLST53:
+	.quad	.LVL40-.Ltext0
+	.quad	.LVL41-.Ltext0
+	.value	0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL41-.Ltext0
+	.quad	.LVL42-.Ltext0
+	.value	0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.quad	.LVL42-.Ltext0
+	.quad	.LVL43-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL43-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x5
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS43:
+	.uleb128 .LVU105
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST43:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x3
+	.byte	0x79
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS45:
+	.uleb128 .LVU105
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST45:
+	.quad	.LVL38-.Ltext0
+	.quad	.LVL39-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL39-.Ltext0
+	.quad	.LVL47-.Ltext0
+	.value	0x3
+	.byte	0x7a
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL47-.Ltext0
+	.quad	.LFE21-.Ltext0
+	.value	0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST36:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL32-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL32-.Ltext0
+	.quad	.LFE20-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST37:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL32-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL32-.Ltext0
+	.quad	.LFE20-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST38:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL32-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL32-.Ltext0
+	.quad	.LFE20-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST39:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL31-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL31-.Ltext0
+	.quad	.LFE20-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS40:
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU102
+.LLST40:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL32-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL32-.Ltext0
+	.quad	.LVL37-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS41:
+	.uleb128 .LVU92
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+.LLST41:
+	.quad	.LVL32-.Ltext0
+	.quad	.LVL33-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL33-.Ltext0
+	.quad	.LVL34-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL34-.Ltext0
+	.quad	.LVL35-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL35-.Ltext0
+	.quad	.LVL37-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS34:
+	.uleb128 .LVU84
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST34:
+	.quad	.LVL30-.Ltext0
+	.quad	.LVL32-.Ltext0
+	.value	0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL32-.Ltext0
+	.quad	.LFE20-.Ltext0
+	.value	0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS369:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 0
+.LLST369:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL357-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -88
+	.quad	0
+	.quad	0
+.LVUS370:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 0
+.LLST370:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL357-.Ltext0
+	.quad	.LVL364-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL364-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS371:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 0
+.LLST371:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL357-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS372:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 0
+.LLST372:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL357-.Ltext0
+	.quad	.LVL365-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL365-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS373:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 0
+.LLST373:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL357-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS374:
+	.uleb128 0
+	.uleb128 .LVU963
+	.uleb128 .LVU963
+	.uleb128 .LVU1009
+	.uleb128 .LVU1009
+	.uleb128 .LVU1010
+	.uleb128 .LVU1010
+	.uleb128 0
+.LLST374:
+	.quad	.LVL356-.Ltext0
+	.quad	.LVL357-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL357-.Ltext0
+	.quad	.LVL372-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL372-.Ltext0
+	.quad	.LVL373-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.quad	.LVL373-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS376:
+	.uleb128 .LVU986
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU988
+.LLST376:
+	.quad	.LVL361-.Ltext0
+	.quad	.LVL362-1-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL362-1-.Ltext0
+	.quad	.LVL363-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	0
+	.quad	0
+.LVUS375:
+	.uleb128 .LVU974
+	.uleb128 .LVU975
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+.LLST375:
+	.quad	.LVL358-.Ltext0
+	.quad	.LVL359-1-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL359-1-.Ltext0
+	.quad	.LVL360-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	0
+	.quad	0
+.LVUS368:
+	.uleb128 .LVU963
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 0
+.LLST368:
+	.quad	.LVL357-.Ltext0
+	.quad	.LVL364-.Ltext0
+	.value	0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL364-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS377:
+	.uleb128 .LVU988
+	.uleb128 .LVU1008
+	.uleb128 .LVU1010
+	.uleb128 0
+.LLST377:
+	.quad	.LVL363-.Ltext0
+	.quad	.LVL371-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL373-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS378:
+	.uleb128 .LVU990
+	.uleb128 .LVU993
+	.uleb128 .LVU993
+	.uleb128 .LVU997
+	.uleb128 .LVU997
+	.uleb128 .LVU999
+	.uleb128 .LVU999
+	.uleb128 .LVU1006
+	.uleb128 .LVU1010
+	.uleb128 0
+.LLST378:
+	.quad	.LVL365-.Ltext0
+	.quad	.LVL366-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL366-.Ltext0
+	.quad	.LVL367-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL367-.Ltext0
+	.quad	.LVL368-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL368-.Ltext0
+	.quad	.LVL370-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL373-.Ltext0
+	.quad	.LFE19-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS1:
+	.uleb128 .LVU4
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST1:
+	.quad	.LVL2-.Ltext0
+	.quad	.LVL5-.Ltext0
+	.value	0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL5-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL28-.Ltext0
+	.quad	.LVL29-.Ltext0
+	.value	0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL29-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS3:
+	.uleb128 .LVU4
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST3:
+	.quad	.LVL2-.Ltext0
+	.quad	.LVL3-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL3-.Ltext0
+	.quad	.LVL8-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x6
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS4:
+	.uleb128 .LVU4
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 0
+.LLST4:
+	.quad	.LVL2-.Ltext0
+	.quad	.LVL7-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL7-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL18-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL18-.Ltext0
+	.quad	.LVL26-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.quad	.LVL26-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x5a
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST5:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL1-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL1-.Ltext0
+	.quad	.LVL5-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL5-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL28-.Ltext0
+	.quad	.LVL29-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL29-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST6:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL3-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL3-.Ltext0
+	.quad	.LVL8-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST7:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL6-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL6-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST8:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL4-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL4-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -88
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	0
+	.quad	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST9:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST10:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL17-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL17-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	0
+	.quad	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST11:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL28-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 16
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST12:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 24
+	.quad	.LVL16-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST13:
+	.quad	.LVL0-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 32
+	.quad	.LVL14-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS14:
+	.uleb128 .LVU5
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+	.uleb128 .LVU74
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST14:
+	.quad	.LVL2-.Ltext0
+	.quad	.LVL8-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS15:
+	.uleb128 .LVU7
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU45
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST15:
+	.quad	.LVL2-.Ltext0
+	.quad	.LVL8-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL16-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL28-.Ltext0
+	.quad	.LFE13-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS16:
+	.uleb128 .LVU21
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU42
+.LLST16:
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 32
+	.quad	.LVL14-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS17:
+	.uleb128 .LVU21
+	.uleb128 .LVU42
+.LLST17:
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 24
+	.byte	0x6
+	.byte	0x91
+	.sleb128 16
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS18:
+	.uleb128 .LVU21
+	.uleb128 .LVU42
+.LLST18:
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	0
+	.quad	0
+.LVUS19:
+	.uleb128 .LVU21
+	.uleb128 .LVU42
+.LLST19:
+	.quad	.LVL8-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS20:
+	.uleb128 .LVU26
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU42
+.LLST20:
+	.quad	.LVL9-.Ltext0
+	.quad	.LVL11-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL11-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS21:
+	.uleb128 .LVU28
+	.uleb128 .LVU42
+.LLST21:
+	.quad	.LVL10-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS22:
+	.uleb128 .LVU29
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU41
+.LLST22:
+	.quad	.LVL10-.Ltext0
+	.quad	.LVL11-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL11-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS23:
+	.uleb128 .LVU31
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU42
+.LLST23:
+	.quad	.LVL10-.Ltext0
+	.quad	.LVL12-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL12-.Ltext0
+	.quad	.LVL13-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL13-.Ltext0
+	.quad	.LVL14-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS24:
+	.uleb128 .LVU45
+	.uleb128 .LVU80
+.LLST24:
+	.quad	.LVL16-.Ltext0
+	.quad	.LVL27-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS25:
+	.uleb128 .LVU53
+	.uleb128 .LVU75
+.LLST25:
+	.quad	.LVL18-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS26:
+	.uleb128 .LVU53
+	.uleb128 .LVU75
+.LLST26:
+	.quad	.LVL18-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 8
+	.byte	0x6
+	.byte	0x91
+	.sleb128 0
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS27:
+	.uleb128 .LVU53
+	.uleb128 .LVU75
+.LLST27:
+	.quad	.LVL18-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS28:
+	.uleb128 .LVU53
+	.uleb128 .LVU75
+.LLST28:
+	.quad	.LVL18-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS29:
+	.uleb128 .LVU58
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU75
+.LLST29:
+	.quad	.LVL19-.Ltext0
+	.quad	.LVL21-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL21-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS30:
+	.uleb128 .LVU60
+	.uleb128 .LVU75
+.LLST30:
+	.quad	.LVL20-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS31:
+	.uleb128 .LVU61
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU74
+.LLST31:
+	.quad	.LVL20-.Ltext0
+	.quad	.LVL21-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL21-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS32:
+	.uleb128 .LVU63
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU75
+.LLST32:
+	.quad	.LVL20-.Ltext0
+	.quad	.LVL22-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL22-.Ltext0
+	.quad	.LVL23-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL23-.Ltext0
+	.quad	.LVL24-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST58:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST59:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL51-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL51-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST60:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL50-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL50-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST61:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST62:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL49-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL49-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS64:
+	.uleb128 .LVU140
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST64:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS66:
+	.uleb128 .LVU140
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST66:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL50-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL50-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS67:
+	.uleb128 .LVU140
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST67:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL51-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL51-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS68:
+	.uleb128 .LVU140
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST68:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS69:
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST69:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS70:
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST70:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL50-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL50-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS71:
+	.uleb128 .LVU142
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST71:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL51-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL51-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS72:
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST72:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS73:
+	.uleb128 .LVU143
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 0
+.LLST73:
+	.quad	.LVL48-.Ltext0
+	.quad	.LVL52-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL53-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL53-.Ltext0
+	.quad	.LVL64-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL64-.Ltext0
+	.quad	.LVL65-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL67-.Ltext0
+	.quad	.LFE22-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS74:
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST74:
+	.quad	.LVL52-.Ltext0
+	.quad	.LVL54-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL54-.Ltext0
+	.quad	.LVL55-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL55-.Ltext0
+	.quad	.LVL57-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL57-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.quad	.LVL63-.Ltext0
+	.quad	.LVL65-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS75:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+.LLST75:
+	.quad	.LVL54-.Ltext0
+	.quad	.LVL54-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	0
+	.quad	0
+.LVUS76:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+.LLST76:
+	.quad	.LVL54-.Ltext0
+	.quad	.LVL54-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS77:
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST77:
+	.quad	.LVL55-.Ltext0
+	.quad	.LVL56-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS78:
+	.uleb128 .LVU159
+	.uleb128 .LVU162
+.LLST78:
+	.quad	.LVL55-.Ltext0
+	.quad	.LVL56-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS79:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST79:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x2a
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x2a
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS80:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST80:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	0
+	.quad	0
+.LVUS81:
+	.uleb128 .LVU162
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST81:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL57-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL57-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -168
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -168
+	.quad	0
+	.quad	0
+.LVUS82:
+	.uleb128 .LVU162
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST82:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL57-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL57-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS84:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST84:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS86:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST86:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	0
+	.quad	0
+.LVUS87:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST87:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS88:
+	.uleb128 .LVU162
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST88:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	0
+	.quad	0
+.LVUS89:
+	.uleb128 .LVU166
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST89:
+	.quad	.LVL56-.Ltext0
+	.quad	.LVL63-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS90:
+	.uleb128 .LVU167
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU177
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST90:
+	.quad	.LVL57-.Ltext0
+	.quad	.LVL58-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL58-.Ltext0
+	.quad	.LVL59-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL59-.Ltext0
+	.quad	.LVL60-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL60-.Ltext0
+	.quad	.LVL61-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL65-.Ltext0
+	.quad	.LVL67-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST94:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL71-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL71-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST95:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL69-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL69-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST96:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL70-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL70-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST97:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL72-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL72-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS98:
+	.uleb128 .LVU198
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST98:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL70-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL70-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS99:
+	.uleb128 .LVU198
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST99:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL69-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL69-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS100:
+	.uleb128 .LVU198
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST100:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL71-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL71-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS101:
+	.uleb128 .LVU198
+	.uleb128 0
+.LLST101:
+	.quad	.LVL68-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS102:
+	.uleb128 .LVU199
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST102:
+	.quad	.LVL68-.Ltext0
+	.quad	.LVL73-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL74-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL74-.Ltext0
+	.quad	.LVL75-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL75-.Ltext0
+	.quad	.LVL85-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL85-.Ltext0
+	.quad	.LVL86-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL89-.Ltext0
+	.quad	.LFE26-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS103:
+	.uleb128 .LVU206
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST103:
+	.quad	.LVL73-.Ltext0
+	.quad	.LVL75-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL75-.Ltext0
+	.quad	.LVL76-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL76-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL84-.Ltext0
+	.quad	.LVL86-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	0
+	.quad	0
+.LVUS104:
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST104:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL77-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	0
+	.quad	0
+.LVUS105:
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST105:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL77-.Ltext0
+	.value	0x3
+	.byte	0x72
+	.sleb128 32
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS106:
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+.LLST106:
+	.quad	.LVL76-.Ltext0
+	.quad	.LVL77-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS107:
+	.uleb128 .LVU213
+	.uleb128 .LVU216
+.LLST107:
+	.quad	.LVL76-.Ltext0
+	.quad	.LVL77-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS108:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST108:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS109:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST109:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	0
+	.quad	0
+.LVUS110:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST110:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x26
+	.byte	0x72
+	.sleb128 32
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x26
+	.byte	0x72
+	.sleb128 32
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS111:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST111:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS113:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST113:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS115:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST115:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS116:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST116:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -72
+	.quad	0
+	.quad	0
+.LVUS117:
+	.uleb128 .LVU219
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST117:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS118:
+	.uleb128 .LVU223
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU245
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST118:
+	.quad	.LVL77-.Ltext0
+	.quad	.LVL78-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL78-.Ltext0
+	.quad	.LVL84-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	0
+	.quad	0
+.LVUS119:
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+.LLST119:
+	.quad	.LVL78-.Ltext0
+	.quad	.LVL79-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL79-.Ltext0
+	.quad	.LVL80-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL80-.Ltext0
+	.quad	.LVL81-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL81-.Ltext0
+	.quad	.LVL82-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL87-.Ltext0
+	.quad	.LVL89-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS120:
+	.uleb128 0
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 0
+.LLST120:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL92-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL92-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS121:
+	.uleb128 0
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST121:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL94-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	.LVL149-.Ltext0
+	.quad	.LVL150-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	0
+	.quad	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 0
+.LLST122:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL91-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL91-.Ltext0
+	.quad	.LVL93-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL93-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL94-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 0
+.LLST123:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL94-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU267
+.LLST124:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	0
+	.quad	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU267
+.LLST125:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	0
+	.quad	0
+.LVUS126:
+	.uleb128 .LVU256
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST126:
+	.quad	.LVL90-.Ltext0
+	.quad	.LVL94-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL94-.Ltext0
+	.quad	.LVL95-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL95-.Ltext0
+	.quad	.LVL97-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL97-.Ltext0
+	.quad	.LVL148-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL148-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS127:
+	.uleb128 .LVU275
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST127:
+	.quad	.LVL96-.Ltext0
+	.quad	.LVL98-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL98-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS128:
+	.uleb128 .LVU270
+	.uleb128 .LVU275
+.LLST128:
+	.quad	.LVL95-.Ltext0
+	.quad	.LVL96-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS129:
+	.uleb128 .LVU270
+	.uleb128 .LVU275
+.LLST129:
+	.quad	.LVL95-.Ltext0
+	.quad	.LVL96-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS130:
+	.uleb128 .LVU278
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST130:
+	.quad	.LVL96-.Ltext0
+	.quad	.LVL98-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL98-.Ltext0
+	.quad	.LVL99-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -168
+	.quad	.LVL99-.Ltext0
+	.quad	.LVL101-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL101-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL147-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -168
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS131:
+	.uleb128 .LVU293
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST131:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS132:
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST132:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS133:
+	.uleb128 .LVU296
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST133:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL101-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL101-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS134:
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST134:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS135:
+	.uleb128 .LVU296
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST135:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS136:
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST136:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS138:
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST138:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS140:
+	.uleb128 .LVU296
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST140:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	0
+	.quad	0
+.LVUS141:
+	.uleb128 .LVU296
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST141:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS142:
+	.uleb128 .LVU296
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST142:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	0
+	.quad	0
+.LVUS143:
+	.uleb128 .LVU393
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU458
+.LLST143:
+	.quad	.LVL131-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL156-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS144:
+	.uleb128 .LVU298
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST144:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2d
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS145:
+	.uleb128 .LVU298
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST145:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL101-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL101-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS146:
+	.uleb128 .LVU298
+	.uleb128 .LVU308
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST146:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS147:
+	.uleb128 .LVU298
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST147:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL156-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS148:
+	.uleb128 .LVU298
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST148:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 8
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS149:
+	.uleb128 .LVU298
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST149:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS150:
+	.uleb128 .LVU298
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST150:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	.LVL156-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	0
+	.quad	0
+.LVUS151:
+	.uleb128 .LVU298
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST151:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL156-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS152:
+	.uleb128 .LVU298
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST152:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	.LVL156-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	0
+	.quad	0
+.LVUS153:
+	.uleb128 .LVU299
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU393
+	.uleb128 .LVU458
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST153:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -176
+	.quad	.LVL131-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL160-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -176
+	.quad	.LVL160-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS154:
+	.uleb128 .LVU299
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU390
+	.uleb128 .LVU458
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 .LVU470
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST154:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL126-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL126-.Ltext0
+	.quad	.LVL127-.Ltext0
+	.value	0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.quad	.LVL127-.Ltext0
+	.quad	.LVL130-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL159-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL159-.Ltext0
+	.quad	.LVL160-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS155:
+	.uleb128 .LVU299
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU464
+	.uleb128 .LVU477
+	.uleb128 0
+.LLST155:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL102-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL158-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL164-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS156:
+	.uleb128 .LVU316
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+.LLST156:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS157:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST157:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS158:
+	.uleb128 .LVU318
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU350
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST158:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL104-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL114-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS159:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST159:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	0
+	.quad	0
+.LVUS160:
+	.uleb128 .LVU318
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU377
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST160:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL116-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -216
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS161:
+	.uleb128 .LVU318
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST161:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL104-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS162:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST162:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 0
+	.quad	0
+	.quad	0
+.LVUS163:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST163:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -104
+	.quad	0
+	.quad	0
+.LVUS164:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST164:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS165:
+	.uleb128 .LVU318
+	.uleb128 .LVU379
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST165:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -160
+	.quad	0
+	.quad	0
+.LVUS166:
+	.uleb128 .LVU319
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU344
+	.uleb128 .LVU353
+	.uleb128 .LVU373
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST166:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL104-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS167:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU377
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST167:
+	.quad	.LVL113-.Ltext0
+	.quad	.LVL116-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL125-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	0
+	.quad	0
+.LVUS168:
+	.uleb128 .LVU354
+	.uleb128 .LVU374
+.LLST168:
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS169:
+	.uleb128 .LVU354
+	.uleb128 .LVU374
+.LLST169:
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS170:
+	.uleb128 .LVU354
+	.uleb128 .LVU374
+.LLST170:
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	0
+	.quad	0
+.LVUS171:
+	.uleb128 .LVU354
+	.uleb128 .LVU374
+.LLST171:
+	.quad	.LVL116-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0xa
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS172:
+	.uleb128 .LVU359
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU374
+.LLST172:
+	.quad	.LVL117-.Ltext0
+	.quad	.LVL119-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL119-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x5
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS173:
+	.uleb128 .LVU361
+	.uleb128 .LVU374
+.LLST173:
+	.quad	.LVL118-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS174:
+	.uleb128 .LVU362
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU373
+.LLST174:
+	.quad	.LVL118-.Ltext0
+	.quad	.LVL119-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL119-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS175:
+	.uleb128 .LVU364
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+.LLST175:
+	.quad	.LVL118-.Ltext0
+	.quad	.LVL119-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL119-.Ltext0
+	.quad	.LVL120-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL120-.Ltext0
+	.quad	.LVL122-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL122-.Ltext0
+	.quad	.LVL123-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS176:
+	.uleb128 .LVU319
+	.uleb128 .LVU352
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+.LLST176:
+	.quad	.LVL103-.Ltext0
+	.quad	.LVL115-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL157-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	0
+	.quad	0
+.LVUS177:
+	.uleb128 .LVU324
+	.uleb128 .LVU345
+.LLST177:
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS178:
+	.uleb128 .LVU324
+	.uleb128 .LVU345
+.LLST178:
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS179:
+	.uleb128 .LVU324
+	.uleb128 .LVU345
+.LLST179:
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	0
+	.quad	0
+.LVUS180:
+	.uleb128 .LVU324
+	.uleb128 .LVU345
+.LLST180:
+	.quad	.LVL104-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0xa
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS181:
+	.uleb128 .LVU329
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU345
+.LLST181:
+	.quad	.LVL105-.Ltext0
+	.quad	.LVL107-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL107-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x5
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS182:
+	.uleb128 .LVU331
+	.uleb128 .LVU345
+.LLST182:
+	.quad	.LVL106-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS183:
+	.uleb128 .LVU332
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU344
+.LLST183:
+	.quad	.LVL106-.Ltext0
+	.quad	.LVL107-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL107-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS184:
+	.uleb128 .LVU334
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU344
+.LLST184:
+	.quad	.LVL106-.Ltext0
+	.quad	.LVL107-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL107-.Ltext0
+	.quad	.LVL108-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL108-.Ltext0
+	.quad	.LVL110-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL110-.Ltext0
+	.quad	.LVL111-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS185:
+	.uleb128 .LVU309
+	.uleb128 .LVU316
+.LLST185:
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL103-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -224
+	.quad	0
+	.quad	0
+.LVUS186:
+	.uleb128 .LVU309
+	.uleb128 .LVU316
+.LLST186:
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL103-.Ltext0
+	.value	0xa
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.quad	0
+	.quad	0
+.LVUS187:
+	.uleb128 .LVU311
+	.uleb128 .LVU391
+	.uleb128 .LVU458
+	.uleb128 .LVU477
+.LLST187:
+	.quad	.LVL102-.Ltext0
+	.quad	.LVL131-.Ltext0
+	.value	0x2
+	.byte	0x4f
+	.byte	0x9f
+	.quad	.LVL156-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x2
+	.byte	0x4f
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS188:
+	.uleb128 .LVU470
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU477
+.LLST188:
+	.quad	.LVL160-.Ltext0
+	.quad	.LVL161-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL161-.Ltext0
+	.quad	.LVL162-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL162-.Ltext0
+	.quad	.LVL163-.Ltext0
+	.value	0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL163-.Ltext0
+	.quad	.LVL164-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS189:
+	.uleb128 .LVU396
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 .LVU418
+	.uleb128 .LVU445
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU457
+.LLST189:
+	.quad	.LVL131-.Ltext0
+	.quad	.LVL132-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL132-.Ltext0
+	.quad	.LVL137-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL137-.Ltext0
+	.quad	.LVL138-.Ltext0
+	.value	0xa
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.quad	.LVL138-.Ltext0
+	.quad	.LVL139-.Ltext0
+	.value	0x8
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL154-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL154-.Ltext0
+	.quad	.LVL155-.Ltext0
+	.value	0xa
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS190:
+	.uleb128 .LVU406
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 .LVU417
+	.uleb128 .LVU445
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU452
+.LLST190:
+	.quad	.LVL133-.Ltext0
+	.quad	.LVL134-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL134-.Ltext0
+	.quad	.LVL138-.Ltext0
+	.value	0x10
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL153-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL153-.Ltext0
+	.quad	.LVL154-.Ltext0
+	.value	0x10
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS191:
+	.uleb128 .LVU398
+	.uleb128 .LVU406
+.LLST191:
+	.quad	.LVL132-.Ltext0
+	.quad	.LVL133-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS192:
+	.uleb128 .LVU398
+	.uleb128 .LVU406
+.LLST192:
+	.quad	.LVL132-.Ltext0
+	.quad	.LVL133-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS193:
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU414
+	.uleb128 .LVU445
+	.uleb128 .LVU446
+	.uleb128 .LVU449
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU458
+.LLST193:
+	.quad	.LVL133-.Ltext0
+	.quad	.LVL135-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL135-.Ltext0
+	.quad	.LVL137-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL150-.Ltext0
+	.quad	.LVL151-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL152-.Ltext0
+	.quad	.LVL155-.Ltext0
+	.value	0x8
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL155-.Ltext0
+	.quad	.LVL156-.Ltext0
+	.value	0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS194:
+	.uleb128 .LVU419
+	.uleb128 .LVU423
+	.uleb128 .LVU423
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU439
+.LLST194:
+	.quad	.LVL140-.Ltext0
+	.quad	.LVL141-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -232
+	.quad	.LVL141-.Ltext0
+	.quad	.LVL145-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL145-.Ltext0
+	.quad	.LVL146-.Ltext0
+	.value	0xa
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.quad	.LVL146-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x8
+	.byte	0x79
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS195:
+	.uleb128 .LVU423
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU439
+.LLST195:
+	.quad	.LVL141-.Ltext0
+	.quad	.LVL142-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL142-.Ltext0
+	.quad	.LVL143-.Ltext0
+	.value	0x8
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.quad	.LVL143-.Ltext0
+	.quad	.LVL144-.Ltext0
+	.value	0xa
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.quad	.LVL144-.Ltext0
+	.quad	.LVL147-.Ltext0
+	.value	0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS196:
+	.uleb128 .LVU428
+	.uleb128 .LVU430
+.LLST196:
+	.quad	.LVL142-.Ltext0
+	.quad	.LVL142-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS197:
+	.uleb128 .LVU428
+	.uleb128 .LVU430
+.LLST197:
+	.quad	.LVL142-.Ltext0
+	.quad	.LVL142-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS198:
+	.uleb128 .LVU290
+	.uleb128 .LVU293
+.LLST198:
+	.quad	.LVL99-.Ltext0
+	.quad	.LVL100-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS199:
+	.uleb128 .LVU290
+	.uleb128 .LVU293
+.LLST199:
+	.quad	.LVL99-.Ltext0
+	.quad	.LVL100-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS137:
+	.uleb128 .LVU297
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST137:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS139:
+	.uleb128 .LVU297
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 0
+.LLST139:
+	.quad	.LVL100-.Ltext0
+	.quad	.LVL149-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL150-.Ltext0
+	.quad	.LFE37-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS204:
+	.uleb128 0
+	.uleb128 .LVU490
+	.uleb128 .LVU490
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST204:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL170-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL170-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS205:
+	.uleb128 0
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST205:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL168-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL168-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS206:
+	.uleb128 0
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST206:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL166-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL166-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS207:
+	.uleb128 0
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST207:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL169-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL169-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 -32
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS208:
+	.uleb128 0
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 0
+.LLST208:
+	.quad	.LVL165-.Ltext0
+	.quad	.LVL167-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL167-.Ltext0
+	.quad	.LVL171-1-.Ltext0
+	.value	0x2
+	.byte	0x91
+	.sleb128 -24
+	.quad	.LVL171-1-.Ltext0
+	.quad	.LFE24-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS213:
+	.uleb128 0
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST213:
+	.quad	.LVL172-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL177-.Ltext0
+	.quad	.LVL180-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL202-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL202-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL223-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL223-.Ltext0
+	.quad	.LVL226-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL226-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL236-.Ltext0
+	.quad	.LVL237-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS214:
+	.uleb128 0
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 0
+.LLST214:
+	.quad	.LVL172-.Ltext0
+	.quad	.LVL178-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL178-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL194-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL198-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL198-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL203-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL203-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL214-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL218-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL218-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS215:
+	.uleb128 0
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 0
+.LLST215:
+	.quad	.LVL172-.Ltext0
+	.quad	.LVL173-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL173-.Ltext0
+	.quad	.LVL180-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL214-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL223-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL223-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS216:
+	.uleb128 0
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 0
+.LLST216:
+	.quad	.LVL172-.Ltext0
+	.quad	.LVL179-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL179-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL197-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL197-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL214-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL219-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL219-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS217:
+	.uleb128 0
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 0
+.LLST217:
+	.quad	.LVL172-.Ltext0
+	.quad	.LVL180-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL195-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL195-.Ltext0
+	.quad	.LVL199-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL199-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -200
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL201-.Ltext0
+	.quad	.LVL204-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL221-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL221-.Ltext0
+	.quad	.LVL222-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL222-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS218:
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+	.uleb128 .LVU604
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 0
+.LLST218:
+	.quad	.LVL175-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL221-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL221-.Ltext0
+	.quad	.LVL222-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL222-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS219:
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+	.uleb128 .LVU604
+	.uleb128 .LVU606
+	.uleb128 .LVU606
+	.uleb128 0
+.LLST219:
+	.quad	.LVL175-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL219-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL219-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS220:
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+	.uleb128 .LVU604
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 0
+.LLST220:
+	.quad	.LVL175-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL220-.Ltext0
+	.value	0x1
+	.byte	0x53
+	.quad	.LVL220-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS221:
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+	.uleb128 .LVU604
+	.uleb128 .LVU611
+	.uleb128 .LVU611
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST221:
+	.quad	.LVL175-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL217-.Ltext0
+	.quad	.LVL223-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL223-.Ltext0
+	.quad	.LVL226-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL226-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL236-.Ltext0
+	.quad	.LVL237-.Ltext0
+	.value	0x1
+	.byte	0x5c
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS222:
+	.uleb128 .LVU504
+	.uleb128 .LVU505
+	.uleb128 .LVU508
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST222:
+	.quad	.LVL176-.Ltext0
+	.quad	.LVL177-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL181-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL181-.Ltext0
+	.quad	.LVL193-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL193-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x3
+	.byte	0x78
+	.sleb128 8
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS223:
+	.uleb128 .LVU508
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU521
+	.uleb128 .LVU521
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU555
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST223:
+	.quad	.LVL180-.Ltext0
+	.quad	.LVL182-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL182-.Ltext0
+	.quad	.LVL183-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL183-.Ltext0
+	.quad	.LVL186-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL186-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL192-.Ltext0
+	.quad	.LVL194-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS224:
+	.uleb128 .LVU524
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST224:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x26
+	.byte	0x78
+	.sleb128 8
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x26
+	.byte	0x78
+	.sleb128 8
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS225:
+	.uleb128 .LVU524
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST225:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	0
+	.quad	0
+.LVUS226:
+	.uleb128 .LVU524
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST226:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	0
+	.quad	0
+.LVUS227:
+	.uleb128 .LVU524
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST227:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL186-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL186-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS229:
+	.uleb128 .LVU524
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST229:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS231:
+	.uleb128 .LVU524
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST231:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL185-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL185-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS232:
+	.uleb128 .LVU524
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST232:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	0
+	.quad	0
+.LVUS233:
+	.uleb128 .LVU528
+	.uleb128 .LVU550
+	.uleb128 .LVU598
+	.uleb128 .LVU604
+.LLST233:
+	.quad	.LVL184-.Ltext0
+	.quad	.LVL192-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS234:
+	.uleb128 .LVU530
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+	.uleb128 .LVU598
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU604
+.LLST234:
+	.quad	.LVL186-.Ltext0
+	.quad	.LVL187-.Ltext0
+	.value	0x1
+	.byte	0x58
+	.quad	.LVL187-.Ltext0
+	.quad	.LVL188-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL188-.Ltext0
+	.quad	.LVL189-.Ltext0
+	.value	0x3
+	.byte	0x7a
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL189-.Ltext0
+	.quad	.LVL190-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL214-.Ltext0
+	.quad	.LVL216-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	.LVL216-.Ltext0
+	.quad	.LVL217-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS235:
+	.uleb128 .LVU516
+	.uleb128 .LVU518
+.LLST235:
+	.quad	.LVL182-.Ltext0
+	.quad	.LVL182-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -80
+	.quad	0
+	.quad	0
+.LVUS236:
+	.uleb128 .LVU516
+	.uleb128 .LVU518
+.LLST236:
+	.quad	.LVL182-.Ltext0
+	.quad	.LVL182-.Ltext0
+	.value	0x3
+	.byte	0x78
+	.sleb128 8
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS237:
+	.uleb128 .LVU521
+	.uleb128 .LVU524
+.LLST237:
+	.quad	.LVL183-.Ltext0
+	.quad	.LVL184-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS238:
+	.uleb128 .LVU521
+	.uleb128 .LVU524
+.LLST238:
+	.quad	.LVL183-.Ltext0
+	.quad	.LVL184-.Ltext0
+	.value	0x1
+	.byte	0x5a
+	.quad	0
+	.quad	0
+.LVUS239:
+	.uleb128 .LVU611
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST239:
+	.quad	.LVL223-.Ltext0
+	.quad	.LVL224-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL224-.Ltext0
+	.quad	.LVL225-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL225-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL236-.Ltext0
+	.quad	.LVL237-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x9f
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	0
+	.quad	0
+.LVUS240:
+	.uleb128 .LVU611
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST240:
+	.quad	.LVL223-.Ltext0
+	.quad	.LVL226-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL226-.Ltext0
+	.quad	.LVL227-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL227-.Ltext0
+	.quad	.LVL235-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL235-.Ltext0
+	.quad	.LVL236-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	0
+	.quad	0
+.LVUS241:
+	.uleb128 .LVU621
+	.uleb128 .LVU624
+.LLST241:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL228-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS242:
+	.uleb128 .LVU621
+	.uleb128 .LVU624
+.LLST242:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL228-.Ltext0
+	.value	0x7
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS243:
+	.uleb128 .LVU618
+	.uleb128 .LVU621
+.LLST243:
+	.quad	.LVL227-.Ltext0
+	.quad	.LVL228-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS244:
+	.uleb128 .LVU618
+	.uleb128 .LVU621
+.LLST244:
+	.quad	.LVL227-.Ltext0
+	.quad	.LVL228-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	0
+	.quad	0
+.LVUS245:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST245:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS246:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST246:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	0
+	.quad	0
+.LVUS247:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST247:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x2a
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x2a
+	.byte	0x91
+	.sleb128 -144
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x91
+	.sleb128 -184
+	.byte	0x6
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS248:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST248:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	0
+	.quad	0
+.LVUS250:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST250:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS252:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST252:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS253:
+	.uleb128 .LVU624
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST253:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	0
+	.quad	0
+.LVUS254:
+	.uleb128 .LVU628
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST254:
+	.quad	.LVL228-.Ltext0
+	.quad	.LVL229-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -144
+	.quad	.LVL229-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x54
+	.quad	0
+	.quad	0
+.LVUS255:
+	.uleb128 .LVU630
+	.uleb128 .LVU634
+	.uleb128 .LVU634
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 .LVU648
+	.uleb128 .LVU653
+	.uleb128 0
+.LLST255:
+	.quad	.LVL229-.Ltext0
+	.quad	.LVL230-.Ltext0
+	.value	0x1
+	.byte	0x59
+	.quad	.LVL230-.Ltext0
+	.quad	.LVL231-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL231-.Ltext0
+	.quad	.LVL232-.Ltext0
+	.value	0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.quad	.LVL232-.Ltext0
+	.quad	.LVL234-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL237-.Ltext0
+	.quad	.LFE27-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+.LVUS256:
+	.uleb128 .LVU559
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+.LLST256:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL199-.Ltext0
+	.value	0x1
+	.byte	0x51
+	.quad	.LVL199-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -200
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS258:
+	.uleb128 .LVU559
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU568
+.LLST258:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL197-.Ltext0
+	.value	0x1
+	.byte	0x52
+	.quad	.LVL197-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -112
+	.quad	0
+	.quad	0
+.LVUS260:
+	.uleb128 .LVU559
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+.LLST260:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS261:
+	.uleb128 .LVU559
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU568
+.LLST261:
+	.quad	.LVL196-.Ltext0
+	.quad	.LVL200-1-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	.LVL200-1-.Ltext0
+	.quad	.LVL201-.Ltext0
+	.value	0x4
+	.byte	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS262:
+	.uleb128 .LVU573
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU595
+	.uleb128 .LVU595
+	.uleb128 .LVU597
+.LLST262:
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL205-.Ltext0
+	.value	0x1
+	.byte	0x56
+	.quad	.LVL205-.Ltext0
+	.quad	.LVL206-.Ltext0
+	.value	0x1
+	.byte	0x5e
+	.quad	.LVL206-.Ltext0
+	.quad	.LVL213-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	.LVL213-.Ltext0
+	.quad	.LVL213-.Ltext0
+	.value	0x3
+	.byte	0x76
+	.sleb128 -8
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS263:
+	.uleb128 .LVU573
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+.LLST263:
+	.quad	.LVL204-.Ltext0
+	.quad	.LVL206-.Ltext0
+	.value	0x2
+	.byte	0x30
+	.byte	0x9f
+	.quad	.LVL206-.Ltext0
+	.quad	.LVL207-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL212-.Ltext0
+	.quad	.LVL213-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS264:
+	.uleb128 .LVU578
+	.uleb128 .LVU593
+.LLST264:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x4
+	.byte	0xa
+	.value	0x400
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS266:
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+.LLST266:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x55
+	.quad	0
+	.quad	0
+.LVUS267:
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+.LLST267:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	0
+	.quad	0
+.LVUS268:
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+.LLST268:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x25
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa
+	.value	0x400
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS269:
+	.uleb128 .LVU577
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU593
+.LLST269:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL208-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	.LVL208-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x3
+	.byte	0x91
+	.sleb128 -184
+	.quad	0
+	.quad	0
+.LVUS270:
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+.LLST270:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x5d
+	.quad	0
+	.quad	0
+.LVUS271:
+	.uleb128 .LVU577
+	.uleb128 .LVU593
+.LLST271:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x4
+	.byte	0xa
+	.value	0x400
+	.byte	0x9f
+	.quad	0
+	.quad	0
+.LVUS273:
+	.uleb128 .LVU578
+	.uleb128 .LVU593
+.LLST273:
+	.quad	.LVL207-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x5b
+	.quad	0
+	.quad	0
+.LVUS274:
+	.uleb128 .LVU580
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU593
+.LLST274:
+	.quad	.LVL208-.Ltext0
+	.quad	.LVL209-.Ltext0
+	.value	0x1
+	.byte	0x5f
+	.quad	.LVL209-.Ltext0
+	.quad	.LVL212-.Ltext0
+	.value	0x1
+	.byte	0x50
+	.quad	0
+	.quad	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_ranges,"",@progbits
+.Ldebug_ranges0:
+	.quad	.LBB92-.Ltext0
+	.quad	.LBE92-.Ltext0
+	.quad	.LBB105-.Ltext0
+	.quad	.LBE105-.Ltext0
+	.quad	.LBB106-.Ltext0
+	.quad	.LBE106-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB93-.Ltext0
+	.quad	.LBE93-.Ltext0
+	.quad	.LBB102-.Ltext0
+	.quad	.LBE102-.Ltext0
+	.quad	.LBB103-.Ltext0
+	.quad	.LBE103-.Ltext0
+	.quad	.LBB104-.Ltext0
+	.quad	.LBE104-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB95-.Ltext0
+	.quad	.LBE95-.Ltext0
+	.quad	.LBB96-.Ltext0
+	.quad	.LBE96-.Ltext0
+	.quad	.LBB97-.Ltext0
+	.quad	.LBE97-.Ltext0
+	.quad	.LBB98-.Ltext0
+	.quad	.LBE98-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB108-.Ltext0
+	.quad	.LBE108-.Ltext0
+	.quad	.LBB116-.Ltext0
+	.quad	.LBE116-.Ltext0
+	.quad	.LBB117-.Ltext0
+	.quad	.LBE117-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB110-.Ltext0
+	.quad	.LBE110-.Ltext0
+	.quad	.LBB111-.Ltext0
+	.quad	.LBE111-.Ltext0
+	.quad	.LBB112-.Ltext0
+	.quad	.LBE112-.Ltext0
+	.quad	.LBB113-.Ltext0
+	.quad	.LBE113-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB118-.Ltext0
+	.quad	.LBE118-.Ltext0
+	.quad	.LBB120-.Ltext0
+	.quad	.LBE120-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB121-.Ltext0
+	.quad	.LBE121-.Ltext0
+	.quad	.LBB126-.Ltext0
+	.quad	.LBE126-.Ltext0
+	.quad	.LBB127-.Ltext0
+	.quad	.LBE127-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB123-.Ltext0
+	.quad	.LBE123-.Ltext0
+	.quad	.LBB124-.Ltext0
+	.quad	.LBE124-.Ltext0
+	.quad	.LBB125-.Ltext0
+	.quad	.LBE125-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB178-.Ltext0
+	.quad	.LBE178-.Ltext0
+	.quad	.LBB200-.Ltext0
+	.quad	.LBE200-.Ltext0
+	.quad	.LBB201-.Ltext0
+	.quad	.LBE201-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB181-.Ltext0
+	.quad	.LBE181-.Ltext0
+	.quad	.LBB194-.Ltext0
+	.quad	.LBE194-.Ltext0
+	.quad	.LBB195-.Ltext0
+	.quad	.LBE195-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB182-.Ltext0
+	.quad	.LBE182-.Ltext0
+	.quad	.LBB185-.Ltext0
+	.quad	.LBE185-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB188-.Ltext0
+	.quad	.LBE188-.Ltext0
+	.quad	.LBB193-.Ltext0
+	.quad	.LBE193-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB190-.Ltext0
+	.quad	.LBE190-.Ltext0
+	.quad	.LBB191-.Ltext0
+	.quad	.LBE191-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB252-.Ltext0
+	.quad	.LBE252-.Ltext0
+	.quad	.LBB277-.Ltext0
+	.quad	.LBE277-.Ltext0
+	.quad	.LBB278-.Ltext0
+	.quad	.LBE278-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB254-.Ltext0
+	.quad	.LBE254-.Ltext0
+	.quad	.LBB273-.Ltext0
+	.quad	.LBE273-.Ltext0
+	.quad	.LBB274-.Ltext0
+	.quad	.LBE274-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB255-.Ltext0
+	.quad	.LBE255-.Ltext0
+	.quad	.LBB263-.Ltext0
+	.quad	.LBE263-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB258-.Ltext0
+	.quad	.LBE258-.Ltext0
+	.quad	.LBB262-.Ltext0
+	.quad	.LBE262-.Ltext0
+	.quad	.LBB270-.Ltext0
+	.quad	.LBE270-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB264-.Ltext0
+	.quad	.LBE264-.Ltext0
+	.quad	.LBB271-.Ltext0
+	.quad	.LBE271-.Ltext0
+	.quad	.LBB272-.Ltext0
+	.quad	.LBE272-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB266-.Ltext0
+	.quad	.LBE266-.Ltext0
+	.quad	.LBB267-.Ltext0
+	.quad	.LBE267-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB359-.Ltext0
+	.quad	.LBE359-.Ltext0
+	.quad	.LBB500-.Ltext0
+	.quad	.LBE500-.Ltext0
+	.quad	.LBB501-.Ltext0
+	.quad	.LBE501-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB360-.Ltext0
+	.quad	.LBE360-.Ltext0
+	.quad	.LBB499-.Ltext0
+	.quad	.LBE499-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB361-.Ltext0
+	.quad	.LBE361-.Ltext0
+	.quad	.LBB365-.Ltext0
+	.quad	.LBE365-.Ltext0
+	.quad	.LBB496-.Ltext0
+	.quad	.LBE496-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB366-.Ltext0
+	.quad	.LBE366-.Ltext0
+	.quad	.LBB497-.Ltext0
+	.quad	.LBE497-.Ltext0
+	.quad	.LBB498-.Ltext0
+	.quad	.LBE498-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB367-.Ltext0
+	.quad	.LBE367-.Ltext0
+	.quad	.LBB494-.Ltext0
+	.quad	.LBE494-.Ltext0
+	.quad	.LBB495-.Ltext0
+	.quad	.LBE495-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB368-.Ltext0
+	.quad	.LBE368-.Ltext0
+	.quad	.LBB485-.Ltext0
+	.quad	.LBE485-.Ltext0
+	.quad	.LBB492-.Ltext0
+	.quad	.LBE492-.Ltext0
+	.quad	.LBB493-.Ltext0
+	.quad	.LBE493-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB370-.Ltext0
+	.quad	.LBE370-.Ltext0
+	.quad	.LBB452-.Ltext0
+	.quad	.LBE452-.Ltext0
+	.quad	.LBB453-.Ltext0
+	.quad	.LBE453-.Ltext0
+	.quad	.LBB481-.Ltext0
+	.quad	.LBE481-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB372-.Ltext0
+	.quad	.LBE372-.Ltext0
+	.quad	.LBB443-.Ltext0
+	.quad	.LBE443-.Ltext0
+	.quad	.LBB444-.Ltext0
+	.quad	.LBE444-.Ltext0
+	.quad	.LBB445-.Ltext0
+	.quad	.LBE445-.Ltext0
+	.quad	.LBB446-.Ltext0
+	.quad	.LBE446-.Ltext0
+	.quad	.LBB447-.Ltext0
+	.quad	.LBE447-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB373-.Ltext0
+	.quad	.LBE373-.Ltext0
+	.quad	.LBB435-.Ltext0
+	.quad	.LBE435-.Ltext0
+	.quad	.LBB436-.Ltext0
+	.quad	.LBE436-.Ltext0
+	.quad	.LBB437-.Ltext0
+	.quad	.LBE437-.Ltext0
+	.quad	.LBB438-.Ltext0
+	.quad	.LBE438-.Ltext0
+	.quad	.LBB439-.Ltext0
+	.quad	.LBE439-.Ltext0
+	.quad	.LBB440-.Ltext0
+	.quad	.LBE440-.Ltext0
+	.quad	.LBB441-.Ltext0
+	.quad	.LBE441-.Ltext0
+	.quad	.LBB442-.Ltext0
+	.quad	.LBE442-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB374-.Ltext0
+	.quad	.LBE374-.Ltext0
+	.quad	.LBB422-.Ltext0
+	.quad	.LBE422-.Ltext0
+	.quad	.LBB423-.Ltext0
+	.quad	.LBE423-.Ltext0
+	.quad	.LBB424-.Ltext0
+	.quad	.LBE424-.Ltext0
+	.quad	.LBB425-.Ltext0
+	.quad	.LBE425-.Ltext0
+	.quad	.LBB426-.Ltext0
+	.quad	.LBE426-.Ltext0
+	.quad	.LBB427-.Ltext0
+	.quad	.LBE427-.Ltext0
+	.quad	.LBB431-.Ltext0
+	.quad	.LBE431-.Ltext0
+	.quad	.LBB433-.Ltext0
+	.quad	.LBE433-.Ltext0
+	.quad	.LBB434-.Ltext0
+	.quad	.LBE434-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB376-.Ltext0
+	.quad	.LBE376-.Ltext0
+	.quad	.LBB391-.Ltext0
+	.quad	.LBE391-.Ltext0
+	.quad	.LBB392-.Ltext0
+	.quad	.LBE392-.Ltext0
+	.quad	.LBB393-.Ltext0
+	.quad	.LBE393-.Ltext0
+	.quad	.LBB409-.Ltext0
+	.quad	.LBE409-.Ltext0
+	.quad	.LBB410-.Ltext0
+	.quad	.LBE410-.Ltext0
+	.quad	.LBB411-.Ltext0
+	.quad	.LBE411-.Ltext0
+	.quad	.LBB412-.Ltext0
+	.quad	.LBE412-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB377-.Ltext0
+	.quad	.LBE377-.Ltext0
+	.quad	.LBB386-.Ltext0
+	.quad	.LBE386-.Ltext0
+	.quad	.LBB387-.Ltext0
+	.quad	.LBE387-.Ltext0
+	.quad	.LBB388-.Ltext0
+	.quad	.LBE388-.Ltext0
+	.quad	.LBB389-.Ltext0
+	.quad	.LBE389-.Ltext0
+	.quad	.LBB390-.Ltext0
+	.quad	.LBE390-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB379-.Ltext0
+	.quad	.LBE379-.Ltext0
+	.quad	.LBB380-.Ltext0
+	.quad	.LBE380-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB394-.Ltext0
+	.quad	.LBE394-.Ltext0
+	.quad	.LBB403-.Ltext0
+	.quad	.LBE403-.Ltext0
+	.quad	.LBB404-.Ltext0
+	.quad	.LBE404-.Ltext0
+	.quad	.LBB405-.Ltext0
+	.quad	.LBE405-.Ltext0
+	.quad	.LBB406-.Ltext0
+	.quad	.LBE406-.Ltext0
+	.quad	.LBB407-.Ltext0
+	.quad	.LBE407-.Ltext0
+	.quad	.LBB408-.Ltext0
+	.quad	.LBE408-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB395-.Ltext0
+	.quad	.LBE395-.Ltext0
+	.quad	.LBB401-.Ltext0
+	.quad	.LBE401-.Ltext0
+	.quad	.LBB402-.Ltext0
+	.quad	.LBE402-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB397-.Ltext0
+	.quad	.LBE397-.Ltext0
+	.quad	.LBB398-.Ltext0
+	.quad	.LBE398-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB428-.Ltext0
+	.quad	.LBE428-.Ltext0
+	.quad	.LBB432-.Ltext0
+	.quad	.LBE432-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB454-.Ltext0
+	.quad	.LBE454-.Ltext0
+	.quad	.LBB476-.Ltext0
+	.quad	.LBE476-.Ltext0
+	.quad	.LBB478-.Ltext0
+	.quad	.LBE478-.Ltext0
+	.quad	.LBB480-.Ltext0
+	.quad	.LBE480-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB455-.Ltext0
+	.quad	.LBE455-.Ltext0
+	.quad	.LBB468-.Ltext0
+	.quad	.LBE468-.Ltext0
+	.quad	.LBB469-.Ltext0
+	.quad	.LBE469-.Ltext0
+	.quad	.LBB470-.Ltext0
+	.quad	.LBE470-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB456-.Ltext0
+	.quad	.LBE456-.Ltext0
+	.quad	.LBB461-.Ltext0
+	.quad	.LBE461-.Ltext0
+	.quad	.LBB463-.Ltext0
+	.quad	.LBE463-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB460-.Ltext0
+	.quad	.LBE460-.Ltext0
+	.quad	.LBB462-.Ltext0
+	.quad	.LBE462-.Ltext0
+	.quad	.LBB464-.Ltext0
+	.quad	.LBE464-.Ltext0
+	.quad	.LBB465-.Ltext0
+	.quad	.LBE465-.Ltext0
+	.quad	.LBB466-.Ltext0
+	.quad	.LBE466-.Ltext0
+	.quad	.LBB467-.Ltext0
+	.quad	.LBE467-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB471-.Ltext0
+	.quad	.LBE471-.Ltext0
+	.quad	.LBB477-.Ltext0
+	.quad	.LBE477-.Ltext0
+	.quad	.LBB479-.Ltext0
+	.quad	.LBE479-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB472-.Ltext0
+	.quad	.LBE472-.Ltext0
+	.quad	.LBB475-.Ltext0
+	.quad	.LBE475-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB486-.Ltext0
+	.quad	.LBE486-.Ltext0
+	.quad	.LBB490-.Ltext0
+	.quad	.LBE490-.Ltext0
+	.quad	.LBB491-.Ltext0
+	.quad	.LBE491-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB626-.Ltext0
+	.quad	.LBE626-.Ltext0
+	.quad	.LBB692-.Ltext0
+	.quad	.LBE692-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB628-.Ltext0
+	.quad	.LBE628-.Ltext0
+	.quad	.LBB656-.Ltext0
+	.quad	.LBE656-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB632-.Ltext0
+	.quad	.LBE632-.Ltext0
+	.quad	.LBB651-.Ltext0
+	.quad	.LBE651-.Ltext0
+	.quad	.LBB652-.Ltext0
+	.quad	.LBE652-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB633-.Ltext0
+	.quad	.LBE633-.Ltext0
+	.quad	.LBB649-.Ltext0
+	.quad	.LBE649-.Ltext0
+	.quad	.LBB650-.Ltext0
+	.quad	.LBE650-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB635-.Ltext0
+	.quad	.LBE635-.Ltext0
+	.quad	.LBB636-.Ltext0
+	.quad	.LBE636-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB639-.Ltext0
+	.quad	.LBE639-.Ltext0
+	.quad	.LBB643-.Ltext0
+	.quad	.LBE643-.Ltext0
+	.quad	.LBB644-.Ltext0
+	.quad	.LBE644-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB645-.Ltext0
+	.quad	.LBE645-.Ltext0
+	.quad	.LBB648-.Ltext0
+	.quad	.LBE648-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB660-.Ltext0
+	.quad	.LBE660-.Ltext0
+	.quad	.LBB679-.Ltext0
+	.quad	.LBE679-.Ltext0
+	.quad	.LBB680-.Ltext0
+	.quad	.LBE680-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB661-.Ltext0
+	.quad	.LBE661-.Ltext0
+	.quad	.LBB665-.Ltext0
+	.quad	.LBE665-.Ltext0
+	.quad	.LBB669-.Ltext0
+	.quad	.LBE669-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB666-.Ltext0
+	.quad	.LBE666-.Ltext0
+	.quad	.LBB676-.Ltext0
+	.quad	.LBE676-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB670-.Ltext0
+	.quad	.LBE670-.Ltext0
+	.quad	.LBB677-.Ltext0
+	.quad	.LBE677-.Ltext0
+	.quad	.LBB678-.Ltext0
+	.quad	.LBE678-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB672-.Ltext0
+	.quad	.LBE672-.Ltext0
+	.quad	.LBB673-.Ltext0
+	.quad	.LBE673-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB687-.Ltext0
+	.quad	.LBE687-.Ltext0
+	.quad	.LBB691-.Ltext0
+	.quad	.LBE691-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB775-.Ltext0
+	.quad	.LBE775-.Ltext0
+	.quad	.LBB964-.Ltext0
+	.quad	.LBE964-.Ltext0
+	.quad	.LBB965-.Ltext0
+	.quad	.LBE965-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB777-.Ltext0
+	.quad	.LBE777-.Ltext0
+	.quad	.LBB961-.Ltext0
+	.quad	.LBE961-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB778-.Ltext0
+	.quad	.LBE778-.Ltext0
+	.quad	.LBB783-.Ltext0
+	.quad	.LBE783-.Ltext0
+	.quad	.LBB956-.Ltext0
+	.quad	.LBE956-.Ltext0
+	.quad	.LBB958-.Ltext0
+	.quad	.LBE958-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB784-.Ltext0
+	.quad	.LBE784-.Ltext0
+	.quad	.LBB957-.Ltext0
+	.quad	.LBE957-.Ltext0
+	.quad	.LBB959-.Ltext0
+	.quad	.LBE959-.Ltext0
+	.quad	.LBB960-.Ltext0
+	.quad	.LBE960-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB785-.Ltext0
+	.quad	.LBE785-.Ltext0
+	.quad	.LBB953-.Ltext0
+	.quad	.LBE953-.Ltext0
+	.quad	.LBB954-.Ltext0
+	.quad	.LBE954-.Ltext0
+	.quad	.LBB955-.Ltext0
+	.quad	.LBE955-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB786-.Ltext0
+	.quad	.LBE786-.Ltext0
+	.quad	.LBB920-.Ltext0
+	.quad	.LBE920-.Ltext0
+	.quad	.LBB921-.Ltext0
+	.quad	.LBE921-.Ltext0
+	.quad	.LBB943-.Ltext0
+	.quad	.LBE943-.Ltext0
+	.quad	.LBB944-.Ltext0
+	.quad	.LBE944-.Ltext0
+	.quad	.LBB946-.Ltext0
+	.quad	.LBE946-.Ltext0
+	.quad	.LBB951-.Ltext0
+	.quad	.LBE951-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB788-.Ltext0
+	.quad	.LBE788-.Ltext0
+	.quad	.LBB881-.Ltext0
+	.quad	.LBE881-.Ltext0
+	.quad	.LBB882-.Ltext0
+	.quad	.LBE882-.Ltext0
+	.quad	.LBB883-.Ltext0
+	.quad	.LBE883-.Ltext0
+	.quad	.LBB911-.Ltext0
+	.quad	.LBE911-.Ltext0
+	.quad	.LBB912-.Ltext0
+	.quad	.LBE912-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB790-.Ltext0
+	.quad	.LBE790-.Ltext0
+	.quad	.LBB869-.Ltext0
+	.quad	.LBE869-.Ltext0
+	.quad	.LBB870-.Ltext0
+	.quad	.LBE870-.Ltext0
+	.quad	.LBB871-.Ltext0
+	.quad	.LBE871-.Ltext0
+	.quad	.LBB872-.Ltext0
+	.quad	.LBE872-.Ltext0
+	.quad	.LBB873-.Ltext0
+	.quad	.LBE873-.Ltext0
+	.quad	.LBB874-.Ltext0
+	.quad	.LBE874-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB791-.Ltext0
+	.quad	.LBE791-.Ltext0
+	.quad	.LBB859-.Ltext0
+	.quad	.LBE859-.Ltext0
+	.quad	.LBB860-.Ltext0
+	.quad	.LBE860-.Ltext0
+	.quad	.LBB861-.Ltext0
+	.quad	.LBE861-.Ltext0
+	.quad	.LBB862-.Ltext0
+	.quad	.LBE862-.Ltext0
+	.quad	.LBB863-.Ltext0
+	.quad	.LBE863-.Ltext0
+	.quad	.LBB864-.Ltext0
+	.quad	.LBE864-.Ltext0
+	.quad	.LBB865-.Ltext0
+	.quad	.LBE865-.Ltext0
+	.quad	.LBB866-.Ltext0
+	.quad	.LBE866-.Ltext0
+	.quad	.LBB867-.Ltext0
+	.quad	.LBE867-.Ltext0
+	.quad	.LBB868-.Ltext0
+	.quad	.LBE868-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB792-.Ltext0
+	.quad	.LBE792-.Ltext0
+	.quad	.LBB847-.Ltext0
+	.quad	.LBE847-.Ltext0
+	.quad	.LBB848-.Ltext0
+	.quad	.LBE848-.Ltext0
+	.quad	.LBB849-.Ltext0
+	.quad	.LBE849-.Ltext0
+	.quad	.LBB850-.Ltext0
+	.quad	.LBE850-.Ltext0
+	.quad	.LBB851-.Ltext0
+	.quad	.LBE851-.Ltext0
+	.quad	.LBB852-.Ltext0
+	.quad	.LBE852-.Ltext0
+	.quad	.LBB853-.Ltext0
+	.quad	.LBE853-.Ltext0
+	.quad	.LBB854-.Ltext0
+	.quad	.LBE854-.Ltext0
+	.quad	.LBB857-.Ltext0
+	.quad	.LBE857-.Ltext0
+	.quad	.LBB858-.Ltext0
+	.quad	.LBE858-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB794-.Ltext0
+	.quad	.LBE794-.Ltext0
+	.quad	.LBB813-.Ltext0
+	.quad	.LBE813-.Ltext0
+	.quad	.LBB814-.Ltext0
+	.quad	.LBE814-.Ltext0
+	.quad	.LBB815-.Ltext0
+	.quad	.LBE815-.Ltext0
+	.quad	.LBB816-.Ltext0
+	.quad	.LBE816-.Ltext0
+	.quad	.LBB817-.Ltext0
+	.quad	.LBE817-.Ltext0
+	.quad	.LBB831-.Ltext0
+	.quad	.LBE831-.Ltext0
+	.quad	.LBB833-.Ltext0
+	.quad	.LBE833-.Ltext0
+	.quad	.LBB834-.Ltext0
+	.quad	.LBE834-.Ltext0
+	.quad	.LBB835-.Ltext0
+	.quad	.LBE835-.Ltext0
+	.quad	.LBB836-.Ltext0
+	.quad	.LBE836-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB795-.Ltext0
+	.quad	.LBE795-.Ltext0
+	.quad	.LBB806-.Ltext0
+	.quad	.LBE806-.Ltext0
+	.quad	.LBB807-.Ltext0
+	.quad	.LBE807-.Ltext0
+	.quad	.LBB808-.Ltext0
+	.quad	.LBE808-.Ltext0
+	.quad	.LBB809-.Ltext0
+	.quad	.LBE809-.Ltext0
+	.quad	.LBB810-.Ltext0
+	.quad	.LBE810-.Ltext0
+	.quad	.LBB811-.Ltext0
+	.quad	.LBE811-.Ltext0
+	.quad	.LBB812-.Ltext0
+	.quad	.LBE812-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB797-.Ltext0
+	.quad	.LBE797-.Ltext0
+	.quad	.LBB798-.Ltext0
+	.quad	.LBE798-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB818-.Ltext0
+	.quad	.LBE818-.Ltext0
+	.quad	.LBB827-.Ltext0
+	.quad	.LBE827-.Ltext0
+	.quad	.LBB828-.Ltext0
+	.quad	.LBE828-.Ltext0
+	.quad	.LBB829-.Ltext0
+	.quad	.LBE829-.Ltext0
+	.quad	.LBB830-.Ltext0
+	.quad	.LBE830-.Ltext0
+	.quad	.LBB832-.Ltext0
+	.quad	.LBE832-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB819-.Ltext0
+	.quad	.LBE819-.Ltext0
+	.quad	.LBB825-.Ltext0
+	.quad	.LBE825-.Ltext0
+	.quad	.LBB826-.Ltext0
+	.quad	.LBE826-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB821-.Ltext0
+	.quad	.LBE821-.Ltext0
+	.quad	.LBB822-.Ltext0
+	.quad	.LBE822-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB884-.Ltext0
+	.quad	.LBE884-.Ltext0
+	.quad	.LBB907-.Ltext0
+	.quad	.LBE907-.Ltext0
+	.quad	.LBB909-.Ltext0
+	.quad	.LBE909-.Ltext0
+	.quad	.LBB913-.Ltext0
+	.quad	.LBE913-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB885-.Ltext0
+	.quad	.LBE885-.Ltext0
+	.quad	.LBB900-.Ltext0
+	.quad	.LBE900-.Ltext0
+	.quad	.LBB901-.Ltext0
+	.quad	.LBE901-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB886-.Ltext0
+	.quad	.LBE886-.Ltext0
+	.quad	.LBB892-.Ltext0
+	.quad	.LBE892-.Ltext0
+	.quad	.LBB894-.Ltext0
+	.quad	.LBE894-.Ltext0
+	.quad	.LBB896-.Ltext0
+	.quad	.LBE896-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB891-.Ltext0
+	.quad	.LBE891-.Ltext0
+	.quad	.LBB893-.Ltext0
+	.quad	.LBE893-.Ltext0
+	.quad	.LBB895-.Ltext0
+	.quad	.LBE895-.Ltext0
+	.quad	.LBB897-.Ltext0
+	.quad	.LBE897-.Ltext0
+	.quad	.LBB898-.Ltext0
+	.quad	.LBE898-.Ltext0
+	.quad	.LBB899-.Ltext0
+	.quad	.LBE899-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB902-.Ltext0
+	.quad	.LBE902-.Ltext0
+	.quad	.LBB908-.Ltext0
+	.quad	.LBE908-.Ltext0
+	.quad	.LBB910-.Ltext0
+	.quad	.LBE910-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB903-.Ltext0
+	.quad	.LBE903-.Ltext0
+	.quad	.LBB906-.Ltext0
+	.quad	.LBE906-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB922-.Ltext0
+	.quad	.LBE922-.Ltext0
+	.quad	.LBB925-.Ltext0
+	.quad	.LBE925-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB926-.Ltext0
+	.quad	.LBE926-.Ltext0
+	.quad	.LBB945-.Ltext0
+	.quad	.LBE945-.Ltext0
+	.quad	.LBB952-.Ltext0
+	.quad	.LBE952-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB927-.Ltext0
+	.quad	.LBE927-.Ltext0
+	.quad	.LBB933-.Ltext0
+	.quad	.LBE933-.Ltext0
+	.quad	.LBB940-.Ltext0
+	.quad	.LBE940-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB929-.Ltext0
+	.quad	.LBE929-.Ltext0
+	.quad	.LBB932-.Ltext0
+	.quad	.LBE932-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB934-.Ltext0
+	.quad	.LBE934-.Ltext0
+	.quad	.LBB941-.Ltext0
+	.quad	.LBE941-.Ltext0
+	.quad	.LBB942-.Ltext0
+	.quad	.LBE942-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB936-.Ltext0
+	.quad	.LBE936-.Ltext0
+	.quad	.LBB939-.Ltext0
+	.quad	.LBE939-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB949-.Ltext0
+	.quad	.LBE949-.Ltext0
+	.quad	.LBB950-.Ltext0
+	.quad	.LBE950-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB973-.Ltext0
+	.quad	.LBE973-.Ltext0
+	.quad	.LBB974-.Ltext0
+	.quad	.LBE974-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB975-.Ltext0
+	.quad	.LBE975-.Ltext0
+	.quad	.LBB980-.Ltext0
+	.quad	.LBE980-.Ltext0
+	.quad	0
+	.quad	0
+	.quad	.LBB977-.Ltext0
+	.quad	.LBE977-.Ltext0
+	.quad	.LBB978-.Ltext0
+	.quad	.LBE978-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF21:
+	.string	"trans_rect"
+.LASF41:
+	.string	"count"
+.LASF28:
+	.string	"transpose_recursive"
+.LASF16:
+	.string	"log_block"
+.LASF11:
+	.string	"size_t"
+.LASF10:
+	.string	"uintptr_t"
+.LASF9:
+	.string	"uint64_t"
+.LASF37:
+	.string	"rows"
+.LASF14:
+	.string	"log_sets"
+.LASF26:
+	.string	"trans_tmp"
+.LASF46:
+	.string	"cache_set"
+.LASF12:
+	.string	"long long int"
+.LASF4:
+	.string	"signed char"
+.LASF52:
+	.string	"min_size"
+.LASF6:
+	.string	"long int"
+.LASF33:
+	.string	"transpose_tile_staged"
+.LASF13:
+	.string	"double"
+.LASF22:
+	.string	"trans_staged"
+.LASF45:
+	.string	"line"
+.LASF47:
+	.string	"mask"
+.LASF40:
+	.string	"tile_lines_in_set"
+.LASF36:
+	.string	"stage_slots"
+.LASF2:
+	.string	"unsigned int"
+.LASF3:
+	.string	"long unsigned int"
+.LASF31:
+	.string	"always"
+.LASF17:
+	.string	"cache_geom_t"
+.LASF1:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"lines_in_set"
+.LASF44:
+	.string	"last"
+.LASF38:
+	.string	"slot"
+.LASF18:
+	.string	"test_cache"
+.LASF53:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -g -gdwarf-4 -O3 -std=c99 -fno-unroll-loops -fasynchronous-unwind-tables"
+.LASF50:
+	.string	"by_cols"
+.LASF57:
+	.string	"registerFunctions"
+.LASF19:
+	.string	"haswell_l1"
+.LASF34:
+	.string	"slots"
+.LASF23:
+	.string	"trans_staged_l1"
+.LASF8:
+	.string	"__uint64_t"
+.LASF24:
+	.string	"trans_oblivious"
+.LASF32:
+	.string	"_Bool"
+.LASF0:
+	.string	"unsigned char"
+.LASF5:
+	.string	"short int"
+.LASF30:
+	.string	"geom"
+.LASF54:
+	.string	"trans.c"
+.LASF35:
+	.string	"stage_row"
+.LASF43:
+	.string	"first"
+.LASF39:
+	.string	"tile_fits"
+.LASF7:
+	.string	"char"
+.LASF15:
+	.string	"assoc"
+.LASF55:
+	.string	"/root/repo"
+.LASF27:
+	.string	"trans_basic"
+.LASF56:
+	.string	"registerTransFunction"
+.LASF51:
+	.string	"transpose_tile"
+.LASF48:
+	.string	"transpose_tiled"
+.LASF49:
+	.string	"cols"
+.LASF20:
+	.string	"transpose_submit"
+.LASF29:
+	.string	"transpose_staged"
+.LASF25:
+	.string	"trans_blocked"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits